@@ -14,6 +14,11 @@ int main(int argc, char* argv[]) try {
     ("n,num_iter", "Number of iterations", cxxopts::value<size_t>()->default_value(std::to_string(3)))
     ("mt,max_new_tokens", "Maximal number of new tokens", cxxopts::value<size_t>()->default_value(std::to_string(20)))
     ("d,device", "device", cxxopts::value<std::string>()->default_value("CPU"))
+    ("a,draft_model", "Path to draft model directory to benchmark speculative decoding", cxxopts::value<std::string>()->default_value(""))
+    ("prompt_lookup", "Benchmark prompt lookup decoding", cxxopts::value<bool>()->default_value("false"))
+    ("num_assistant_tokens", "Number of candidates of speculative or prompt lookup decoding per step", cxxopts::value<size_t>()->default_value(std::to_string(5)))
+    ("max_ngram_size", "Max n-gram size of prompt lookup decoding", cxxopts::value<size_t>()->default_value(std::to_string(3)))
+    ("attention_backend", "Attention backend: PA or SDPA", cxxopts::value<std::string>()->default_value("PA"))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -36,10 +41,23 @@ int main(int argc, char* argv[]) try {
     size_t num_warmup = result["num_warmup"].as<size_t>();
     size_t num_iter = result["num_iter"].as<size_t>();
 
+    const std::string draft_models_path = result["draft_model"].as<std::string>();
+    const bool is_prompt_lookup = result["prompt_lookup"].as<bool>();
+
     ov::genai::GenerationConfig config;
     config.max_new_tokens = result["max_new_tokens"].as<size_t>();
 
-    ov::genai::LLMPipeline pipe(models_path, device);
+    ov::AnyMap properties{{"ATTENTION_BACKEND", result["attention_backend"].as<std::string>()}};
+    if (!draft_models_path.empty()) {
+        properties.insert(ov::genai::draft_model(draft_models_path, device));
+        config.num_assistant_tokens = result["num_assistant_tokens"].as<size_t>();
+    } else if (is_prompt_lookup) {
+        properties.insert(ov::genai::prompt_lookup(true));
+        config.num_assistant_tokens = result["num_assistant_tokens"].as<size_t>();
+        config.max_ngram_size = result["max_ngram_size"].as<size_t>();
+    }
+
+    ov::genai::LLMPipeline pipe(models_path, device, properties);
 
     for (size_t i = 0; i < num_warmup; i++)
         pipe.generate(prompt, config);
@@ -12,6 +12,7 @@
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/generation_config.hpp"
 #include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/kv_block_pool.hpp"
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/visibility.hpp"
@@ -48,8 +49,34 @@ struct PipelineMetrics {
     * Running average of the KV cache usage during the lifetime of the pipeline, with max window size of 1000 steps
     */
     float avg_cache_usage = 0.0;
+
+    /**
+    * Number of preemptions (requests whose KV cache was released to be recomputed later) during the lifetime of the pipeline
+    */
+    size_t num_preemptions = 0;
 };
 
+/**
+ * @brief data_parallel_replicas property makes ContinuousBatchingPipeline run several replicas of the model behind a single
+ * `add_request` / `step` front-end. On CPU, replicas are bound to NUMA nodes: each replica is compiled and executed on CPUs of
+ * its node and allocates its KV cache there. Requests are routed to the least loaded replica, unless another replica has recently
+ * processed a prefix of the prompt (so it's likely to be in its prefix cache) and is not overloaded.
+ * 0 means one replica per NUMA node, 1 (default) disables data parallelism.
+ * Not supported together with speculative decoding, prompt lookup decoding and visual language models.
+ */
+static constexpr ov::Property<size_t> data_parallel_replicas{"data_parallel_replicas"};
+
+/**
+ * @brief stateful_batch_size property makes ContinuousBatchingPipeline generate up to the given number of requests at once by
+ * a stateful model instead of paged attention: each request owns a row of KV cache of the model, and awaiting requests are
+ * admitted into rows freed by finished ones between generation steps. SchedulerConfig is not used in this mode.
+ * It's a lightweight alternative for CPUs where paged attention doesn't pay off.
+ * Only greedy and multinomial decoding with a single sequence per request are supported.
+ * 0 (default) means paged attention. Not supported together with speculative decoding, prompt lookup decoding,
+ * data-parallel replicas and visual language models.
+ */
+static constexpr ov::Property<size_t> stateful_batch_size{"stateful_batch_size"};
+
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
 protected:
     class IContinuousBatchingPipeline;
@@ -59,11 +86,15 @@ protected:
     class ContinuousBatchingForPromptLookupImpl;
     class SpeculativeDecodingImpl;
     class PromptLookupImpl;
+    class DataParallelImpl;
+    class StatefulBatchingImpl;
 
     friend class ContinuousBatchingForSpeculativeDecodingImpl;
     friend class ContinuousBatchingForPromptLookupImpl;
     friend class SpeculativeDecodingImpl;
     friend class PromptLookupImpl;
+    friend class DataParallelImpl;
+    friend class StatefulBatchingImpl;
 
     std::shared_ptr<IContinuousBatchingPipeline> m_impl;
 
@@ -77,6 +77,9 @@ enum class StopCriteria { EARLY, HEURISTIC, NEVER };
  * @param assistant_confidence_threshold the lower token probability of candidate to be validated by main model in case of dynamic strategy candidates number update.
  * @param num_assistant_tokens the defined candidates number to be generated by draft model/prompt lookup in case of static strategy candidates number update.
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
+ * @param num_assistant_branches the number of draft branches verified by main model in one step in case of tree speculation:
+ *        the draft model starts a branch from each of its top `num_assistant_branches` first tokens and continues it greedily,
+ *        the longest accepted branch is committed. 1 disables tree speculation. Supported only for greedy speculative decoding.
  *
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
  */
@@ -127,6 +130,7 @@ public:
     float assistant_confidence_threshold = 0.f;
     size_t num_assistant_tokens = 0;
     size_t max_ngram_size = 0;
+    size_t num_assistant_branches = 1;
 
     std::optional<AdapterConfig> adapters;
 
@@ -194,6 +198,7 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
 static constexpr ov::Property<float> assistant_confidence_threshold{"assistant_confidence_threshold"};
 static constexpr ov::Property<size_t> num_assistant_tokens{"num_assistant_tokens"};
 static constexpr ov::Property<size_t> max_ngram_size{"max_ngram_size"};
+static constexpr ov::Property<size_t> num_assistant_branches{"num_assistant_branches"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
@@ -21,6 +21,7 @@ struct RawImageGenerationPerfMetrics {
 
 struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
     float load_time; // model load time (includes reshape & read_model time), ms
+    std::vector<ModelLoadInterval> load_timeline; // intervals of loading each model, they overlap since models are loaded in parallel
     float generate_duration; // duration of method generate(...), ms
 
     MeanStdPair iteration_duration; // Mean-Std time of one generation iteration, ms
@@ -45,6 +46,7 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
     std::map<std::string, float> get_text_encoder_infer_duration() const;
     float get_inference_duration();
     float get_load_time() const;
+    std::vector<ModelLoadInterval> get_load_timeline() const;
     float get_generate_duration();
     void get_first_and_other_iter_duration(float& first_iter, float& other_iter_avg);
     void get_first_and_other_unet_infer_duration(float& first_infer, float& other_infer_avg);
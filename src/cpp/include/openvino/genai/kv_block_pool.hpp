@@ -0,0 +1,136 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "openvino/core/any.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Budget of KV cache blocks shared by several ContinuousBatchingPipeline instances (e.g. fine-tuned variants of the same model
+ * or replicas of the model on different NUMA nodes), so KV cache memory follows the load instead of being statically partitioned.
+ *
+ * Each pipeline is registered with a quota - the number of blocks it can always take from the pool. Above the quota, a pipeline can
+ * borrow blocks which are not used by other pipelines. If a pipeline is not able to take blocks within its quota, it waits while
+ * borrowers stop growing and give the blocks back: a borrower which is running requests preempts them on its next step and returns
+ * all its blocks, then takes blocks again without the ones reserved for the waiting pipeline. Pipelines without requests return all
+ * their blocks, except for pipelines with prefix caching, which keep cached prefixes as long as they hold no more than their quota.
+ *
+ * Blocks are returned only by steps of the borrowing pipeline, so a pipeline waits for blocks of a borrower which has requests
+ * until that borrower is stepped, e.g. by its `generate` running in another thread.
+ *
+ * All pipelines sharing the pool must have compatible KV cache layouts, i.e. the same block size in tokens and in bytes.
+ */
+class OPENVINO_GENAI_EXPORTS KVBlockPool {
+public:
+    /**
+     * @param num_kv_blocks Total number of KV cache blocks which can be used by all pipelines sharing the pool.
+     */
+    explicit KVBlockPool(size_t num_kv_blocks);
+
+    /**
+     * Registers a pipeline in the pool. Called by pipelines, users should pass the pool via `ov::genai::kv_block_pool` property.
+     * @param quota Number of blocks guaranteed to the pipeline. Sum of quotas of all pipelines must not exceed the pool size.
+     * @param block_size Size of a KV cache block in tokens.
+     * @param block_size_in_bytes Size of a KV cache block for all decoder layers in bytes.
+     * @return Identifier of the pipeline within the pool.
+     */
+    size_t register_pipeline(size_t quota, size_t block_size, size_t block_size_in_bytes);
+
+    /**
+     * Unregisters a pipeline and returns all its blocks to the pool.
+     */
+    void unregister_pipeline(size_t pipeline_id);
+
+    /**
+     * Takes up to `num_blocks` blocks from the pool.
+     * @return Number of granted blocks, can be less than requested.
+     */
+    size_t acquire(size_t pipeline_id, size_t num_blocks);
+
+    /**
+     * Returns blocks previously granted by `acquire` to the pool. Also resets starving state of the pipeline and wakes up
+     * pipelines waiting in `wait_for_blocks`.
+     */
+    void release(size_t pipeline_id, size_t num_blocks);
+
+    /**
+     * @return Number of borrowed blocks the pipeline has to return, because other pipelines are starving within their quotas
+     * and free blocks of the pool are not enough for them. Zero if the pipeline holds no more than its quota.
+     */
+    size_t get_num_blocks_to_return(size_t pipeline_id) const;
+
+    /**
+     * Blocks the calling thread until other pipelines return blocks to the pool, free blocks cover the rest of the pipeline's quota
+     * or the timeout expires.
+     * @return Whether blocks were returned or are available, false on timeout.
+     */
+    bool wait_for_blocks(size_t pipeline_id, std::chrono::milliseconds timeout);
+
+    /**
+     * @return Whether the last `acquire` of the pipeline was not fully satisfied while the pipeline is within its quota
+     * (or holds no blocks at all), so the pipeline is expected to wait for blocks returned by other pipelines.
+     */
+    bool is_starving(size_t pipeline_id) const;
+
+    size_t get_num_kv_blocks() const;
+
+    size_t get_num_free_blocks() const;
+
+    size_t get_num_held_blocks(size_t pipeline_id) const;
+
+    size_t get_quota(size_t pipeline_id) const;
+
+private:
+    struct PipelineState {
+        size_t quota = 0;
+        size_t num_held_blocks = 0;
+        bool is_starving = false;
+    };
+
+    const PipelineState& get_pipeline(size_t pipeline_id) const;
+    PipelineState& get_pipeline(size_t pipeline_id);
+    size_t get_num_missing_quota_blocks(size_t pipeline_id) const;
+
+    size_t m_num_kv_blocks = 0;
+    size_t m_num_used_blocks = 0;
+    size_t m_total_quota = 0;
+    // KV cache layout of pipelines sharing the pool, set by the first registered pipeline
+    size_t m_block_size = 0;
+    size_t m_block_size_in_bytes = 0;
+    size_t m_next_pipeline_id = 0;
+    std::map<size_t, PipelineState> m_pipelines;
+    // incremented by each return of blocks to wake up waiting pipelines
+    size_t m_num_releases = 0;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_blocks_released;
+};
+
+/**
+ * @brief Describes participation of a pipeline in a shared KV block pool, created by `ov::genai::kv_block_pool` property.
+ */
+struct KVBlockPoolShare {
+    std::shared_ptr<KVBlockPool> pool;
+    size_t quota = 0;
+};
+
+/**
+ * @brief kv_block_pool property makes ContinuousBatchingPipeline take KV cache blocks from a pool shared with other pipelines.
+ * `num_kv_blocks` and `cache_size` of the pipeline's SchedulerConfig must not be set in this case.
+ * @param pool The pool shared by pipelines.
+ * @param quota Number of blocks guaranteed to the pipeline.
+ */
+OPENVINO_GENAI_EXPORTS std::pair<std::string, ov::Any> kv_block_pool(const std::shared_ptr<KVBlockPool>& pool, size_t quota = 0);
+
+}  // namespace ov::genai
@@ -274,6 +274,24 @@ public:
     * Turns off keeping KV cache between generate calls.
     */
     void finish_chat();
+
+    /**
+    * @brief save the current chat, including KV cache of its history, to continue it later by `restore_chat_session`.
+    * The chat remains active. Saved sessions are kept in LRU cache of `chat_sessions_cache_size` sessions.
+    * Supported by the stateful pipeline only, i.e. with `ATTENTION_BACKEND` set to `SDPA`.
+    *
+    * @param session_id id of the session, previously saved session with the same id is replaced.
+    */
+    void save_chat_session(const std::string& session_id);
+
+    /**
+    * @brief finish the current chat and continue the chat saved by `save_chat_session` without recomputation of its history.
+    * The session is removed from the cache, so it should be saved again before switching to another session.
+    *
+    * @param session_id id of the session.
+    * @return false if there is no such session, e.g. it was evicted from the cache; the current chat is kept in this case.
+    */
+    bool restore_chat_session(const std::string& session_id);
 private:
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
 };
@@ -325,5 +343,88 @@ static constexpr ov::Property<SchedulerConfig> scheduler_config{"scheduler_confi
 */
 static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 
+/**
+* @brief prompt_lookup_datastore property sets a path to a datastore of tokenized documents built by `build_prompt_lookup_datastore` tool.
+* Prompt lookup decoding retrieves candidates from the datastore if the sequence itself doesn't contain its last n-gram,
+* which helps with repetitive outputs like code and boilerplate text.
+* Set it together with `prompt_lookup` property.
+*/
+static constexpr ov::Property<std::string> prompt_lookup_datastore{"prompt_lookup_datastore"};
+
+/**
+* @brief self_speculative_draft_layers property activates self-speculative decoding: draft tokens are generated by the first
+* `self_speculative_draft_layers` decoder layers of the main model followed by its final norm and LM head, and validated by the full model.
+* The draft model shares weights and tokenizer with the main model, so no separate draft model is needed.
+* Set it to a number of layers less than the number of the model's decoder layers to activate this mode.
+*/
+static constexpr ov::Property<size_t> self_speculative_draft_layers{"self_speculative_draft_layers"};
+
+/**
+* @brief adaptive_num_assistant_tokens property makes speculative decoding choose the number of draft tokens of each request at every step,
+* based on the request's recent acceptance rate and measured costs of draft and main models.
+* `num_assistant_tokens` of a request becomes the maximum number of draft tokens; drafting is disabled for requests where it does not pay off.
+* Set `true` together with `draft_model` property to activate this mode.
+*/
+static constexpr ov::Property<bool> adaptive_num_assistant_tokens{"adaptive_num_assistant_tokens"};
+
+/**
+* @brief pipelined_speculative_decoding property makes speculative decoding overlap execution of draft and main models:
+* while the main model validates the current draft tokens, the draft model continues drafting assuming all of them are accepted.
+* Tokens drafted ahead are discarded if the main model rejects any of the current draft tokens.
+* Set `true` together with `draft_model` property to activate this mode.
+*/
+static constexpr ov::Property<bool> pipelined_speculative_decoding{"pipelined_speculative_decoding"};
+
+/**
+* @brief cpu_affinity property binds threads executing a model of speculative decoding to the given CPUs.
+* Set it in properties of the main model and of `draft_model` to run the models on separate core groups, e.g. on different sockets.
+* By default, pipelined speculative decoding on a multi-socket CPU runs main and draft models on different NUMA nodes.
+*/
+static constexpr ov::Property<std::vector<size_t>> cpu_affinity{"cpu_affinity"};
+
+/**
+* @brief chat_sessions_cache_size property sets max number of chat sessions saved by `LLMPipeline::save_chat_session`,
+* the least recently saved sessions are evicted. Default: 16.
+*/
+static constexpr ov::Property<size_t> chat_sessions_cache_size{"chat_sessions_cache_size"};
+
+/**
+* @brief compress_chat_sessions property makes `LLMPipeline::save_chat_session` quantize KV cache of saved sessions to u8
+* per token and attention head, which makes them 2-4x smaller at the cost of approximate KV cache of restored sessions.
+*/
+static constexpr ov::Property<bool> compress_chat_sessions{"compress_chat_sessions"};
+
+/**
+* @brief prefill_chunk_size property sets max number of prompt tokens inferred at once by the stateful pipeline:
+* longer prompts are inferred by chunks, which bounds peak memory of activations by the chunk size
+* at the cost of longer time to first token. Default: 0, the whole prompt is inferred at once.
+*/
+static constexpr ov::Property<size_t> prefill_chunk_size{"prefill_chunk_size"};
+
+/**
+* @brief share_models property makes LLMPipeline and ContinuousBatchingPipeline instances of the process share the language model:
+* a model file is read once and its weights are shared by all pipelines reading it, and pipelines compiling the same model
+* for the same device with the same properties share a single compiled model. Shared models are released with the last pipeline using them.
+* It's useful for several pipelines over one model, e.g. replicas or variants with different LoRA adapters.
+* Note that pipelines sharing a compiled model share its streams as well, so concurrent pipelines may need more `ov::num_streams`.
+* Default: false.
+*/
+static constexpr ov::Property<bool> share_models{"share_models"};
+
+/**
+* @brief kv_cache_window_size property bounds KV cache of the stateful pipeline by attention sinks and a sliding window of
+* the most recent tokens (StreamingLLM): when KV cache is full, the oldest tokens of the window are evicted instead of
+* stopping the generation, so chats and generations of any length keep memory of KV cache constant. Keys of the window are
+* re-rotated by RoPE, which is supported for `rotate_half` RoPE of Llama-like models only. Supported for batch size 1 with
+* greedy or multinomial decoding. Default: 0, KV cache isn't bounded.
+*/
+static constexpr ov::Property<size_t> kv_cache_window_size{"kv_cache_window_size"};
+
+/**
+* @brief kv_cache_sink_tokens property sets number of the first tokens of the sequence which are never evicted
+* from KV cache bounded by `kv_cache_window_size`. Default: 4.
+*/
+static constexpr ov::Property<size_t> kv_cache_sink_tokens{"kv_cache_sink_tokens"};
+
 }  // namespace genai
 }  // namespace ov
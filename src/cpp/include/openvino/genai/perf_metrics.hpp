@@ -8,6 +8,7 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <string>
 
 namespace ov {
 namespace genai {
@@ -41,6 +42,20 @@ struct OPENVINO_GENAI_EXPORTS RawPerfMetrics {
     std::vector<MicroSeconds> m_inference_durations;
 };
 
+/**
+ * @brief Loading of a sub-model of a pipeline, i.e. reading and compilation of the model, during construction of the pipeline.
+ * Independent sub-models are loaded in parallel, so their intervals overlap.
+ *
+ * @param model_name Name of the sub-model, e.g. "text_encoder" or "vision_embeddings".
+ * @param start Time from the start of the pipeline construction to the start of loading in milliseconds.
+ * @param duration Duration of loading in milliseconds.
+ */
+struct OPENVINO_GENAI_EXPORTS ModelLoadInterval {
+    std::string model_name;
+    float start;
+    float duration;
+};
+
 /**
 * @brief Structure to store mean and standard deviation values.
 */
@@ -64,12 +79,17 @@ struct OPENVINO_GENAI_EXPORTS MeanStdPair {
  * - Load time, ms
  * - Number of generated tokens
  * - Number of tokens in the input prompt
+ * - Number of chat history tokens reused from KV cache and recomputed
+ * - Timeline of loading sub-models of the pipeline
  *
  * Preverable way to access values is via get functions. Getters calculate mean and std values from raw_metrics are return pairs.
  * If mean and std were already calculated getters return cached values.
  * @param get_load_time Returns the load time in milliseconds.
+ * @param get_load_timeline Returns intervals of loading sub-models of the pipeline.
  * @param get_num_generated_tokens Returns the number of generated tokens.
  * @param get_num_input_tokens Returns the number of tokens in the input prompt.
+ * @param get_num_reused_history_tokens Returns the number of chat history tokens taken from KV cache.
+ * @param get_num_recomputed_history_tokens Returns the number of chat history tokens removed from KV cache to be recomputed.
  * @param get_ttft Returns the mean and standard deviation of TTFT.
  * @param get_tpot Returns the mean and standard deviation of TPOT.
  * @param get_throughput Returns the mean and standard deviation of throughput.
@@ -85,6 +105,7 @@ struct OPENVINO_GENAI_EXPORTS MeanStdPair {
  * @param operator+= Adds and assigns the right-hand PerfMetrics to the current object.
  * @param raw_metrics A structure of RawPerfMetrics type that holds raw metrics.
  * @param load_time Load time in milliseconds.
+ * @param load_timeline Intervals of loading sub-models of the pipeline, empty if the pipeline loads its models one by one.
  *
  * Cached mean and standard deviations.
  * @param ttft Mean and standard deviation of Time to the First Token (TTFT) in milliseconds.
@@ -95,9 +116,13 @@ struct OPENVINO_GENAI_EXPORTS MeanStdPair {
  * @param detokenization_duration Mean and standard deviation of the detokenization duration in milliseconds.
  * @param num_generated_tokens Number of generated tokens.
  * @param num_input_tokens Number of tokens in the input prompt.
+ * @param num_reused_history_tokens Number of tokens of chat history taken from KV cache instead of being inferred again.
+ * @param num_recomputed_history_tokens Number of tokens removed from KV cache, because the chat history re-rendered by
+ *        the chat template diverged from the cached tokens starting from them.
  */
 struct OPENVINO_GENAI_EXPORTS PerfMetrics {
     float load_time;   // Load time in ms.
+    std::vector<ModelLoadInterval> load_timeline;
     MeanStdPair ttft;  // Time to the first token (in ms) (TTFT).
     MeanStdPair tpot;  // Time (in ms) per output token (TPOT).
     MeanStdPair ipot;  // Inference time (in ms) per output token.
@@ -110,10 +135,15 @@ struct OPENVINO_GENAI_EXPORTS PerfMetrics {
 
     size_t num_generated_tokens;
     size_t num_input_tokens;
+    size_t num_reused_history_tokens = 0;
+    size_t num_recomputed_history_tokens = 0;
 
     float get_load_time();         // Load time in ms.
+    std::vector<ModelLoadInterval> get_load_timeline();
     size_t get_num_generated_tokens();
     size_t get_num_input_tokens();
+    size_t get_num_reused_history_tokens();
+    size_t get_num_recomputed_history_tokens();
     MeanStdPair get_ttft();         // Time to the first token (in ms) (TTFT).
     MeanStdPair get_tpot();         // Time (in ms) per output token (TPOT).
     MeanStdPair get_ipot();         // Inference time (in ms) per output token.
@@ -51,11 +51,28 @@ struct SchedulerConfig {
     // when a sequence has finished genegartion its cache is released.
     bool enable_prefix_caching = false;
 
+    // Whether to take predicted output lengths of running requests into account when admitting new prompts.
+    // Predictions are based on `max_new_tokens` and output length statistics of previously finished requests
+    // with the same prompt prefix. When turned on, new prompts wait until running requests are expected
+    // to fit into KV cache until they finish, which reduces the number of preemptions.
+    bool use_output_length_prediction = false;
+
+    // Whether to split prompts which do not fit into max_num_batched_tokens into chunks processed by several steps.
+    // When turned off, prompts longer than max_num_batched_tokens are not supported.
+    bool enable_chunked_prefill = false;
+
+    // Whether batches with prompt chunks must not contain generation tokens. When turned on, chunks of long prompts
+    // are interleaved with generation steps of running sequences, otherwise each batch is filled with generation tokens
+    // first and prompt chunks take the rest of max_num_batched_tokens. Has effect only if `enable_chunked_prefill` is `true`.
+    bool prompt_only_batches = true;
+
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               use_output_length_prediction == other.use_output_length_prediction &&
+               enable_chunked_prefill == other.enable_chunked_prefill && prompt_only_batches == other.prompt_only_batches;
     }
 };
 }
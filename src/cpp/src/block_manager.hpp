@@ -9,6 +9,9 @@
 #include <algorithm>
 #include <fstream>
 #include <chrono>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
 
 #include "sequence_group.hpp"
 
@@ -133,14 +136,22 @@ class OverwritableBlocksHashStore {
     /**
      * Pops the least recently used blocks from the store to be used and overwritten by another sequence.
      * Returned blocks will have reference counters equal to 1.
+     * @param is_kept If set, blocks with hashes for which it returns true are overwritten only if there are no other blocks.
      * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store
      * based on the timestamp.
      */
-    BlocksPerLayer get_lru_block_to_overwrite() {
+    BlocksPerLayer get_lru_block_to_overwrite(const std::function<bool(size_t)>& is_kept = nullptr) {
         if (m_blocks.empty()) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
+        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [&is_kept](const auto& lhs, const auto& rhs) -> bool {
+            if (is_kept) {
+                bool is_lhs_kept = is_kept(lhs.first), is_rhs_kept = is_kept(rhs.first);
+                if (is_lhs_kept != is_rhs_kept)
+                    return is_rhs_kept;
+            }
+            return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp();
+        });
         auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
         auto timestamp = std::chrono::system_clock::now();
         for (auto& block_ptr : blocks_for_all_layers) {
@@ -179,6 +190,41 @@ class OverwritableBlocksHashStore {
     }
 };
 
+/**
+ * @brief Hashes of prefix blocks cached in KV cache of one pipeline (the leader), shared with another pipeline processing
+ * the same requests (the follower), like main and draft models in speculative decoding. Both pipelines hash blocks
+ * by the same token prefixes, so the follower overwrites its blocks cached by the leader only if it has no other cached blocks.
+ * It only orders eviction of the follower: a prefix hit on the leader is not guaranteed to be a hit on the follower,
+ * which overwrites prefixes of the leader when its other blocks are taken (e.g. by candidates drafted ahead of the leader)
+ * and then prefills them on its own.
+ * Pipelines may run steps in different threads, so access is synchronized.
+ */
+class PrefixHashRegistry {
+    mutable std::mutex m_mutex;
+    std::unordered_set<size_t> m_hashes;
+public:
+    void add(size_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hashes.insert(hash);
+    }
+
+    void replace(size_t prev_hash, size_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hashes.erase(prev_hash);
+        m_hashes.insert(hash);
+    }
+
+    bool contains(size_t hash) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hashes.count(hash) > 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hashes.size();
+    }
+};
+
 class CacheStateDumper;
 
 /**
@@ -195,6 +241,8 @@ class BlockAllocator {
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
+    std::shared_ptr<PrefixHashRegistry> m_prefix_hash_registry;
+    bool m_is_prefix_hash_leader = false;
 
 public:
     /**
@@ -229,6 +277,28 @@ public:
         }
     }
 
+    /**
+     * Shares hashes of cached blocks with another pipeline, see PrefixHashRegistry.
+     * @param prefix_hash_registry The registry of hashes of blocks cached by the leader.
+     * @param is_leader Whether this allocator reports its hashes to the registry, or keeps blocks with hashes from the registry.
+     */
+    void set_prefix_hash_registry(std::shared_ptr<PrefixHashRegistry> prefix_hash_registry, bool is_leader) {
+        OPENVINO_ASSERT(m_enable_prefix_caching, "Prefix hashes can be shared only if prefix caching is enabled");
+        m_prefix_hash_registry = std::move(prefix_hash_registry);
+        m_is_prefix_hash_leader = is_leader;
+    }
+
+    /**
+     * Reports the change of hash of cached blocks, if they are shared with another pipeline.
+     * @param prev_hash The previous hash of the blocks.
+     * @param hash The new hash of the blocks.
+     */
+    void update_cached_hash(size_t prev_hash, size_t hash) {
+        if (m_prefix_hash_registry && m_is_prefix_hash_leader) {
+            m_prefix_hash_registry->replace(prev_hash, hash);
+        }
+    }
+
     void increase_kv_blocks_number(size_t new_kv_blocks_count) {
         OPENVINO_ASSERT(new_kv_blocks_count > m_total_num_blocks, "New blocks number should be more than previous blocks number.");
         size_t added_blocks = new_kv_blocks_count - m_total_num_blocks;
@@ -429,13 +499,21 @@ public:
                 m_free_blocks[i].pop_front();
                 --m_free_blocks_num[i];
             }
+            if (m_prefix_hash_registry && m_is_prefix_hash_leader) {
+                m_prefix_hash_registry->add(hash);
+            }
             cached_blocks[hash] = allocated_blocks;
             return allocated_blocks;
         }
         if (m_overwriteable_blocks.num_blocks() > 0) {
-            // get least recently used block from store and reuse it
-            BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
+            // get least recently used block from store and reuse it, a follower keeps blocks cached by the leader
+            std::function<bool(size_t)> is_kept;
+            if (m_prefix_hash_registry && !m_is_prefix_hash_leader) {
+                is_kept = [this](size_t cached_hash) { return m_prefix_hash_registry->contains(cached_hash); };
+            }
+            BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite(is_kept);
             cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
+            update_cached_hash(blocks_for_all_layers[0]->get_hash(), hash);
 
             // update block with new hash
             for (auto& block : blocks_for_all_layers) {
@@ -510,8 +588,6 @@ class BlockManager {
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
     std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
-
-    std::mutex m_cached_blocks_map_mutex;
 public:
     /**
      * Constructs the BlockManager.
@@ -533,6 +609,13 @@ public:
         OPENVINO_ASSERT(m_block_table.empty());
     }
 
+    /**
+     * Shares hashes of cached prefix blocks with another pipeline, see PrefixHashRegistry.
+     */
+    void set_prefix_hash_registry(std::shared_ptr<PrefixHashRegistry> prefix_hash_registry, bool is_leader) {
+        m_allocator.set_prefix_hash_registry(std::move(prefix_hash_registry), is_leader);
+    }
+
     /**
      * Gets the block table for a given sequence.
      * @param seq_id The identifier of an ov::genai::Sequence.
@@ -720,6 +803,7 @@ public:
                         last_blocks_vec.push_back(lst_blk);
                     }
                     m_prefix_hash_to_occupied_block_map[hash] = last_blocks_vec;
+                    m_allocator.update_cached_hash(prev_hash, hash);
                 }
             }
             for (size_t i = 0; i < num_blocks; ++i) {
@@ -958,6 +1042,10 @@ public:
                 }
                 else {
                     blocks_count += needed_blocks_per_sequence * references_count;
+                    // not completely filled block is also written when several tokens are appended at once
+                    if (_is_last_block_partially_filled(seq_group, num_physical_blocks)) {
+                        blocks_count += references_count - 1;
+                    }
                 }
             }
             else {
@@ -988,6 +1076,45 @@ public:
     }
 
 
+    bool _is_last_block_partially_filled(SequenceGroup::CPtr seq_group, size_t num_physical_blocks) const {
+        return seq_group->get_num_processed_tokens() < num_physical_blocks * m_block_size;
+    }
+
+    /**
+     * Replaces the last block of a sequence shared with other sequences by a new block.
+     * @param copy_blocks_map Map of blocks to be copied by CacheManager, the new block is registered there as a copy of the shared one.
+     */
+    void _copy_last_block_on_write(Sequence::Ptr sequence, std::map<size_t, std::list<size_t>>& copy_blocks_map) {
+        auto seq_id = sequence->get_id();
+        size_t effective_num_layers = m_block_table[seq_id].size();
+        size_t num_physical_blocks = m_block_table[seq_id][0].size();
+        BlocksPerLayer last_blocks;
+        last_blocks.reserve(effective_num_layers);
+        for (size_t i = 0; i < effective_num_layers; i++) {
+            last_blocks.push_back(m_block_table[seq_id][i].back());
+        }
+
+        BlocksPerLayer new_blocks_for_all_layers;
+        new_blocks_for_all_layers.reserve(effective_num_layers);
+        if (m_enable_prefix_caching) {
+            auto hash = sequence->get_hash();
+            new_blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
+        } else {
+            for (size_t i = 0; i < effective_num_layers; i++) {
+                new_blocks_for_all_layers.push_back(m_allocator.allocate_block(i));
+            }
+        }
+
+        for (size_t i = 0; i < effective_num_layers; i++) {
+            auto& new_block = new_blocks_for_all_layers[i];
+            auto& block_table = m_block_table[seq_id][i];
+            block_table[num_physical_blocks - 1] = new_blocks_for_all_layers[i];
+            auto& last_block = last_blocks[i];
+            copy_blocks_map[last_block->get_index()].push_back(new_block->get_index());
+        }
+        m_allocator.free(last_blocks);
+    }
+
     /**
      * Allocates just enough physical KV cache blocks to a sequence group to be enough for the sequences in it. If the sequences
      * in the group were forked before and their last block is a copy-on-write, then the block contents will have to be copied separately
@@ -1014,6 +1141,12 @@ public:
             }
 
             if (num_logical_blocks > num_physical_blocks) {
+                // a sequence forked at a partially filled block appends several tokens at once (e.g. a branch of tree speculation),
+                // so the shared block is written and has to be copied before new blocks are allocated
+                if (num_physical_blocks > 0 && _is_last_block_partially_filled(seq_group, num_physical_blocks) &&
+                    m_block_table[seq_id][0].back()->copy_on_write()) {
+                    _copy_last_block_on_write(sequence, copy_blocks_map);
+                }
                 OPENVINO_ASSERT(can_allocate_blocks(num_logical_blocks - num_physical_blocks));
                 allocate(sequence, num_logical_blocks - num_physical_blocks, seq_group->get_prompt_len());
             } else {
@@ -1029,25 +1162,7 @@ public:
                 bool is_copy_on_write = last_blocks[0]->copy_on_write();
 
                 if (is_copy_on_write) {
-                    BlocksPerLayer new_blocks_for_all_layers;
-                    new_blocks_for_all_layers.reserve(effective_num_layers);
-                    if (m_enable_prefix_caching) {
-                        auto hash = sequence->get_hash();
-                        new_blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
-                    } else {
-                        for (size_t i = 0; i < effective_num_layers; i++) {
-                            new_blocks_for_all_layers.push_back(m_allocator.allocate_block(i));
-                        }
-                    }
-
-                    for (size_t i = 0; i < effective_num_layers; i++) {
-                        auto& new_block = new_blocks_for_all_layers[i];
-                        auto& block_table = m_block_table[seq_id][i];
-                        block_table[num_physical_blocks - 1] = new_blocks_for_all_layers[i];
-                        auto& last_block = last_blocks[i];
-                        copy_blocks_map[last_block->get_index()].push_back(new_block->get_index());
-                    }
-                    m_allocator.free(last_blocks);
+                    _copy_last_block_on_write(sequence, copy_blocks_map);
                 } else {
                     // we are the only users of this block
                     if (m_enable_prefix_caching) {
@@ -1060,6 +1175,7 @@ public:
                         }
                         m_prefix_hash_to_occupied_block_map.erase(prev_hash);
                         m_prefix_hash_to_occupied_block_map[hash] = last_blocks;
+                        m_allocator.update_cached_hash(prev_hash, hash);
                     }
                 }
             }
@@ -1069,10 +1185,8 @@ public:
         return copy_blocks_map;
     }
 
+    // not synchronized: must be called from the thread executing pipeline steps, which owns prefix cache
     void restore_cached_blocks(SequenceGroup::Ptr group) {
-        // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
-        // The mutex is needed to prevent such segfaults.
-        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
         auto prompt_ids = group->get_prompt_ids();
         auto sequences = group->get_not_finished_sequences();
         OPENVINO_ASSERT(sequences.size() == 1);
@@ -237,6 +237,20 @@ public:
         }
     }
 
+    /**
+     * Frees KV cache memory. Cache tensors of the infer request are replaced with empty ones, so the memory is not referenced anymore.
+     */
+    void release_cache() {
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_key_cache.size(); ++decoder_layer_id) {
+            m_key_cache[decoder_layer_id] = ov::Tensor(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], 0));
+            m_value_cache[decoder_layer_id] = ov::Tensor(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], 0));
+            update_request_tensor(decoder_layer_id);
+        }
+        m_key_cache.clear();
+        m_value_cache.clear();
+        m_num_allocated_kv_blocks = 0;
+    }
+
     ov::Tensor get_key_cache(size_t decoder_layer_id) const {
         OPENVINO_ASSERT(decoder_layer_id < m_key_cache.size(), "decoder_layer_id = ", decoder_layer_id, ", num_layers = ", m_key_cache.size());
         return m_key_cache[decoder_layer_id];
@@ -0,0 +1,229 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "lm_encoding.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Host-side copy of a variable state of a stateful model.
+ * If compressed, floating point state is quantized to u8 per row of its last dimension (head size for KV cache),
+ * which makes f32 states 4x and f16 states 2x smaller at the cost of approximate values after restoring.
+ */
+class KVStateSnapshot {
+    std::string m_name;
+    ov::element::Type m_element_type;
+    ov::Shape m_shape;
+    // copy of the state or u8 codes if `m_scales` are set
+    ov::Tensor m_data;
+    // f32 per row of the last dimension: value = code * scale + min
+    ov::Tensor m_scales, m_mins;
+
+    template <typename T>
+    void quantize(const ov::Tensor& state) {
+        const size_t row_size = m_shape.empty() ? 1 : m_shape.back();
+        const size_t num_rows = row_size == 0 ? 0 : state.get_size() / row_size;
+        m_data = ov::Tensor(ov::element::u8, m_shape);
+        m_scales = ov::Tensor(ov::element::f32, {num_rows});
+        m_mins = ov::Tensor(ov::element::f32, {num_rows});
+
+        const T* values = state.data<const T>();
+        uint8_t* codes = m_data.data<uint8_t>();
+        for (size_t row = 0; row < num_rows; ++row, values += row_size, codes += row_size) {
+            float min = static_cast<float>(values[0]), max = min;
+            for (size_t i = 1; i < row_size; ++i) {
+                min = std::min(min, static_cast<float>(values[i]));
+                max = std::max(max, static_cast<float>(values[i]));
+            }
+            const float scale = (max - min) / 255.f;
+            for (size_t i = 0; i < row_size; ++i) {
+                codes[i] = scale > 0.f ? static_cast<uint8_t>(std::lround((static_cast<float>(values[i]) - min) / scale)) : 0;
+            }
+            m_scales.data<float>()[row] = scale;
+            m_mins.data<float>()[row] = min;
+        }
+    }
+
+    template <typename T>
+    ov::Tensor dequantize() const {
+        ov::Tensor state(m_element_type, m_shape);
+        const size_t row_size = m_shape.empty() ? 1 : m_shape.back();
+        const uint8_t* codes = m_data.data<const uint8_t>();
+        T* values = state.data<T>();
+        for (size_t row = 0; row < m_scales.get_size(); ++row, values += row_size, codes += row_size) {
+            const float scale = m_scales.data<const float>()[row], min = m_mins.data<const float>()[row];
+            for (size_t i = 0; i < row_size; ++i) {
+                values[i] = static_cast<T>(codes[i] * scale + min);
+            }
+        }
+        return state;
+    }
+
+public:
+    KVStateSnapshot(const std::string& name, const ov::Tensor& state, bool compress) :
+        m_name(name),
+        m_element_type(state.get_element_type()),
+        m_shape(state.get_shape()) {
+        if (compress && m_element_type == ov::element::f32) {
+            quantize<float>(state);
+        } else if (compress && m_element_type == ov::element::f16) {
+            quantize<ov::float16>(state);
+        } else if (compress && m_element_type == ov::element::bf16) {
+            quantize<ov::bfloat16>(state);
+        } else {
+            // states of other types, e.g. already quantized by a plugin, are copied as is
+            m_data = ov::Tensor(m_element_type, m_shape);
+            state.copy_to(m_data);
+        }
+    }
+
+    const std::string& get_name() const {
+        return m_name;
+    }
+
+    bool is_compressed() const {
+        return static_cast<bool>(m_scales);
+    }
+
+    size_t get_byte_size() const {
+        return m_data.get_byte_size() + (is_compressed() ? m_scales.get_byte_size() + m_mins.get_byte_size() : 0);
+    }
+
+    // returns the state in its original precision
+    ov::Tensor restore() const {
+        if (!is_compressed()) {
+            return m_data;
+        }
+        if (m_element_type == ov::element::f32) {
+            return dequantize<float>();
+        } else if (m_element_type == ov::element::f16) {
+            return dequantize<ov::float16>();
+        }
+        return dequantize<ov::bfloat16>();
+    }
+};
+
+/**
+ * @brief Chat of the stateful pipeline saved to be continued later: its history and KV cache of the model.
+ */
+struct ChatSession {
+    std::vector<KVStateSnapshot> kv_states;
+    ov::Tensor attention_mask;
+    ChatHistory history;
+    std::vector<int64_t> tokenized_chat_history;
+    // tokens contained in KV cache
+    KVCacheState kv_cache_state;
+    utils::GenerationChatInputsType chat_input_type = utils::GenerationChatInputsType::UNDEF;
+    KVCacheTrimManager kv_history_trim_manager;
+    GenerationStatus chat_generation_finish_status = GenerationStatus::RUNNING;
+
+    size_t get_byte_size() const {
+        size_t byte_size = attention_mask ? attention_mask.get_byte_size() : 0;
+        for (const auto& kv_state : kv_states) {
+            byte_size += kv_state.get_byte_size();
+        }
+        const size_t num_tokens = tokenized_chat_history.size() + kv_cache_state.get_state().size() + kv_cache_state.get_evicted_tokens().size();
+        return byte_size + num_tokens * sizeof(int64_t);
+    }
+};
+
+// copies variable states of the model except for LoRA adapters' ones
+inline std::vector<KVStateSnapshot> snapshot_kv_states(ov::InferRequest& request, bool compress, std::optional<AdapterController> adapter_controller) {
+    std::vector<KVStateSnapshot> kv_states;
+    for (auto& state : request.query_state()) {
+        if (adapter_controller && adapter_controller->has_state_name(state.get_name()))
+            continue;
+        kv_states.emplace_back(state.get_name(), state.get_state(), compress);
+    }
+    return kv_states;
+}
+
+inline void restore_kv_states(ov::InferRequest& request, const std::vector<KVStateSnapshot>& kv_states) {
+    std::unordered_map<std::string, const KVStateSnapshot*> kv_states_by_name;
+    for (const auto& kv_state : kv_states) {
+        kv_states_by_name.emplace(kv_state.get_name(), &kv_state);
+    }
+    for (auto& state : request.query_state()) {
+        auto it = kv_states_by_name.find(state.get_name());
+        if (it != kv_states_by_name.end()) {
+            state.set_state(it->second->restore());
+        }
+    }
+}
+
+/**
+ * @brief LRU cache of chat sessions: saving a session over the capacity evicts the least recently saved one,
+ * so the evicted chat has to be started over.
+ */
+class ChatSessionStore {
+    size_t m_capacity;
+    // the most recently saved sessions first
+    std::list<std::pair<std::string, ChatSession>> m_sessions;
+    std::unordered_map<std::string, std::list<std::pair<std::string, ChatSession>>::iterator> m_session_its;
+
+public:
+    explicit ChatSessionStore(size_t capacity = 16) :
+        m_capacity(capacity) {}
+
+    size_t size() const {
+        return m_sessions.size();
+    }
+
+    size_t get_byte_size() const {
+        size_t byte_size = 0;
+        for (const auto& session : m_sessions) {
+            byte_size += session.second.get_byte_size();
+        }
+        return byte_size;
+    }
+
+    bool contains(const std::string& session_id) const {
+        return m_session_its.count(session_id) > 0;
+    }
+
+    void put(const std::string& session_id, ChatSession session) {
+        take(session_id);
+        if (m_capacity == 0) {
+            return;
+        }
+        m_sessions.emplace_front(session_id, std::move(session));
+        m_session_its[session_id] = m_sessions.begin();
+        if (m_sessions.size() > m_capacity) {
+            m_session_its.erase(m_sessions.back().first);
+            m_sessions.pop_back();
+        }
+    }
+
+    // removes the session from the store: it's continued by the pipeline and has to be saved again
+    std::optional<ChatSession> take(const std::string& session_id) {
+        auto it = m_session_its.find(session_id);
+        if (it == m_session_its.end()) {
+            return std::nullopt;
+        }
+        ChatSession session = std::move(it->second->second);
+        m_sessions.erase(it->second);
+        m_session_its.erase(it);
+        return session;
+    }
+
+    void clear() {
+        m_sessions.clear();
+        m_session_its.clear();
+    }
+};
+
+}
@@ -8,6 +8,7 @@
 #include "continuous_batching_impl.hpp"
 #include "utils.hpp"
 #include "paged_attention_transformations.hpp"
+#include "model_registry.hpp"
 #include "lora_helper.hpp"
 #include "cache_state_dumper.hpp"
 #include "utils.hpp"
@@ -136,8 +137,18 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_take_incoming_requests() {
+    SequenceGroup::Ptr sequence_group;
+    while (m_incoming_requests.try_pop(sequence_group)) {
+        // prefix restoration is deferred from add_request, so only the step thread accesses prefix cache
+        if (m_scheduler->get_config().enable_prefix_caching)
+            m_scheduler->restore_cached_blocks(sequence_group);
+        m_awaiting_requests.push_back(std::move(sequence_group));
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    _take_incoming_requests();
     m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
     m_awaiting_requests.clear();
     m_pipeline_metrics.requests = m_requests.size();
@@ -162,11 +173,32 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract shared KV block pool if exists and remove it from properties
+    std::optional<KVBlockPoolShare> kv_block_pool_share;
+    auto kv_block_pool_it = filtered_properties->find(utils::KV_BLOCK_POOL_ARG_NAME);
+    if (kv_block_pool_it != filtered_properties->end()) {
+        kv_block_pool_share = kv_block_pool_it->second.as<KVBlockPoolShare>();
+        filtered_properties.fork().erase(utils::KV_BLOCK_POOL_ARG_NAME);
+    }
+
+    // Extract share_models property if exists and remove it from properties
+    bool share_models = false;
+    auto share_models_it = filtered_properties->find(ov::genai::share_models.name());
+    if (share_models_it != filtered_properties->end()) {
+        share_models = share_models_it->second.as<bool>();
+        filtered_properties.fork().erase(ov::genai::share_models.name());
+    }
 
     // TODO: remove once plugin automatically set KV cache precisions
     apply_kv_cache_precision(model, device, *filtered_properties);
 
-    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
+    ov::CompiledModel compiled_model;
+    if (share_models) {
+        m_shared_compiled_model = utils::ModelRegistry::get().compile_model(model, device, *filtered_properties);
+        compiled_model = *m_shared_compiled_model;
+    } else {
+        compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
+    }
 
     ov::genai::utils::print_compiled_model_properties(compiled_model, "LLM with Paged Attention");
     ov::InferRequest infer_request = compiled_model.create_infer_request();
@@ -191,6 +223,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     }
 
     m_scheduler = std::make_shared<Scheduler>(m_block_size, cache_manager, normalized_config, m_num_decoder_layers, can_use_partial_preemption);
+    if (kv_block_pool_share.has_value()) {
+        m_scheduler->set_kv_block_pool(kv_block_pool_share->pool, kv_block_pool_share->quota);
+    }
 
     // Model Runner
     bool is_use_cache_eviction = m_scheduler->get_config().use_cache_eviction;
@@ -263,19 +298,13 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
 
     SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size);
 
-    if (m_scheduler->get_config().enable_prefix_caching) {
-        if (m_model_input_type == ModelInputType::EMBEDDINGS) {
-            OPENVINO_THROW("Prefix caching is not supported for VLM models.");
-        }
-        m_scheduler->restore_cached_blocks(sequence_group);
-    }
-
-    {
-        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-        m_awaiting_requests.push_back(sequence_group);
+    if (m_scheduler->get_config().enable_prefix_caching && m_model_input_type == ModelInputType::EMBEDDINGS) {
+        OPENVINO_THROW("Prefix caching is not supported for VLM models.");
     }
 
-    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
+    GenerationHandle handle = std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
+    m_incoming_requests.push(std::move(sequence_group));
+    return handle;
 };
 
 GenerationHandle
@@ -300,8 +329,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
 }
 
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    return !m_awaiting_requests.empty() || !m_requests.empty();
+    return !m_incoming_requests.empty() || !m_awaiting_requests.empty() || !m_requests.empty();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
@@ -310,6 +338,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     _pull_awaiting_requests();
 
+    // other pipelines sharing KV block pool can't take blocks within their quotas, give them the borrowed blocks
+    if (m_scheduler->must_return_kv_blocks())
+        m_scheduler->return_kv_blocks(m_requests);
+
     Scheduler::Output scheduler_output;
 
     {
@@ -323,6 +355,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
         m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+        m_pipeline_metrics.num_preemptions = m_scheduler->get_num_preemptions();
 
         const auto& sched_config = m_scheduler->get_config();
         if (sched_config.use_cache_eviction && sched_config.cache_eviction_config.apply_rotation) {
@@ -333,6 +366,13 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     }
 
+    // if no tokens were scheduled because other pipelines hold blocks of the shared KV block pool, wait until they return blocks;
+    // the wait is bounded to let the caller process new and cancelled requests
+    if (scheduler_output.m_total_num_scheduled_tokens == 0 && m_scheduler->is_waiting_for_kv_blocks()) {
+        m_scheduler->wait_for_kv_blocks(std::chrono::milliseconds(100));
+        return;
+    }
+
     // if no tokens were scheduled, we are out of memory => free all requests and return
     if (scheduler_output.m_total_num_scheduled_tokens == 0) {
         for (size_t i = 0; i < m_requests.size(); ++i) {
@@ -415,6 +455,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         static ManualTimer clean_up_requests_timer("free non running requests");
         clean_up_requests_timer.start();
         _free_non_running_requests();
+        // nothing to process, let other pipelines sharing KV block pool use the memory
+        if (m_requests.empty())
+            m_scheduler->release_kv_blocks();
         clean_up_requests_timer.end();
     }
 
@@ -460,6 +503,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
         generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
     }
+    _take_incoming_requests();
     auto all_requests = m_awaiting_requests; // we need to store all requests to get results from them once generation has finished
 
     GenerationHandle& generation = generations.at(0);
@@ -540,6 +584,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
+            // collect output length statistics of naturally finished requests only
+            if (request->get_generation_stream()->get_status() == GenerationStatus::FINISHED)
+                m_scheduler->get_output_length_predictor()->register_finished(request);
             for (const auto& sequence: request->get_sequences()) {
                 if (m_scheduler->has_block_table(sequence->get_id())) {
                     m_scheduler->free_sequence(sequence->get_id());
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "icontinuous_batching.hpp"
+#include "mpsc_queue.hpp"
 
 #include "openvino/genai/lora_adapter.hpp"
 #include "cache_eviction.hpp"
@@ -13,6 +14,8 @@ namespace ov::genai {
 
 class ContinuousBatchingPipeline::ContinuousBatchingImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
 protected:
+    // set if `share_models` property is passed: keeps the compiled model shared with other pipelines alive
+    std::shared_ptr<ov::CompiledModel> m_shared_compiled_model;
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::optional<AdapterController> m_adapter_controller;
@@ -20,10 +23,10 @@ protected:
 
     // current requests to process
     std::vector<SequenceGroup::Ptr> m_requests;
-    // requests added to the pipeline that will be added to m_requests in the next iteration
+    // requests added to the pipeline, so add_request and step methods can be called from different threads without locking
+    MPSCQueue<SequenceGroup::Ptr> m_incoming_requests;
+    // requests taken from m_incoming_requests by the step thread that will be added to m_requests in the next iteration
     std::vector<SequenceGroup::Ptr> m_awaiting_requests;
-    // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
-    std::mutex m_awaiting_requests_mutex;
 
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
@@ -65,6 +68,12 @@ protected:
                              const ov::AnyMap& plugin_config,
                              const std::vector<KVHeadConfig>& kv_cache_config);
 
+    /**
+     * Moves requests added by add_request to awaiting queue and restores their prefixes from prefix cache.
+     * Must be called from the thread executing steps, as prefix cache is owned by it
+     */
+    void _take_incoming_requests();
+
     /**
      * Pulls requests from awaiting queue to running queue
      * Should be called within each call of step()
@@ -139,5 +148,12 @@ public:
      * Updates LoRA adapters for current generation call
      */
     void set_adapters(const std::optional<AdapterConfig>& adapters);
+
+    /**
+     * @return Size of KV cache block in tokens, defined by the device.
+     */
+    size_t get_block_size() const {
+        return m_block_size;
+    }
 };
 } // namespace ov::genai
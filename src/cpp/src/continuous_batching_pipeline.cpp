@@ -12,6 +12,9 @@
 #include "continuous_batching_impl.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "prompt_lookup/prompt_lookup_impl.hpp"
+#include "data_parallel/data_parallel_impl.hpp"
+#include "stateful_batching/stateful_batching_impl.hpp"
+#include "model_registry.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
 #include "debug_utils.hpp"
@@ -39,6 +42,57 @@ extract_prompt_lookup_from_config(ov::AnyMap& config) {
     return res;
 }
 
+inline size_t
+extract_data_parallel_replicas_from_config(ov::AnyMap& config) {
+    size_t res = 1;
+    if (config.find(ov::genai::data_parallel_replicas.name()) != config.end()) {
+        res = config.at(ov::genai::data_parallel_replicas.name()).as<size_t>();
+        config.erase(ov::genai::data_parallel_replicas.name());
+    }
+    return res;
+}
+
+inline size_t
+extract_stateful_batch_size_from_config(ov::AnyMap& config) {
+    size_t res = 0;
+    if (config.find(ov::genai::stateful_batch_size.name()) != config.end()) {
+        res = config.at(ov::genai::stateful_batch_size.name()).as<size_t>();
+        config.erase(ov::genai::stateful_batch_size.name());
+    }
+    return res;
+}
+
+inline size_t
+extract_self_speculative_draft_layers_from_config(ov::AnyMap& config) {
+    size_t res = 0;
+    if (config.find(ov::genai::self_speculative_draft_layers.name()) != config.end()) {
+        res = config.at(ov::genai::self_speculative_draft_layers.name()).as<size_t>();
+        config.erase(ov::genai::self_speculative_draft_layers.name());
+    }
+    return res;
+}
+
+// models of the inputs embedder aren't shared, and it passes properties to plugins as is
+inline ov::AnyMap
+get_inputs_embedder_properties(const ov::AnyMap& config) {
+    ov::AnyMap res = config;
+    res.erase(ov::genai::share_models.name());
+    return res;
+}
+
+// draft model of self-speculative decoding is a copy of the main model sharing its weights, which exits after the first decoder layers
+inline ov::genai::ModelDesc
+create_self_speculative_draft_model_desc(const std::shared_ptr<ov::Model>& model,
+                                         const ov::genai::Tokenizer& tokenizer,
+                                         const std::string& device,
+                                         const ov::AnyMap& properties,
+                                         const ov::genai::GenerationConfig& generation_config,
+                                         size_t num_draft_layers) {
+    ov::genai::ModelDesc draft_model_desc(model->clone(), tokenizer, device, properties, {}, generation_config);
+    draft_model_desc.num_early_exit_layers = num_draft_layers;
+    return draft_model_desc;
+}
+
 inline float get_load_time(std::chrono::steady_clock::time_point start_time) {
     auto stop_time = std::chrono::steady_clock::now();
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -54,6 +108,9 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
+    auto stateful_batch_size = extract_stateful_batch_size_from_config(properties_without_draft_model);
 
     std::filesystem::path model_path = models_path;
     std::filesystem::path directory = models_path;
@@ -67,18 +124,35 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
         OPENVINO_THROW("Could not find a model in the directory.");
     }
 
-    auto model = utils::singleton_core().read_model(model_path, {}, properties);
+    auto model = utils::read_model(model_path, properties);
     auto tokenizer = ov::genai::Tokenizer(directory, tokenizer_properties);
     auto generation_config = utils::from_config_json_if_exists(directory);
 
-    if (is_prompt_lookup_enabled) {
+    if (num_self_speculative_draft_layers > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr, "draft_model and self_speculative_draft_layers properties are mutually exclusive");
+        draft_model_desr = create_self_speculative_draft_model_desc(model, tokenizer, device, properties_without_draft_model,
+                                                                    generation_config, num_self_speculative_draft_layers);
+    }
+    if (stateful_batch_size > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled && num_data_parallel_replicas == 1,
+                        "Stateful batching is not supported with speculative decoding, prompt lookup decoding and data-parallel replicas");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Stateful batching is not supported for visual language models");
+        m_impl = std::make_shared<StatefulBatchingImpl>(model, tokenizer, device, properties_without_draft_model, generation_config, stateful_batch_size);
+    } else if (num_data_parallel_replicas != 1) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled,
+                        "Data-parallel replicas are not supported with speculative decoding and prompt lookup decoding");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Data-parallel replicas are not supported for visual language models");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, num_data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
     } else if (std::filesystem::exists(directory / "openvino_text_embeddings_model.xml") ) {
-        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, properties);
+        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, get_inputs_embedder_properties(properties));
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, inputs_embedder, tokenizer, scheduler_config, device, properties, generation_config);
     }
     else {
@@ -99,6 +173,9 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
+    auto stateful_batch_size = extract_stateful_batch_size_from_config(properties_without_draft_model);
     std::filesystem::path model_path = models_path;
     std::filesystem::path directory = models_path;
     if (std::filesystem::exists(model_path / "openvino_model.xml")) {
@@ -110,17 +187,34 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     else {
         OPENVINO_THROW("Could not find a model in the directory.");
     }
-    auto model = utils::singleton_core().read_model(model_path, {}, properties_without_draft_model);
+    auto model = utils::read_model(model_path, properties_without_draft_model);
     auto generation_config = utils::from_config_json_if_exists(directory);
 
-    if (is_prompt_lookup_enabled) {
+    if (num_self_speculative_draft_layers > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr, "draft_model and self_speculative_draft_layers properties are mutually exclusive");
+        draft_model_desr = create_self_speculative_draft_model_desc(model, tokenizer, device, properties_without_draft_model,
+                                                                    generation_config, num_self_speculative_draft_layers);
+    }
+    if (stateful_batch_size > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled && num_data_parallel_replicas == 1,
+                        "Stateful batching is not supported with speculative decoding, prompt lookup decoding and data-parallel replicas");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Stateful batching is not supported for visual language models");
+        m_impl = std::make_shared<StatefulBatchingImpl>(model, tokenizer, device, properties_without_draft_model, generation_config, stateful_batch_size);
+    } else if (num_data_parallel_replicas != 1) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled,
+                        "Data-parallel replicas are not supported with speculative decoding and prompt lookup decoding");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Data-parallel replicas are not supported for visual language models");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, num_data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
     } else if (std::filesystem::exists(directory / "openvino_text_embeddings_model.xml") ) {
-        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, properties);
+        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, get_inputs_embedder_properties(properties));
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, inputs_embedder, tokenizer, scheduler_config, device, properties, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
@@ -142,6 +236,9 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
+    auto stateful_batch_size = extract_stateful_batch_size_from_config(properties_without_draft_model);
     auto model = utils::singleton_core().read_model(model_str, weights_tensor);
     auto rt_info = model->get_rt_info();
     std::filesystem::path directory = "";
@@ -149,14 +246,31 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         std::string weights_path = rt_info.at("__weights_path").as<std::string>();
         directory = std::filesystem::path(weights_path).parent_path();
     }
-    if (is_prompt_lookup_enabled) {
+    if (num_self_speculative_draft_layers > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr, "draft_model and self_speculative_draft_layers properties are mutually exclusive");
+        draft_model_desr = create_self_speculative_draft_model_desc(model, tokenizer, device, properties_without_draft_model,
+                                                                    generation_config, num_self_speculative_draft_layers);
+    }
+    if (stateful_batch_size > 0) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled && num_data_parallel_replicas == 1,
+                        "Stateful batching is not supported with speculative decoding, prompt lookup decoding and data-parallel replicas");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Stateful batching is not supported for visual language models");
+        m_impl = std::make_shared<StatefulBatchingImpl>(model, tokenizer, device, properties_without_draft_model, generation_config, stateful_batch_size);
+    } else if (num_data_parallel_replicas != 1) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled,
+                        "Data-parallel replicas are not supported with speculative decoding and prompt lookup decoding");
+        OPENVINO_ASSERT(!std::filesystem::exists(directory / "openvino_text_embeddings_model.xml"),
+                        "Data-parallel replicas are not supported for visual language models");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, num_data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
     } else if (std::filesystem::exists(directory / "openvino_text_embeddings_model.xml")) {
-        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, properties);
+        auto inputs_embedder = std::make_shared<InputsEmbedder>(directory, device, get_inputs_embedder_properties(properties));
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, inputs_embedder, tokenizer, scheduler_config, device, properties, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
@@ -206,6 +320,7 @@ std::vector<EncodedGenerationResult> ContinuousBatchingPipeline::generate(const
 
     for (auto& encoded_result : encoded_results) {
         encoded_result.perf_metrics.load_time = m_impl->m_load_time_ms;
+        encoded_result.perf_metrics.load_timeline = m_impl->m_load_timeline;
     }
 
     return encoded_results;
@@ -216,6 +331,7 @@ std::vector<GenerationResult> ContinuousBatchingPipeline::generate(const std::ve
 
     for (auto& decoded_result : decoded_results) {
         decoded_result.perf_metrics.load_time = m_impl->m_load_time_ms;
+        decoded_result.perf_metrics.load_timeline = m_impl->m_load_timeline;
     }
 
     return decoded_results;
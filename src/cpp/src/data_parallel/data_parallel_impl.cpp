@@ -0,0 +1,215 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <future>
+
+#include "data_parallel/data_parallel_impl.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+ContinuousBatchingPipeline::DataParallelImpl::DataParallelImpl(const std::shared_ptr<ov::Model>& model,
+                                                               const Tokenizer& tokenizer,
+                                                               const SchedulerConfig& scheduler_config,
+                                                               const std::string& device,
+                                                               const ov::AnyMap& properties,
+                                                               const ov::genai::GenerationConfig& generation_config,
+                                                               size_t num_replicas) :
+    m_numa_nodes_cpus(utils::get_numa_nodes_cpus()) {
+    m_tokenizer = tokenizer;
+    m_generation_config = generation_config;
+
+    if (num_replicas == 0)
+        num_replicas = m_numa_nodes_cpus.size();
+    const bool bind_to_numa_nodes = device.find("CPU") != std::string::npos;
+
+    // paged attention transformations are applied to the model in place, so each replica needs its own copy
+    // copies are made before any replica starts compilation; weights constants are shared between copies
+    std::vector<std::shared_ptr<ov::Model>> replica_models(num_replicas, model);
+    for (size_t replica_id = 1; replica_id < num_replicas; ++replica_id)
+        replica_models[replica_id] = model->clone();
+
+    m_replicas.resize(num_replicas);
+    std::vector<std::future<std::shared_ptr<ContinuousBatchingImpl>>> replica_futures;
+    for (size_t replica_id = 0; replica_id < num_replicas; ++replica_id) {
+        Replica& replica = m_replicas[replica_id];
+        replica.worker = std::make_unique<ThreadPool>(1);
+
+        const std::vector<size_t>& cpus = m_numa_nodes_cpus[replica_id % m_numa_nodes_cpus.size()];
+        ov::AnyMap replica_properties = properties;
+        if (bind_to_numa_nodes && !cpus.empty()) {
+            // replicas sharing a NUMA node split its CPUs
+            size_t num_replicas_per_node = (num_replicas + m_numa_nodes_cpus.size() - 1) / m_numa_nodes_cpus.size();
+            size_t num_threads = std::max<size_t>(cpus.size() / num_replicas_per_node, 1);
+            if (replica_properties.find(ov::inference_num_threads.name()) == replica_properties.end())
+                replica_properties[ov::inference_num_threads.name()] = static_cast<int32_t>(num_threads);
+            replica.worker->submit([cpus] { utils::set_current_thread_affinity(cpus); }).wait();
+        }
+
+        std::shared_ptr<ov::Model> replica_model = replica_models[replica_id];
+        // replicas are compiled in parallel, each on the thread bound to its node
+        replica_futures.push_back(replica.worker->submit([=] {
+            return std::make_shared<ContinuousBatchingImpl>(replica_model, tokenizer, scheduler_config, device, replica_properties, generation_config);
+        }));
+    }
+
+    for (size_t replica_id = 0; replica_id < num_replicas; ++replica_id) {
+        m_replicas[replica_id].pipeline = replica_futures[replica_id].get();
+    }
+
+    // KV cache block size depends on the device, so prefixes are tracked with the block size of the compiled replicas
+    m_router.emplace(num_replicas, m_replicas.front().pipeline->get_block_size());
+}
+
+size_t ContinuousBatchingPipeline::DataParallelImpl::get_num_replicas() const {
+    return m_replicas.size();
+}
+
+std::vector<size_t> ContinuousBatchingPipeline::DataParallelImpl::_get_replica_loads() {
+    std::vector<size_t> loads;
+    loads.reserve(m_replicas.size());
+    for (auto& replica : m_replicas) {
+        replica.handles.remove_if([] (const std::weak_ptr<GenerationHandleImpl>& weak_handle) {
+            auto handle = weak_handle.lock();
+            return !handle || handle->get_status() != GenerationStatus::RUNNING;
+        });
+        loads.push_back(replica.handles.size());
+    }
+    return loads;
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::DataParallelImpl::add_request(uint64_t request_id,
+                                                          const ov::Tensor& input_ids,
+                                                          ov::genai::GenerationConfig sampling_params) {
+    std::lock_guard<std::mutex> lock{m_routing_mutex};
+    size_t replica_id = m_router->route(input_ids, _get_replica_loads());
+    Replica& replica = m_replicas[replica_id];
+    GenerationHandle handle = replica.pipeline->add_request(request_id, input_ids, sampling_params);
+    replica.handles.push_back(handle);
+    return handle;
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::DataParallelImpl::add_request(uint64_t request_id,
+                                                          const std::string& prompt,
+                                                          ov::genai::GenerationConfig sampling_params) {
+    static ManualTimer timer("tokenize");
+    timer.start();
+    ov::Tensor input_ids = m_tokenizer.encode(prompt).input_ids;
+    timer.end();
+    return add_request(request_id, input_ids, sampling_params);
+}
+
+bool ContinuousBatchingPipeline::DataParallelImpl::has_non_finished_requests() {
+    for (auto& replica : m_replicas) {
+        if (replica.pipeline->has_non_finished_requests())
+            return true;
+    }
+    return false;
+}
+
+void ContinuousBatchingPipeline::DataParallelImpl::step() {
+    std::vector<std::future<void>> step_futures;
+    for (auto& replica : m_replicas) {
+        if (replica.pipeline->has_non_finished_requests()) {
+            auto pipeline = replica.pipeline;
+            step_futures.push_back(replica.worker->submit([pipeline] { pipeline->step(); }));
+        }
+    }
+
+    // wait for all replicas before rethrowing an exception of any of them
+    std::exception_ptr exception;
+    for (auto& step_future : step_futures) {
+        try {
+            step_future.get();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    _update_pipeline_metrics();
+}
+
+void ContinuousBatchingPipeline::DataParallelImpl::_update_pipeline_metrics() {
+    PipelineMetrics metrics;
+    for (auto& replica : m_replicas) {
+        PipelineMetrics replica_metrics = replica.pipeline->get_metrics();
+        metrics.requests += replica_metrics.requests;
+        metrics.scheduled_requests += replica_metrics.scheduled_requests;
+        metrics.cache_usage += replica_metrics.cache_usage / m_replicas.size();
+        metrics.avg_cache_usage += replica_metrics.avg_cache_usage / m_replicas.size();
+        metrics.max_cache_usage = std::max(metrics.max_cache_usage, replica_metrics.max_cache_usage);
+        metrics.num_preemptions += replica_metrics.num_preemptions;
+    }
+    m_pipeline_metrics = metrics;
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::DataParallelImpl::generate(const std::vector<ov::Tensor>& input_ids,
+                                                       const std::vector<GenerationConfig>& sampling_params,
+                                                       const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
+    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    // replicas generate their parts of the batch concurrently, while a streamer can't be shared between them
+    OPENVINO_ASSERT(std::holds_alternative<std::monostate>(streamer) || input_ids.size() == 1,
+        "Currently streaming is possible only with batch size=1, use handles returned by add_request to stream several requests");
+
+    // split the batch between replicas, each replica generates its part on its own thread
+    std::vector<std::vector<size_t>> replica_request_ids(m_replicas.size());
+    {
+        std::lock_guard<std::mutex> lock{m_routing_mutex};
+        std::vector<size_t> loads = _get_replica_loads();
+        for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
+            size_t replica_id = m_router->route(input_ids[request_id], loads);
+            replica_request_ids[replica_id].push_back(request_id);
+            ++loads[replica_id];
+        }
+    }
+
+    std::vector<std::future<std::vector<EncodedGenerationResult>>> replica_futures(m_replicas.size());
+    for (size_t replica_id = 0; replica_id < m_replicas.size(); ++replica_id) {
+        if (replica_request_ids[replica_id].empty())
+            continue;
+
+        std::vector<ov::Tensor> replica_input_ids;
+        std::vector<GenerationConfig> replica_sampling_params;
+        for (size_t request_id : replica_request_ids[replica_id]) {
+            replica_input_ids.push_back(input_ids[request_id]);
+            replica_sampling_params.push_back(sampling_params[request_id]);
+        }
+
+        auto pipeline = m_replicas[replica_id].pipeline;
+        replica_futures[replica_id] = m_replicas[replica_id].worker->submit([pipeline, replica_input_ids, replica_sampling_params, &streamer] {
+            return pipeline->generate(replica_input_ids, replica_sampling_params, streamer);
+        });
+    }
+
+    std::vector<EncodedGenerationResult> results(input_ids.size());
+    std::exception_ptr exception;
+    for (size_t replica_id = 0; replica_id < m_replicas.size(); ++replica_id) {
+        if (!replica_futures[replica_id].valid())
+            continue;
+        try {
+            std::vector<EncodedGenerationResult> replica_results = replica_futures[replica_id].get();
+            for (size_t i = 0; i < replica_results.size(); ++i) {
+                size_t request_id = replica_request_ids[replica_id][i];
+                results[request_id] = std::move(replica_results[i]);
+                results[request_id].m_request_id = request_id;
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    _update_pipeline_metrics();
+    return results;
+}
+
+}
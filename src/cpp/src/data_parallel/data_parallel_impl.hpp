@@ -0,0 +1,78 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <optional>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "continuous_batching_impl.hpp"
+#include "data_parallel/prefix_affinity_router.hpp"
+#include "threadpool.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Data-parallel pipeline: several ContinuousBatchingImpl replicas of the same model behind a single `add_request` / `step` front-end.
+ * On CPU, each replica is bound to its own NUMA node: its model is compiled and all its steps (including KV cache allocation)
+ * are executed by a thread bound to the node's CPUs, so replicas don't compete for cores and memory bandwidth of other sockets.
+ * Requests are routed by PrefixAffinityRouter, which prefers the replica holding a prefix cache hit unless it's overloaded.
+ */
+class ContinuousBatchingPipeline::DataParallelImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
+protected:
+    struct Replica {
+        std::shared_ptr<ContinuousBatchingImpl> pipeline;
+        // single thread executing all work of the replica, bound to CPUs of the replica's NUMA node
+        std::unique_ptr<ThreadPool> worker;
+        // requests routed to the replica, weak pointers to not prolong lifetime of handles owned by users
+        std::list<std::weak_ptr<GenerationHandleImpl>> handles;
+    };
+
+    // CPUs of each NUMA node of the system, a single empty list if NUMA topology is unknown
+    std::vector<std::vector<size_t>> m_numa_nodes_cpus;
+    std::vector<Replica> m_replicas;
+    // created once replicas are compiled and their KV cache block size is known
+    std::optional<PrefixAffinityRouter> m_router;
+    std::mutex m_routing_mutex;
+
+    /**
+     * @return Number of unfinished requests routed to each replica.
+     */
+    std::vector<size_t> _get_replica_loads();
+
+    void _update_pipeline_metrics();
+
+public:
+    /**
+     * @param num_replicas Number of replicas, 0 means one replica per NUMA node.
+     */
+    DataParallelImpl(const std::shared_ptr<ov::Model>& model,
+                     const Tokenizer& tokenizer,
+                     const SchedulerConfig& scheduler_config,
+                     const std::string& device,
+                     const ov::AnyMap& properties,
+                     const ov::genai::GenerationConfig& generation_config,
+                     size_t num_replicas);
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const ov::Tensor& input_ids,
+                                 ov::genai::GenerationConfig sampling_params) override;
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const std::string& prompt,
+                                 ov::genai::GenerationConfig sampling_params) override;
+
+    bool has_non_finished_requests() override;
+
+    void step() override;
+
+    std::vector<EncodedGenerationResult>
+    generate(const std::vector<ov::Tensor>& input_ids,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) override;
+
+    size_t get_num_replicas() const;
+};
+
+}
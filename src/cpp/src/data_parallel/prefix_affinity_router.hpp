@@ -0,0 +1,119 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Routes requests between data-parallel pipeline replicas. A request goes to the replica which has recently processed
+ * the longest prefix of its prompt (so the prefix is likely to be in the replica's prefix cache), unless this replica is overloaded
+ * compared to the least loaded one. Otherwise, the least loaded replica is chosen.
+ *
+ * The router does not look into replicas' KV caches: it remembers which replica has processed prompt blocks most recently.
+ */
+class PrefixAffinityRouter {
+    size_t m_num_replicas;
+    size_t m_block_size;
+    size_t m_max_num_blocks;
+    size_t m_max_load_imbalance;
+
+    // LRU of hashes of prompt prefixes ending at block boundaries, most recently routed blocks are in front
+    std::list<size_t> m_blocks_lru;
+    // prefix hash -> replica which has processed the prefix last and position in LRU
+    std::unordered_map<size_t, std::pair<size_t, std::list<size_t>::iterator>> m_block_owners;
+
+    std::vector<size_t> _get_prefix_hashes(const ov::Tensor& input_ids) const {
+        const int64_t* ids = input_ids.data<const int64_t>();
+        size_t num_blocks = input_ids.get_size() / m_block_size;
+        std::vector<size_t> hashes(num_blocks);
+        size_t prefix_hash = 0;
+        for (size_t block_id = 0; block_id < num_blocks; ++block_id) {
+            const char* data = reinterpret_cast<const char*>(ids + block_id * m_block_size);
+            size_t block_hash = std::hash<std::string_view>{}(std::string_view(data, m_block_size * sizeof(int64_t)));
+            // hash of the prefix is chained from the hash of the previous prefix
+            prefix_hash ^= block_hash + 0x9e3779b9 + (prefix_hash << 6) + (prefix_hash >> 2);
+            hashes[block_id] = prefix_hash;
+        }
+        return hashes;
+    }
+
+public:
+    /**
+     * @param num_replicas Number of replicas to route requests between.
+     * @param block_size Granularity of prompt prefixes in tokens, should not exceed KV cache block size of the replicas.
+     * @param max_num_blocks Maximum number of prompt blocks to remember.
+     * @param max_load_imbalance Maximum difference between loads of the replica with a prefix hit and the least loaded replica
+     * for the request to go to the replica with the prefix hit.
+     */
+    explicit PrefixAffinityRouter(size_t num_replicas, size_t block_size = 16, size_t max_num_blocks = 65536, size_t max_load_imbalance = 4) :
+        m_num_replicas(num_replicas),
+        m_block_size(block_size),
+        m_max_num_blocks(max_num_blocks),
+        m_max_load_imbalance(max_load_imbalance) {
+        OPENVINO_ASSERT(num_replicas > 0, "Number of replicas must be non-zero");
+        OPENVINO_ASSERT(block_size > 0, "Block size must be non-zero");
+    }
+
+    /**
+     * @param input_ids Prompt of the request.
+     * @param loads Number of requests currently processed by each replica.
+     * @return Index of the replica to process the request.
+     */
+    size_t route(const ov::Tensor& input_ids, const std::vector<size_t>& loads) {
+        OPENVINO_ASSERT(loads.size() == m_num_replicas, "Expected loads of ", m_num_replicas, " replicas, but got ", loads.size());
+        std::vector<size_t> prefix_hashes = _get_prefix_hashes(input_ids);
+
+        // number of leading prompt blocks recently processed by each replica
+        std::vector<size_t> num_matched_blocks(m_num_replicas, 0);
+        for (size_t block_id = 0; block_id < prefix_hashes.size(); ++block_id) {
+            auto it = m_block_owners.find(prefix_hashes[block_id]);
+            if (it == m_block_owners.end())
+                break;
+            num_matched_blocks[it->second.first] = block_id + 1;
+        }
+
+        size_t least_loaded_replica = std::min_element(loads.begin(), loads.end()) - loads.begin();
+        size_t best_matched_replica = 0;
+        for (size_t replica_id = 1; replica_id < m_num_replicas; ++replica_id) {
+            if (num_matched_blocks[replica_id] > num_matched_blocks[best_matched_replica] ||
+                (num_matched_blocks[replica_id] == num_matched_blocks[best_matched_replica] && loads[replica_id] < loads[best_matched_replica]))
+                best_matched_replica = replica_id;
+        }
+
+        size_t replica_id = least_loaded_replica;
+        if (num_matched_blocks[best_matched_replica] > 0 && loads[best_matched_replica] <= loads[least_loaded_replica] + m_max_load_imbalance)
+            replica_id = best_matched_replica;
+
+        // the chosen replica is going to have the prompt in its cache
+        // shorter prefixes are moved to the front of LRU last, so they are evicted after longer ones
+        for (auto hash_it = prefix_hashes.rbegin(); hash_it != prefix_hashes.rend(); ++hash_it) {
+            size_t prefix_hash = *hash_it;
+            auto it = m_block_owners.find(prefix_hash);
+            if (it != m_block_owners.end()) {
+                it->second.first = replica_id;
+                m_blocks_lru.splice(m_blocks_lru.begin(), m_blocks_lru, it->second.second);
+                continue;
+            }
+            if (m_block_owners.size() >= m_max_num_blocks) {
+                m_block_owners.erase(m_blocks_lru.back());
+                m_blocks_lru.pop_back();
+            }
+            m_blocks_lru.push_front(prefix_hash);
+            m_block_owners.emplace(prefix_hash, std::make_pair(replica_id, m_blocks_lru.begin()));
+        }
+
+        return replica_id;
+    }
+};
+
+}
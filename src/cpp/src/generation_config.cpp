@@ -89,6 +89,7 @@ GenerationConfig::GenerationConfig(const std::filesystem::path& json_path) {
     read_json_param(data, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_json_param(data, "num_assistant_tokens", num_assistant_tokens);
     read_json_param(data, "max_ngram_size", max_ngram_size);
+    read_json_param(data, "num_assistant_branches", num_assistant_branches);
 
     // append EOS to stop_token_ids
     if (eos_token_id != -1)
@@ -148,6 +149,7 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_anymap_param(properties, "num_assistant_tokens", num_assistant_tokens);
     read_anymap_param(properties, "max_ngram_size", max_ngram_size);
+    read_anymap_param(properties, "num_assistant_branches", num_assistant_branches);
 }
 
 size_t GenerationConfig::get_max_new_tokens(size_t prompt_length) const {
@@ -258,13 +260,20 @@ void GenerationConfig::validate() const {
     // assistant generation
 
     if (is_assisting_generation()) {
-        OPENVINO_ASSERT(!is_beam_search() && num_return_sequences == 1, "Beam search and parallel sampling are not compatible with assistant generation");
         OPENVINO_ASSERT(assistant_confidence_threshold == 0.0f || num_assistant_tokens == 0, "Parameters `assistant_confidence_threshold` and `num_assistant_tokens` are mutually exclusive in `GenerationConfig`");
     }
 
     if (num_assistant_tokens == 0) {
         OPENVINO_ASSERT(max_ngram_size == 0, "'max_ngram_size' should be set to default value 0 when prompt lookup is disabled");
     }
+
+    OPENVINO_ASSERT(num_assistant_branches > 0, "'num_assistant_branches' must be greater than 0");
+    if (num_assistant_branches > 1) {
+        OPENVINO_ASSERT(is_assisting_generation() && !is_prompt_lookup(), "'num_assistant_branches' > 1 is supported only by speculative decoding with a draft model");
+        OPENVINO_ASSERT(is_greedy_decoding(), "'num_assistant_branches' > 1 is supported only by greedy decoding");
+        OPENVINO_ASSERT(repetition_penalty == 1.0f && presence_penalty == 0.0f && frequency_penalty == 0.0f,
+                        "Penalties are not supported with 'num_assistant_branches' > 1, since branches share a logit processor");
+    }
 }
 
 GenerationConfig beam_search() {
@@ -51,7 +51,9 @@ protected:
     ChatHistory m_history;
 
     float m_load_time_ms = 0.0f;
-    // to access m_load_time_ms
+    // intervals of loading sub-models, if the pipeline loads them in parallel
+    std::vector<ModelLoadInterval> m_load_timeline;
+    // to access m_load_time_ms and m_load_timeline
     friend class ContinuousBatchingPipeline;
 
     ModelInputType m_model_input_type = ModelInputType::TOKENS;
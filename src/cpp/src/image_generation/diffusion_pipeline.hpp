@@ -15,6 +15,7 @@
 
 #include "lora_helper.hpp"
 #include "lora_names_mapping.hpp"
+#include "parallel_model_loader.hpp"
 
 #include "json_utils.hpp"
 namespace {
@@ -227,6 +228,8 @@ protected:
     std::shared_ptr<IScheduler> m_scheduler;
     ImageGenerationConfig m_generation_config;
     float m_load_time_ms = 0.0f;
+    // intervals of loading models, which are loaded in parallel
+    std::vector<ModelLoadInterval> m_load_timeline;
     ImageGenerationPerfMetrics m_perf_metrics;
 
     std::shared_ptr<AutoencoderKL> m_vae = nullptr;
@@ -173,16 +173,22 @@ public:
 
         auto updated_properties = update_adapters_in_properties(properties, &FluxPipeline::derived_adapters);
 
+        utils::ParallelModelLoader loader;
+
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
         if (text_encoder == "CLIPTextModel") {
-            m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, *updated_properties);
+            loader.add("text_encoder", [&]() {
+                m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, *updated_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string t5_text_encoder = data["text_encoder_2"][1].get<std::string>();
         if (t5_text_encoder == "T5EncoderModel") {
-            m_t5_text_encoder = std::make_shared<T5EncoderModel>(root_dir / "text_encoder_2", device, *updated_properties);
+            loader.add("text_encoder_2", [&]() {
+                m_t5_text_encoder = std::make_shared<T5EncoderModel>(root_dir / "text_encoder_2", device, *updated_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", t5_text_encoder, "' text encoder type");
         }
@@ -190,9 +196,13 @@ public:
         const std::string vae = data["vae"][1].get<std::string>();
         if (vae == "AutoencoderKL") {
             if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
+                });
             else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
+                });
             } else {
                 OPENVINO_ASSERT("Unsupported pipeline type");
             }
@@ -202,11 +212,15 @@ public:
 
         const std::string transformer = data["transformer"][1].get<std::string>();
         if (transformer == "FluxTransformer2DModel") {
-            m_transformer = std::make_shared<FluxTransformer2DModel>(root_dir / "transformer", device, *updated_properties);
+            loader.add("transformer", [&]() {
+                m_transformer = std::make_shared<FluxTransformer2DModel>(root_dir / "transformer", device, *updated_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", transformer, "' Transformer type");
         }
 
+        m_load_timeline = loader.wait();
+
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
         update_adapters_from_properties(properties, m_generation_config.adapters);
@@ -253,10 +267,12 @@ public:
                  const ov::AnyMap& properties) override {
         update_adapters_from_properties(properties, m_generation_config.adapters);
         auto updated_properties = update_adapters_in_properties(properties, &FluxPipeline::derived_adapters);
-        m_clip_text_encoder->compile(text_encode_device, *updated_properties);
-        m_t5_text_encoder->compile(text_encode_device, *updated_properties);
-        m_vae->compile(vae_device, *updated_properties);
-        m_transformer->compile(denoise_device, *updated_properties);
+        utils::ParallelModelLoader loader;
+        loader.add("text_encoder", [&]() { m_clip_text_encoder->compile(text_encode_device, *updated_properties); });
+        loader.add("text_encoder_2", [&]() { m_t5_text_encoder->compile(text_encode_device, *updated_properties); });
+        loader.add("vae", [&]() { m_vae->compile(vae_device, *updated_properties); });
+        loader.add("transformer", [&]() { m_transformer->compile(denoise_device, *updated_properties); });
+        m_load_timeline = loader.wait();
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -535,6 +551,7 @@ public:
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
         m_perf_metrics.load_time = m_load_time_ms;
+        m_perf_metrics.load_timeline = m_load_timeline;
         return m_perf_metrics;
     }
 
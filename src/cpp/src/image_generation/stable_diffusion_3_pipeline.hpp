@@ -135,17 +135,22 @@ public:
 
         set_scheduler(Scheduler::from_config(root_dir / "scheduler/scheduler_config.json"));
 
+        utils::ParallelModelLoader loader;
+
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
         if (text_encoder == "CLIPTextModelWithProjection") {
-            m_clip_text_encoder_1 =
-                std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder", device, properties);
+            loader.add("text_encoder", [&]() {
+                m_clip_text_encoder_1 = std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder", device, properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string text_encoder_2 = data["text_encoder_2"][1].get<std::string>();
         if (text_encoder_2 == "CLIPTextModelWithProjection") {
-            m_clip_text_encoder_2 = std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder_2", device, properties);
+            loader.add("text_encoder_2", [&]() {
+                m_clip_text_encoder_2 = std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder_2", device, properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder_2, "' text encoder type");
         }
@@ -154,7 +159,9 @@ public:
         if (!text_encoder_3_json.is_null()) {
             const std::string text_encoder_3 = text_encoder_3_json.get<std::string>();
             if (text_encoder_3 == "T5EncoderModel") {
-                m_t5_text_encoder = std::make_shared<T5EncoderModel>(root_dir / "text_encoder_3", device, properties);
+                loader.add("text_encoder_3", [&]() {
+                    m_t5_text_encoder = std::make_shared<T5EncoderModel>(root_dir / "text_encoder_3", device, properties);
+                });
             } else {
                 OPENVINO_THROW("Unsupported '", text_encoder_3, "' text encoder type");
             }
@@ -162,7 +169,9 @@ public:
 
         const std::string transformer = data["transformer"][1].get<std::string>();
         if (transformer == "SD3Transformer2DModel") {
-            m_transformer = std::make_shared<SD3Transformer2DModel>(root_dir / "transformer", device, properties);
+            loader.add("transformer", [&]() {
+                m_transformer = std::make_shared<SD3Transformer2DModel>(root_dir / "transformer", device, properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", transformer, "' Transformer type");
         }
@@ -170,9 +179,13 @@ public:
         const std::string vae = data["vae"][1].get<std::string>();
         if (vae == "AutoencoderKL") {
             if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, properties);
+                });
             else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, properties);
+                });
             } else {
                 OPENVINO_ASSERT("Unsupported pipeline type");
             }
@@ -180,6 +193,8 @@ public:
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
 
+        m_load_timeline = loader.wait();
+
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
 
@@ -256,13 +271,15 @@ public:
                  const ov::AnyMap& properties) override {
         update_adapters_from_properties(properties, m_generation_config.adapters);
 
-        m_clip_text_encoder_1->compile(text_encode_device, properties);
-        m_clip_text_encoder_2->compile(text_encode_device, properties);
+        utils::ParallelModelLoader loader;
+        loader.add("text_encoder", [&]() { m_clip_text_encoder_1->compile(text_encode_device, properties); });
+        loader.add("text_encoder_2", [&]() { m_clip_text_encoder_2->compile(text_encode_device, properties); });
         if (m_t5_text_encoder) {
-            m_t5_text_encoder->compile(text_encode_device, properties);
+            loader.add("text_encoder_3", [&]() { m_t5_text_encoder->compile(text_encode_device, properties); });
         }
-        m_transformer->compile(denoise_device, properties);
-        m_vae->compile(vae_device, properties);
+        loader.add("transformer", [&]() { m_transformer->compile(denoise_device, properties); });
+        loader.add("vae", [&]() { m_vae->compile(vae_device, properties); });
+        m_load_timeline = loader.wait();
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -581,6 +598,7 @@ public:
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
         m_perf_metrics.load_time = m_load_time_ms;
+        m_perf_metrics.load_timeline = m_load_timeline;
         return m_perf_metrics;
     }
 
@@ -82,16 +82,22 @@ public:
 
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
 
+        utils::ParallelModelLoader loader;
+
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
         if (text_encoder == "CLIPTextModel") {
-            m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, *updated_properties);
+            loader.add("text_encoder", [&]() {
+                m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, *updated_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string unet = data["unet"][1].get<std::string>();
         if (unet == "UNet2DConditionModel") {
-            m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
+            loader.add("unet", [&]() {
+                m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", unet, "' UNet type");
         }
@@ -99,9 +105,13 @@ public:
         const std::string vae = data["vae"][1].get<std::string>();
         if (vae == "AutoencoderKL") {
             if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
+                });
             else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
+                });
             } else {
                 OPENVINO_ASSERT("Unsupported pipeline type");
             }
@@ -109,6 +119,8 @@ public:
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
 
+        m_load_timeline = loader.wait();
+
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
 
@@ -158,9 +170,11 @@ public:
         update_adapters_from_properties(properties, m_generation_config.adapters);
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
 
-        m_clip_text_encoder->compile(text_encode_device, *updated_properties);
-        m_unet->compile(denoise_device, *updated_properties);
-        m_vae->compile(vae_device, *updated_properties);
+        utils::ParallelModelLoader loader;
+        loader.add("text_encoder", [&]() { m_clip_text_encoder->compile(text_encode_device, *updated_properties); });
+        loader.add("unet", [&]() { m_unet->compile(denoise_device, *updated_properties); });
+        loader.add("vae", [&]() { m_vae->compile(vae_device, *updated_properties); });
+        m_load_timeline = loader.wait();
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -397,6 +411,7 @@ public:
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
         m_perf_metrics.load_time = m_load_time_ms;
+        m_perf_metrics.load_timeline = m_load_timeline;
         return m_perf_metrics;
     }
 
@@ -81,31 +81,32 @@ public:
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
         // updated_properies are for passing to the pipeline subcomponents only, not for the generation config
 
+        // models are loaded in parallel, so each of them gets a copy of properties, which are forked for VAE below
+        utils::ParallelModelLoader loader;
+
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
         if (text_encoder == "CLIPTextModel") {
-            m_clip_text_encoder = std::make_shared<CLIPTextModel>(
-                root_dir / "text_encoder",
-                device,
-                *properties_for_text_encoder(*updated_properties, "lora_te1")
-            );
+            loader.add("text_encoder", [&, model_properties = *properties_for_text_encoder(*updated_properties, "lora_te1")]() {
+                m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, model_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string text_encoder_2 = data["text_encoder_2"][1].get<std::string>();
         if (text_encoder_2 == "CLIPTextModelWithProjection") {
-            m_clip_text_encoder_with_projection = std::make_shared<CLIPTextModelWithProjection>(
-                root_dir / "text_encoder_2",
-                device,
-                *properties_for_text_encoder(*updated_properties, "lora_te2")
-            );
+            loader.add("text_encoder_2", [&, model_properties = *properties_for_text_encoder(*updated_properties, "lora_te2")]() {
+                m_clip_text_encoder_with_projection = std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder_2", device, model_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", text_encoder_2, "' text encoder type");
         }
 
         const std::string unet = data["unet"][1].get<std::string>();
         if (unet == "UNet2DConditionModel") {
-            m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
+            loader.add("unet", [&, model_properties = *updated_properties]() {
+                m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, model_properties);
+            });
         } else {
             OPENVINO_THROW("Unsupported '", unet, "' UNet type");
         }
@@ -119,9 +120,13 @@ public:
         const std::string vae = data["vae"][1].get<std::string>();
         if (vae == "AutoencoderKL") {
             if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&, model_properties = *updated_properties]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, model_properties);
+                });
             else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
+                loader.add("vae", [&, model_properties = *updated_properties]() {
+                    m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, model_properties);
+                });
             } else {
                 OPENVINO_ASSERT("Unsupported pipeline type");
             }
@@ -129,6 +134,8 @@ public:
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
 
+        m_load_timeline = loader.wait();
+
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
 
@@ -179,10 +186,12 @@ public:
         update_adapters_from_properties(properties, m_generation_config.adapters);
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
         // updated_properies are for passing to the pipeline subcomponents only, not for the generation config
-        m_clip_text_encoder->compile(text_encode_device, *updated_properties);
-        m_clip_text_encoder_with_projection->compile(text_encode_device, *updated_properties);
-        m_unet->compile(denoise_device, *updated_properties);
-        m_vae->compile(vae_device, *updated_properties);
+        utils::ParallelModelLoader loader;
+        loader.add("text_encoder", [&]() { m_clip_text_encoder->compile(text_encode_device, *updated_properties); });
+        loader.add("text_encoder_2", [&]() { m_clip_text_encoder_with_projection->compile(text_encode_device, *updated_properties); });
+        loader.add("unet", [&]() { m_unet->compile(denoise_device, *updated_properties); });
+        loader.add("vae", [&]() { m_vae->compile(vae_device, *updated_properties); });
+        m_load_timeline = loader.wait();
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -0,0 +1,156 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+#include "openvino/genai/kv_block_pool.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+KVBlockPool::KVBlockPool(size_t num_kv_blocks) : m_num_kv_blocks(num_kv_blocks) {
+    OPENVINO_ASSERT(num_kv_blocks > 0, "KV block pool must contain at least one block");
+}
+
+size_t KVBlockPool::register_pipeline(size_t quota, size_t block_size, size_t block_size_in_bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(m_total_quota + quota <= m_num_kv_blocks, "Sum of quotas of pipelines sharing KV block pool (", m_total_quota + quota,
+        ") exceeds the number of blocks in the pool (", m_num_kv_blocks, ")");
+
+    if (m_pipelines.empty()) {
+        m_block_size = block_size;
+        m_block_size_in_bytes = block_size_in_bytes;
+    } else {
+        OPENVINO_ASSERT(m_block_size == block_size && m_block_size_in_bytes == block_size_in_bytes,
+            "Pipelines sharing KV block pool must have the same KV cache layout. Expected block size ", m_block_size, " tokens / ",
+            m_block_size_in_bytes, " bytes, but got ", block_size, " tokens / ", block_size_in_bytes, " bytes");
+    }
+
+    m_total_quota += quota;
+    size_t pipeline_id = m_next_pipeline_id++;
+    m_pipelines[pipeline_id].quota = quota;
+    return pipeline_id;
+}
+
+void KVBlockPool::unregister_pipeline(size_t pipeline_id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const PipelineState& pipeline = get_pipeline(pipeline_id);
+    m_total_quota -= pipeline.quota;
+    m_num_used_blocks -= pipeline.num_held_blocks;
+    m_pipelines.erase(pipeline_id);
+    ++m_num_releases;
+    m_blocks_released.notify_all();
+}
+
+size_t KVBlockPool::acquire(size_t pipeline_id, size_t num_blocks) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PipelineState& pipeline = get_pipeline(pipeline_id);
+
+    size_t num_free_blocks = m_num_kv_blocks - m_num_used_blocks;
+    // blocks within quotas of starving pipelines are not lent to others
+    size_t num_reserved_blocks = get_num_missing_quota_blocks(pipeline_id);
+
+    size_t num_available_blocks = num_free_blocks > num_reserved_blocks ? num_free_blocks - num_reserved_blocks : 0;
+    if (pipeline.num_held_blocks < pipeline.quota) {
+        // blocks within own quota are always available
+        num_available_blocks = std::max(num_available_blocks, std::min(num_free_blocks, pipeline.quota - pipeline.num_held_blocks));
+    }
+
+    size_t num_granted_blocks = std::min(num_blocks, num_available_blocks);
+    pipeline.num_held_blocks += num_granted_blocks;
+    m_num_used_blocks += num_granted_blocks;
+    pipeline.is_starving = num_granted_blocks < num_blocks && (pipeline.num_held_blocks < pipeline.quota || pipeline.num_held_blocks == 0);
+
+    return num_granted_blocks;
+}
+
+void KVBlockPool::release(size_t pipeline_id, size_t num_blocks) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PipelineState& pipeline = get_pipeline(pipeline_id);
+    OPENVINO_ASSERT(num_blocks <= pipeline.num_held_blocks, "Pipeline releases ", num_blocks, " KV blocks, but holds only ", pipeline.num_held_blocks);
+    pipeline.num_held_blocks -= num_blocks;
+    m_num_used_blocks -= num_blocks;
+    // a pipeline which returns blocks does not wait for more of them
+    pipeline.is_starving = false;
+    ++m_num_releases;
+    m_blocks_released.notify_all();
+}
+
+size_t KVBlockPool::get_num_blocks_to_return(size_t pipeline_id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const PipelineState& pipeline = get_pipeline(pipeline_id);
+    if (pipeline.num_held_blocks <= pipeline.quota)
+        return 0;
+
+    size_t num_missing_blocks = get_num_missing_quota_blocks(pipeline_id);
+    size_t num_free_blocks = m_num_kv_blocks - m_num_used_blocks;
+    if (num_missing_blocks <= num_free_blocks)
+        return 0;
+    return std::min(pipeline.num_held_blocks - pipeline.quota, num_missing_blocks - num_free_blocks);
+}
+
+bool KVBlockPool::wait_for_blocks(size_t pipeline_id, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    size_t num_releases = m_num_releases;
+    return m_blocks_released.wait_for(lock, timeout, [&] {
+        if (m_num_releases != num_releases)
+            return true;
+        // blocks could be returned before the pipeline started to wait
+        const PipelineState& pipeline = get_pipeline(pipeline_id);
+        size_t num_needed_blocks = pipeline.num_held_blocks < pipeline.quota ? pipeline.quota - pipeline.num_held_blocks : 1;
+        return m_num_kv_blocks - m_num_used_blocks >= num_needed_blocks;
+    });
+}
+
+bool KVBlockPool::is_starving(size_t pipeline_id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_pipeline(pipeline_id).is_starving;
+}
+
+size_t KVBlockPool::get_num_kv_blocks() const {
+    return m_num_kv_blocks;
+}
+
+size_t KVBlockPool::get_num_free_blocks() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_kv_blocks - m_num_used_blocks;
+}
+
+size_t KVBlockPool::get_num_held_blocks(size_t pipeline_id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_pipeline(pipeline_id).num_held_blocks;
+}
+
+size_t KVBlockPool::get_quota(size_t pipeline_id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_pipeline(pipeline_id).quota;
+}
+
+const KVBlockPool::PipelineState& KVBlockPool::get_pipeline(size_t pipeline_id) const {
+    auto it = m_pipelines.find(pipeline_id);
+    OPENVINO_ASSERT(it != m_pipelines.end(), "Pipeline ", pipeline_id, " is not registered in KV block pool");
+    return it->second;
+}
+
+size_t KVBlockPool::get_num_missing_quota_blocks(size_t pipeline_id) const {
+    size_t num_missing_blocks = 0;
+    for (const auto& [id, other] : m_pipelines) {
+        if (id != pipeline_id && other.is_starving && other.num_held_blocks < other.quota)
+            num_missing_blocks += other.quota - other.num_held_blocks;
+    }
+    return num_missing_blocks;
+}
+
+KVBlockPool::PipelineState& KVBlockPool::get_pipeline(size_t pipeline_id) {
+    auto it = m_pipelines.find(pipeline_id);
+    OPENVINO_ASSERT(it != m_pipelines.end(), "Pipeline ", pipeline_id, " is not registered in KV block pool");
+    return it->second;
+}
+
+std::pair<std::string, ov::Any> kv_block_pool(const std::shared_ptr<KVBlockPool>& pool, size_t quota) {
+    OPENVINO_ASSERT(pool != nullptr, "KV block pool must not be null");
+    return { utils::KV_BLOCK_POOL_ARG_NAME, ov::Any::make<KVBlockPoolShare>(KVBlockPoolShare{pool, quota}) };
+}
+
+}  // namespace ov::genai
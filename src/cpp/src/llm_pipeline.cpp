@@ -13,6 +13,7 @@
 #include "llm_pipeline_stateful.hpp"
 #include "continuous_batching_adapter.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
+#include "model_registry.hpp"
 #include "utils.hpp"
 
 namespace ov {
@@ -30,25 +31,37 @@ SchedulerConfig get_latency_oriented_scheduler_config() {
     return default_config;
 }
 
-bool explicitly_requires_paged_attention(const ov::AnyMap& properties) {
+// speculative decoding with a draft model and prompt lookup decoding are implemented by the stateful backend as well,
+// so they require PagedAttention backend unless 'SDPA' is set explicitly
+bool explicitly_requires_paged_attention(const ov::AnyMap& properties, const std::string& attention_backend) {
     return properties.find(ov::genai::scheduler_config.name()) != properties.end() ||
-           properties.find(utils::DRAFT_MODEL_ARG_NAME) != properties.end() ||
-           properties.find(ov::genai::prompt_lookup.name()) != properties.end();
+           properties.find(ov::genai::self_speculative_draft_layers.name()) != properties.end() ||
+           (attention_backend == PA_BACKEND && (properties.find(utils::DRAFT_MODEL_ARG_NAME) != properties.end() ||
+                                                properties.find(ov::genai::prompt_lookup.name()) != properties.end()));
 }
 
 std::pair<ov::AnyMap, std::string> extract_attention_backend(const ov::AnyMap& external_properties) {
     std::string attention_backend = PA_BACKEND;
     ov::AnyMap properties = external_properties;
 
+    // sliding window of KV cache is implemented by the stateful backend only
+    auto window_it = properties.find(ov::genai::kv_cache_window_size.name());
+    const bool requires_sdpa = window_it != properties.end() && window_it->second.as<size_t>() > 0;
+    if (requires_sdpa) {
+        attention_backend = SDPA_BACKEND;
+    }
+
     auto it = properties.find("ATTENTION_BACKEND");
     if (it != properties.end()) {
         attention_backend = it->second.as<std::string>();
         OPENVINO_ASSERT(attention_backend == PA_BACKEND || attention_backend == SDPA_BACKEND,
             "Attention backend must be either '", PA_BACKEND, "' or '", SDPA_BACKEND, "', got '", attention_backend, "'");
+        OPENVINO_ASSERT(!requires_sdpa || attention_backend == SDPA_BACKEND,
+            "User properties are conflicting: 'kv_cache_window_size' requires SDPA backend, while 'ATTENTION_BACKEND' is set to 'PA'");
         properties.erase(it);
     }
 
-    if (explicitly_requires_paged_attention(properties)) {
+    if (explicitly_requires_paged_attention(properties, attention_backend)) {
         OPENVINO_ASSERT(attention_backend == PA_BACKEND,
             "User properties are conflicting: some of them requires PagedAttention backend, while 'ATTENTION_BACKEND' is set to 'SDPA'");
     }
@@ -82,7 +95,7 @@ std::pair<std::string, Any> draft_model(
     auto [plugin_config, scheduler_config] = utils::extract_scheduler_config(properties);
 
     std::filesystem::path openvino_model_name = "openvino_model.xml";
-    auto model = utils::singleton_core().read_model(models_path / openvino_model_name, {}, plugin_config);
+    auto model = utils::read_model(models_path / openvino_model_name, plugin_config);
     auto generation_config = utils::from_config_json_if_exists(models_path);
     auto tokenizer = ov::genai::Tokenizer(models_path);
     return { utils::DRAFT_MODEL_ARG_NAME, Any::make<ModelDesc>(model, tokenizer, device, plugin_config, scheduler_config, generation_config) };
@@ -122,15 +135,15 @@ ov::genai::LLMPipeline::LLMPipeline(
     auto [properties, attention_backend] = extract_attention_backend(user_properties);
 
     // If CB is invoked explicitly, create CB adapter as is and re-throw in case if internal issues
-    if (explicitly_requires_paged_attention(properties)) {
+    if (explicitly_requires_paged_attention(properties, attention_backend)) {
         auto [device_properties, scheduler_config] = utils::extract_scheduler_config(properties, get_latency_oriented_scheduler_config());
         m_pimpl = std::make_unique<ContinuousBatchingAdapter>(models_path, tokenizer, scheduler_config, device, device_properties);
     }
 
-    if (m_pimpl == nullptr && device == "NPU") {
-        m_pimpl = properties.count("STATIC_PIPELINE")
-            ? static_llm::LLMPipelineFactory::create(models_path, tokenizer, properties)
-            : std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, properties);
+    if (m_pimpl == nullptr && properties.count("STATIC_PIPELINE")) {
+        m_pimpl = static_llm::LLMPipelineFactory::create(models_path, tokenizer, device, properties);
+    } else if (m_pimpl == nullptr && device == "NPU") {
+        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, properties);
     }
 
     // try to call CB adapter one more time, but with safe guard to silent exception
@@ -162,15 +175,15 @@ ov::genai::LLMPipeline::LLMPipeline(
     auto [properties, attention_backend] = extract_attention_backend(user_properties);
 
     // If CB is invoked explicitly, create CB adapter as is and re-throw in case if internal issues
-    if (explicitly_requires_paged_attention(properties)) {
+    if (explicitly_requires_paged_attention(properties, attention_backend)) {
         auto [device_properties, scheduler_config] = utils::extract_scheduler_config(properties, get_latency_oriented_scheduler_config());
         m_pimpl = std::make_unique<ContinuousBatchingAdapter>(models_path, scheduler_config, device, device_properties);
     }
 
-    if (m_pimpl == nullptr && device == "NPU") {
-        m_pimpl = properties.count("STATIC_PIPELINE")
-            ? static_llm::LLMPipelineFactory::create(models_path, properties)
-            : std::make_unique<StatefulLLMPipeline>(models_path, device, properties);
+    if (m_pimpl == nullptr && properties.count("STATIC_PIPELINE")) {
+        m_pimpl = static_llm::LLMPipelineFactory::create(models_path, device, properties);
+    } else if (m_pimpl == nullptr && device == "NPU") {
+        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, device, properties);
     }
 
     // try to call CB adapter one more time, but with safe guard to silent exception
@@ -205,20 +218,21 @@ ov::genai::LLMPipeline::LLMPipeline(
     auto [properties, attention_backend] = extract_attention_backend(user_properties);
 
     // If CB is invoked explicitly, create CB adapter as is and re-throw in case if internal issues
-    if (explicitly_requires_paged_attention(properties)) {
+    if (explicitly_requires_paged_attention(properties, attention_backend)) {
         auto [device_properties, scheduler_config] = utils::extract_scheduler_config(properties, get_latency_oriented_scheduler_config());
         m_pimpl = std::make_unique<ContinuousBatchingAdapter>(model_str, weights_tensor,
                                                               tokenizer, scheduler_config, device, device_properties, generation_config);
     }
 
-    if (m_pimpl == nullptr && device == "NPU") {
-        m_pimpl = properties.count("STATIC_PIPELINE")
-            ? static_llm::LLMPipelineFactory::create(
-                  utils::singleton_core().read_model(model_str, weights_tensor),
-                  tokenizer,
-                  properties,
-                  generation_config)
-            : std::make_unique<StatefulLLMPipeline>(
+    if (m_pimpl == nullptr && properties.count("STATIC_PIPELINE")) {
+        m_pimpl = static_llm::LLMPipelineFactory::create(
+                utils::singleton_core().read_model(model_str, weights_tensor),
+                tokenizer,
+                device,
+                properties,
+                generation_config);
+    } else if (m_pimpl == nullptr && device == "NPU") {
+        m_pimpl = std::make_unique<StatefulLLMPipeline>(
                 utils::singleton_core().read_model(model_str, weights_tensor),
                 tokenizer,
                 device,
@@ -298,6 +312,14 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+void ov::genai::LLMPipeline::save_chat_session(const std::string& session_id) {
+    m_pimpl->save_chat_session(session_id);
+}
+
+bool ov::genai::LLMPipeline::restore_chat_session(const std::string& session_id) {
+    return m_pimpl->restore_chat_session(session_id);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     m_pimpl->set_generation_config(config);
 }
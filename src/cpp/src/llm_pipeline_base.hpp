@@ -54,6 +54,14 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual void save_chat_session(const std::string& session_id) {
+        OPENVINO_THROW("Chat sessions are supported only by the stateful pipeline, set 'ATTENTION_BACKEND' property to 'SDPA'");
+    }
+
+    virtual bool restore_chat_session(const std::string& session_id) {
+        OPENVINO_THROW("Chat sessions are supported only by the stateful pipeline, set 'ATTENTION_BACKEND' property to 'SDPA'");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     void save_load_time(std::chrono::steady_clock::time_point start_time) {
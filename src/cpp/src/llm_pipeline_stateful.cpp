@@ -9,6 +9,7 @@
 #include "openvino/genai/text_streamer.hpp"
 
 #include "utils.hpp"
+#include "model_registry.hpp"
 
 namespace ov::genai {
 
@@ -35,7 +36,7 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     const std::string& device,
     const ov::AnyMap& properties)
     : StatefulLLMPipeline{
-        utils::singleton_core().read_model(models_path / "openvino_model.xml", {}, properties),
+        utils::read_model(models_path / "openvino_model.xml", properties),
         tokenizer,
         device,
         properties,
@@ -51,22 +52,52 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     const ov::genai::GenerationConfig& generation_config,
     const std::filesystem::path& models_path)
     : LLMPipelineImplBase(tokenizer, generation_config), m_sampler(m_tokenizer) {
-    utils::apply_slice_before_matmul_transformation(model);
+    ov::AnyMap model_properties = properties;
+    auto draft_model_desc = utils::pop_or_default(model_properties, utils::DRAFT_MODEL_ARG_NAME, ModelDesc{});
+    const bool is_prompt_lookup_enabled = utils::pop_or_default(model_properties, ov::genai::prompt_lookup.name(), false);
+    const auto datastore_path = utils::pop_or_default(model_properties, ov::genai::prompt_lookup_datastore.name(), std::string{});
+    OPENVINO_ASSERT(draft_model_desc.model == nullptr || !is_prompt_lookup_enabled,
+                    "'draft_model' and 'prompt_lookup' properties are mutually exclusive");
+    const bool is_assisting_generation_enabled = draft_model_desc.model != nullptr || is_prompt_lookup_enabled;
+    m_chat_sessions = ChatSessionStore(utils::pop_or_default(model_properties, ov::genai::chat_sessions_cache_size.name(), size_t{16}));
+    m_compress_chat_sessions = utils::pop_or_default(model_properties, ov::genai::compress_chat_sessions.name(), false);
+    m_prefill_chunk_size = utils::pop_or_default(model_properties, ov::genai::prefill_chunk_size.name(), size_t{0});
+    const bool share_models = utils::pop_or_default(model_properties, ov::genai::share_models.name(), false);
+    const size_t kv_cache_window_size = utils::pop_or_default(model_properties, ov::genai::kv_cache_window_size.name(), size_t{0});
+    const size_t kv_cache_sink_tokens = utils::pop_or_default(model_properties, ov::genai::kv_cache_sink_tokens.name(), size_t{4});
+
+    // candidates of assisting generation are validated by logits of all their positions
+    if (is_assisting_generation_enabled) {
+        utils::apply_gather_before_matmul_transformation(model);
+    } else {
+        utils::apply_slice_before_matmul_transformation(model);
+    }
     auto kv_pos = ov::genai::utils::get_kv_axes_pos(model);
 
     if (device.find("NPU") != std::string::npos) {
         m_is_npu = true;
         m_use_full_chat_history = true;
+        // NPUW infers prompt by chunks itself
+        m_prefill_chunk_size = 0;
     }
+    OPENVINO_ASSERT(!m_is_npu || !is_assisting_generation_enabled,
+                    "Speculative decoding and prompt lookup decoding are not supported by the stateful pipeline on NPU");
 
     if (!m_use_full_chat_history)
         m_kv_history_trim_manager.kv_cache_seq_length_axis = kv_pos.seq_len;
 
-    auto filtered_properties = extract_adapters_from_properties(properties, &m_generation_config.adapters);
+    auto filtered_properties = extract_adapters_from_properties(model_properties, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
         m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
     }
+    if (kv_cache_window_size > 0) {
+        OPENVINO_ASSERT(!m_is_npu && !is_assisting_generation_enabled,
+                        "Sliding window of KV cache isn't supported on NPU and with speculative or prompt lookup decoding");
+        // RoPE of a model without config.json is assumed to be the default one
+        const RopeConfig rope_config = models_path.empty() ? RopeConfig{} : utils::from_config_json_if_exists<RopeConfig>(models_path, "config.json");
+        m_sliding_window_kv_cache = SlidingWindowKVCache(kv_cache_sink_tokens, kv_cache_window_size, kv_pos.seq_len, rope_config, m_adapter_controller);
+    }
     ov::CompiledModel compiled_model;
     if (m_is_npu) {
         utils::KVDesc kv_desc;
@@ -74,12 +105,21 @@ StatefulLLMPipeline::StatefulLLMPipeline(
             model, *filtered_properties, kv_pos, models_path
         );
         m_max_kv_cache_size = kv_desc.max_prompt_len + kv_desc.min_response_len;
+    } else if (share_models) {
+        m_shared_compiled_model = utils::ModelRegistry::get().compile_model(model, device, *filtered_properties);
+        compiled_model = *m_shared_compiled_model;
     } else {
        compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
     }
     m_model_runner = compiled_model.create_infer_request();
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Stateful LLM model");
 
+    if (draft_model_desc.model != nullptr) {
+        m_drafter = std::make_unique<StatefulDraftModel>(draft_model_desc, m_tokenizer, device);
+    } else if (is_prompt_lookup_enabled) {
+        m_drafter = std::make_unique<StatefulPromptLookup>(datastore_path.empty() ? nullptr : std::make_shared<RetrievalDatastore>(datastore_path));
+    }
+
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
         m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
@@ -259,6 +299,11 @@ EncodedResults StatefulLLMPipeline::generate(
             "Currently only \"num_return_sequences\" equal to 1 is supported for NPU device!");
     }
 
+    if (m_sliding_window_kv_cache) {
+        OPENVINO_ASSERT(batch_size == 1u && config.num_return_sequences == 1u && (config.is_greedy_decoding() || config.is_multinomial()),
+            "Sliding window of KV cache supports only batch size 1 with greedy or multinomial decoding and a single return sequence");
+    }
+
     // Stateful pipeline does not provide logprobs for prompt tokens
     OPENVINO_ASSERT(config.echo == false, "Echo is not supported in the stateful pipeline");
 
@@ -268,18 +313,23 @@ EncodedResults StatefulLLMPipeline::generate(
         (config.is_greedy_decoding() || config.is_multinomial()),
         "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
 
-    auto num_inputs = m_model_runner.get_compiled_model().inputs().size();
+    // main model of assisting generation has an additional `sampled_tokens_indices` input
+    auto num_inputs = m_model_runner.get_compiled_model().inputs().size() - (m_drafter ? 1 : 0);
     OPENVINO_ASSERT(num_inputs == 4 || num_inputs == 3, "Model should have 3 or 4 inputs: "
                     "either (input_ids, attention_mask, beam_idx) or "
                     "(input_ids, attention_mask, position_ids, beam_idx) "
                     "but you have '" + std::to_string(num_inputs) + "' inputs");
 
+    size_t num_recomputed_history_tokens = 0;
     if (is_chat_conversation) {
-        if (m_kv_cache_state.get_state().empty() || m_use_full_chat_history)
+        if (m_kv_cache_state.get_state().empty() || m_use_full_chat_history) {
             reset_kv_state();
-        else
+        } else {
+            // only the tail of KV cache after the longest common prefix with the new history is trimmed
+            num_recomputed_history_tokens = m_kv_history_trim_manager.num_tokens_to_trim;
             ov::genai::utils::trim_kv_cache(m_model_runner, m_kv_history_trim_manager.num_tokens_to_trim,
                                             m_kv_history_trim_manager.kv_cache_seq_length_axis, m_adapter_controller);
+        }
     }
 
     size_t kv_cache_len = 0;
@@ -346,8 +396,13 @@ EncodedResults StatefulLLMPipeline::generate(
         m_sampler.set_seed(config.rng_seed);
     }
 
-    ov::genai::utils::GenerationFinishInfo finish_info = get_lm_encoded_results(m_model_runner, input_ids, concatenated_attention_mask, streamer_ptr, m_sampler,
-                                                                                requests, position_ids, m_kv_cache_state, std::nullopt, std::nullopt, m_max_kv_cache_size);
+    ov::genai::utils::GenerationFinishInfo finish_info = m_drafter ?
+        get_lm_encoded_results_with_candidates(m_model_runner, input_ids, concatenated_attention_mask, streamer_ptr, m_sampler, requests.at(0),
+                                               position_ids, m_kv_cache_state, *m_drafter, m_kv_history_trim_manager.kv_cache_seq_length_axis, m_adapter_controller,
+                                               m_prefill_chunk_size) :
+        get_lm_encoded_results(m_model_runner, input_ids, concatenated_attention_mask, streamer_ptr, m_sampler,
+                               requests, position_ids, m_kv_cache_state, std::nullopt, std::nullopt, m_max_kv_cache_size, m_prefill_chunk_size,
+                               m_sliding_window_kv_cache);
     ov::genai::EncodedResults& result = finish_info.results;
     m_chat_generation_finish_status = finish_info.streaming_finish_status;
 
@@ -372,6 +427,8 @@ EncodedResults StatefulLLMPipeline::generate(
     // If is called without tokenization then that stat will not be reported.
     auto& metrics = result.perf_metrics;
     metrics.num_input_tokens = batch_size * input_ids.get_shape().at(1);
+    metrics.num_reused_history_tokens = kv_cache_len;
+    metrics.num_recomputed_history_tokens = num_recomputed_history_tokens;
     metrics.load_time = m_load_time_ms;
     metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
     metrics.evaluate_statistics(start_time);
@@ -414,4 +471,44 @@ void StatefulLLMPipeline::finish_chat() {
     }
 }
 
+void StatefulLLMPipeline::save_chat_session(const std::string& session_id) {
+    OPENVINO_ASSERT(is_chat_conversation, "Chat session can be saved only in chat mode, call 'start_chat' first");
+
+    ChatSession session;
+    session.history = m_history;
+    session.tokenized_chat_history = m_tokenized_chat_history;
+    session.chat_input_type = m_chat_input_type;
+    session.kv_history_trim_manager = m_kv_history_trim_manager;
+    session.chat_generation_finish_status = m_chat_generation_finish_status;
+    // KV cache isn't kept between generate calls if full history is used as prompt
+    if (!m_kv_cache_state.get_state().empty() && !m_use_full_chat_history) {
+        session.kv_states = snapshot_kv_states(m_model_runner, m_compress_chat_sessions, m_adapter_controller);
+        session.kv_cache_state = m_kv_cache_state;
+        ov::Tensor attention_mask = m_model_runner.get_tensor("attention_mask");
+        session.attention_mask = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
+        attention_mask.copy_to(session.attention_mask);
+    }
+    m_chat_sessions.put(session_id, std::move(session));
+}
+
+bool StatefulLLMPipeline::restore_chat_session(const std::string& session_id) {
+    std::optional<ChatSession> session = m_chat_sessions.take(session_id);
+    if (!session.has_value())
+        return false;
+
+    finish_chat();
+    is_chat_conversation = true;
+    m_history = std::move(session->history);
+    m_tokenized_chat_history = std::move(session->tokenized_chat_history);
+    m_chat_input_type = session->chat_input_type;
+    m_kv_history_trim_manager = session->kv_history_trim_manager;
+    m_chat_generation_finish_status = session->chat_generation_finish_status;
+    if (!session->kv_cache_state.get_state().empty()) {
+        restore_kv_states(m_model_runner, session->kv_states);
+        m_model_runner.set_tensor("attention_mask", session->attention_mask);
+        m_kv_cache_state = std::move(session->kv_cache_state);
+    }
+    return true;
+}
+
 } // namespace ov::genai
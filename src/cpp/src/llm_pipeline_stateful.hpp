@@ -4,14 +4,18 @@
 
 #include <limits>
 
+#include "chat_session_store.hpp"
 #include "llm_pipeline_base.hpp"
 #include "lm_encoding.hpp"
 #include "sampler.hpp"
+#include "speculative_decoding/stateful_drafter.hpp"
 #include "utils.hpp"
 
 namespace ov::genai {
 
 class StatefulLLMPipeline final : public LLMPipelineImplBase {
+    // set if `share_models` property is passed: keeps the compiled model shared with other pipelines alive
+    std::shared_ptr<ov::CompiledModel> m_shared_compiled_model;
     ov::InferRequest m_model_runner;
     Sampler m_sampler;
 
@@ -32,6 +36,15 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     bool m_is_npu = false;
     // reflection of tokens contained in the kv cache
     KVCacheState m_kv_cache_state;
+    // set if `draft_model` or `prompt_lookup` property is passed: candidates of assisting generation are validated by the model
+    std::unique_ptr<StatefulDrafter> m_drafter;
+    // chats saved by `save_chat_session` to be continued later
+    ChatSessionStore m_chat_sessions;
+    bool m_compress_chat_sessions = false;
+    // max number of prompt tokens inferred at once, 0 means the whole prompt
+    size_t m_prefill_chunk_size = 0;
+    // set if `kv_cache_window_size` property is passed: the oldest tokens are evicted from full KV cache
+    std::optional<SlidingWindowKVCache> m_sliding_window_kv_cache;
 
     void reset_kv_state();
 public:
@@ -79,6 +92,10 @@ public:
     void start_chat(const std::string& system_message) override;
 
     void finish_chat() override;
+
+    void save_chat_session(const std::string& session_id) override;
+
+    bool restore_chat_session(const std::string& session_id) override;
 };
 
 } // namespace ov::genai
@@ -6,12 +6,17 @@
 #include "sampler.hpp"
 #include "utils.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <regex>
+#include <sstream>
 
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/genai/text_streamer.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/stateful_to_stateless.hpp"
 
 #include <jinja2cpp/user_callable.h>
 
@@ -78,16 +83,123 @@ void stream_generated_tokens(std::shared_ptr<ov::genai::StreamerBase> streamer_p
     }
 }
 
+std::vector<uint32_t> pop_prompt_buckets(ov::AnyMap& config, const uint32_t max_prompt_len) {
+    std::vector<uint32_t> buckets;
+    auto anyopt = ov::genai::utils::pop_option(config, "PROMPT_LEN_BUCKETS");
+    if (!anyopt.has_value()) {
+        // NB: Default buckets grow by 4 times up to MAX_PROMPT_LEN
+        for (uint32_t bucket = 128u; bucket < max_prompt_len; bucket *= 4u) {
+            buckets.push_back(bucket);
+        }
+        buckets.push_back(max_prompt_len);
+        return buckets;
+    }
+
+    const auto any = anyopt.value();
+    if (any.is<std::string>()) {
+        std::stringstream stream(any.as<std::string>());
+        std::string bucket;
+        while (std::getline(stream, bucket, ',')) {
+            buckets.push_back(static_cast<uint32_t>(std::stoul(bucket)));
+        }
+    } else if (any.is<std::vector<int64_t>>()) {
+        // NB: Integer values coming from python have int64_t datatype
+        for (int64_t bucket : any.as<std::vector<int64_t>>()) {
+            OPENVINO_ASSERT(bucket >= 0, "PROMPT_LEN_BUCKETS cannot be negative!");
+            buckets.push_back(static_cast<uint32_t>(bucket));
+        }
+    } else if (any.is<std::vector<size_t>>()) {
+        for (size_t bucket : any.as<std::vector<size_t>>()) {
+            buckets.push_back(static_cast<uint32_t>(bucket));
+        }
+    } else {
+        buckets = any.as<std::vector<uint32_t>>();
+    }
+
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    OPENVINO_ASSERT(!buckets.empty() && buckets.front() > 0u && buckets.back() <= max_prompt_len,
+                    "PROMPT_LEN_BUCKETS must be positive and not exceed MAX_PROMPT_LEN: ", max_prompt_len);
+    return buckets;
+}
+
+// Replaces KV cache outputs of the entire cache with outputs of KV cache of new tokens only
+void redirect_new_kv_to_output(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& kvout : model->outputs()) {
+        const std::string kvout_name = kvout.get_any_name();
+        if (kvout_name.find("present") == std::string::npos) {
+            continue;
+        }
+        auto kvrslt = kvout.get_node();
+        auto kvcat = kvrslt->input_value(0).get_node_shared_ptr();
+        OPENVINO_ASSERT(ov::is_type<ov::op::v0::Concat>(kvcat), "Output ", kvout_name, " is expected to be a concatenation of past and new KV cache");
+        auto kvval = kvcat->input_value(1);
+        kvval.set_names({kvout_name});
+        kvrslt->input(0).replace_source_output(kvval);
+    }
+    model->validate_nodes_and_infer_types();
+}
+
+std::shared_ptr<ov::Model> make_static_model(const std::shared_ptr<ov::Model>& stateless_model,
+                                             const uint32_t input_size,
+                                             const uint32_t kvcache_size,
+                                             const ov::genai::utils::KVAxesPosition& kv_pos) {
+    auto model = stateless_model->clone();
+    std::map<std::string, ov::PartialShape> new_shapes;
+    for (const auto& input : model->inputs()) {
+        const auto& input_name = input.get_any_name();
+        ov::PartialShape new_shape = input.get_partial_shape();
+        if (input_name.find("input_ids") != std::string::npos || input_name.find("position_ids") != std::string::npos) {
+            new_shape = ov::PartialShape({1, input_size});
+        } else if (input_name.find("attention_mask") != std::string::npos) {
+            new_shape = ov::PartialShape({1, kvcache_size});
+        } else if (input_name.find("beam_idx") != std::string::npos) {
+            new_shape = ov::PartialShape({1});
+        } else if (input_name.find("past_key_values") != std::string::npos) {
+            new_shape[kv_pos.batch] = 1;
+            new_shape[kv_pos.seq_len] = kvcache_size - input_size;
+        }
+        new_shapes.emplace(input_name, new_shape);
+    }
+    model->reshape(new_shapes);
+    redirect_new_kv_to_output(model);
+    return model;
+}
+
+// NB: Compiled models are cached by the core if `ov::cache_dir` is in properties, each input size gets its own blob
+ov::CompiledModel compile_static_model(const std::shared_ptr<ov::Model>& stateless_model,
+                                       const uint32_t input_size,
+                                       const uint32_t kvcache_size,
+                                       const ov::genai::utils::KVAxesPosition& kv_pos,
+                                       const std::string& device,
+                                       const ov::AnyMap& properties) {
+    return ov::genai::utils::singleton_core().compile_model(
+        make_static_model(stateless_model, input_size, kvcache_size, kv_pos), device, properties);
+}
+
+void zero_past_key_values(ov::InferRequest& request) {
+    for (const auto& input : request.get_compiled_model().inputs()) {
+        if (input.get_any_name().find("past_key_values") != std::string::npos) {
+            auto past = request.get_tensor(input);
+            std::memset(past.data(), 0, past.get_byte_size());
+        }
+    }
+}
+
 enum StaticPipelineKind {
-    STATEFUL
+    STATEFUL,
+    BUCKETED
 };
 
 StaticPipelineKind str_to_pipeline(const std::string& str) {
     if (str == "STATEFUL") {
         return StaticPipelineKind::STATEFUL;
     }
+    if (str == "BUCKETED") {
+        return StaticPipelineKind::BUCKETED;
+    }
     OPENVINO_THROW("Unsupported \"PIPELINE\" provided: ",
-                   str, ". Please select \"STATEFUL\".");
+                   str, ". Please select \"STATEFUL\" or \"BUCKETED\".");
 }
 } // anonymous namespace
 
@@ -347,38 +459,413 @@ void StatefulLLMPipeline::finish_chat() {
 };
 
 
+std::vector<PromptChunk> split_prompt_by_buckets(const uint32_t prompt_len, const std::vector<uint32_t>& buckets) {
+    OPENVINO_ASSERT(!buckets.empty(), "At least one prompt length bucket is required");
+    auto bucket = std::lower_bound(buckets.begin(), buckets.end(), prompt_len);
+    if (bucket != buckets.end()) {
+        return {{*bucket, prompt_len}};
+    }
+
+    const uint32_t chunk_size = buckets.front();
+    std::vector<PromptChunk> chunks;
+    if (const uint32_t first_chunk_len = prompt_len % chunk_size; first_chunk_len > 0u) {
+        chunks.push_back({chunk_size, first_chunk_len});
+    }
+    for (uint32_t i = 0; i < prompt_len / chunk_size; ++i) {
+        chunks.push_back({chunk_size, chunk_size});
+    }
+    return chunks;
+}
+
+BucketedLLMPipeline::BucketedLLMPipeline(
+    const std::shared_ptr<ov::Model>& model,
+    const ov::genai::Tokenizer& tokenizer,
+    const std::string& device,
+    const ov::AnyMap& properties,
+    const ov::genai::GenerationConfig& generation_config
+) : LLMPipelineImplBase(tokenizer, generation_config),
+    m_sampler(m_tokenizer) {
+    ov::AnyMap compile_properties = properties;
+    const uint32_t max_prompt_len = utils::pop_int_and_cast(compile_properties, "MAX_PROMPT_LEN").value_or(1024u);
+    const uint32_t min_response_len = utils::pop_int_and_cast(compile_properties, "MIN_RESPONSE_LEN").value_or(128u);
+    m_kvcache_total = max_prompt_len + min_response_len;
+    m_prompt_buckets = pop_prompt_buckets(compile_properties, max_prompt_len);
+
+    auto kv_pos = ov::genai::utils::get_kv_axes_pos(model);
+    m_kv_seq_len_axis = kv_pos.seq_len;
+
+    // NB: Prompt is padded from the left, so logits of its last token are the last ones
+    auto stateless_model = model->clone();
+    utils::apply_slice_before_matmul_transformation(stateless_model);
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::StatefulToStateless>();
+    manager.run_passes(stateless_model);
+
+    auto create_request = [&](uint32_t input_size) {
+        ov::CompiledModel compiled = compile_static_model(stateless_model, input_size, m_kvcache_total, kv_pos, device, compile_properties);
+        ov::genai::utils::print_compiled_model_properties(compiled, ("Static LLM model for " + std::to_string(input_size) + " input tokens").c_str());
+        ov::InferRequest request = compiled.create_infer_request();
+        // NB: Masked out positions of KV cache still take part in attention, so they must not be garbage
+        zero_past_key_values(request);
+        for (const auto& input : request.get_compiled_model().inputs()) {
+            if (input.get_any_name() == "beam_idx") {
+                fill_tensor<int32_t>(request.get_tensor(input), 0);
+            }
+        }
+        return request;
+    };
+    m_generate_request = create_request(1u);
+    for (uint32_t bucket : m_prompt_buckets) {
+        m_prefill_requests.emplace(bucket, bucket == 1u ? m_generate_request : create_request(bucket));
+    }
+
+    for (const auto& output : m_generate_request.get_compiled_model().outputs()) {
+        const std::string& output_name = output.get_any_name();
+        if (output_name.find("present") != std::string::npos) {
+            m_kv_names.emplace_back(output_name, std::regex_replace(output_name, std::regex("present"), "past_key_values"));
+        }
+    }
+    for (const auto& input : m_generate_request.get_compiled_model().inputs()) {
+        m_has_position_ids = m_has_position_ids || input.get_any_name() == "position_ids";
+    }
+    m_sampler.set_seed(m_generation_config.rng_seed);
+}
+
+void BucketedLLMPipeline::infer_prompt_chunk(ov::InferRequest& request,
+                                             const int64_t* input_ids,
+                                             const int64_t* attention_mask,
+                                             const uint32_t num_tokens,
+                                             const bool keep_kv_cache_in_request) {
+    const uint32_t input_size = request.get_tensor("input_ids").get_shape()[1];
+    const uint32_t num_padded = input_size - num_tokens;
+    const uint32_t past_len = m_kvcache_total - input_size;
+
+    auto padded_input_ids = request.get_tensor("input_ids");
+    fill_tensor<int64_t>(padded_input_ids, m_tokenizer.get_pad_token_id());
+    std::copy_n(input_ids, num_tokens, padded_input_ids.data<int64_t>() + num_padded);
+
+    // NB: Attention mask covers past KV cache and the input: history is taken from the generate request,
+    //     the rest of past positions and padding are masked out
+    auto mask = request.get_tensor("attention_mask");
+    int64_t* mask_data = mask.data<int64_t>();
+    const int64_t* history_mask = m_generate_request.get_tensor("attention_mask").data<int64_t>();
+    if (mask_data != history_mask) {
+        std::copy_n(history_mask, m_kv_len, mask_data);
+    }
+    std::fill(mask_data + m_kv_len, mask_data + past_len + num_padded, 0);
+    std::copy_n(attention_mask, num_tokens, mask_data + past_len + num_padded);
+
+    if (m_has_position_ids) {
+        auto position_ids = request.get_tensor("position_ids");
+        fill_tensor<int64_t>(position_ids, 0);
+        int64_t* position_ids_data = position_ids.data<int64_t>() + num_padded;
+        for (uint32_t i = 0; i < num_tokens; ++i) {
+            position_ids_data[i] = m_next_position_id;
+            m_next_position_id += attention_mask[i];
+        }
+    }
+
+    request.infer();
+
+    for (const auto& [output_name, input_name] : m_kv_names) {
+        auto new_kv = make_tensor_slice(request.get_tensor(output_name), m_kv_seq_len_axis, num_padded, input_size);
+        auto generate_kv = make_tensor_slice(m_generate_request.get_tensor(input_name), m_kv_seq_len_axis, m_kv_len, m_kv_len + num_tokens);
+        new_kv.copy_to(generate_kv);
+        if (keep_kv_cache_in_request && request != m_generate_request) {
+            auto request_kv = make_tensor_slice(request.get_tensor(input_name), m_kv_seq_len_axis, m_kv_len, m_kv_len + num_tokens);
+            new_kv.copy_to(request_kv);
+        }
+    }
+    std::copy_n(attention_mask, num_tokens, m_generate_request.get_tensor("attention_mask").data<int64_t>() + m_kv_len);
+    m_kv_len += num_tokens;
+}
+
+DecodedResults BucketedLLMPipeline::generate(
+    StringInputs inputs,
+    OptionalGenerationConfig generation_config,
+    StreamerVariant streamer
+) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    GenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+    std::string prompt;
+    if (auto input_vector = std::get_if<std::vector<std::string>>(&inputs)) {
+        OPENVINO_ASSERT(input_vector->size() == 1u, "Currently only batch size=1 is supported");
+        prompt = std::move(input_vector->front());
+    } else {
+        OPENVINO_ASSERT(std::holds_alternative<std::string>(inputs));
+        prompt = std::get<std::string>(inputs);
+    }
+
+    ov::genai::TokenizedInputs tokenized_input;
+    if (m_is_chat_conversation) {
+        m_history.push_back({{"role", "user"}, {"content", prompt}});
+        constexpr bool add_generation_prompt = true;
+        prompt = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
+        // for chat ov::genai::add_special_tokens(false) is aligned with stateful pipeline and HF
+        tokenized_input = m_tokenizer.encode(prompt, ov::genai::add_special_tokens(false));
+    } else {
+        if (config.apply_chat_template && !m_tokenizer.get_chat_template().empty()) {
+            ChatHistory history({{{"role", "user"}, {"content", prompt}}});
+            constexpr bool add_generation_prompt = true;
+            auto templated_prompt = m_tokenizer.apply_chat_template(history, add_generation_prompt);
+            tokenized_input = m_tokenizer.encode(templated_prompt, ov::genai::add_special_tokens(false));
+        } else {
+            // in case when chat_template was not found in tokenizer_config.json or set
+            tokenized_input = m_tokenizer.encode(prompt, ov::genai::add_special_tokens(true));
+        }
+    }
+
+    auto encode_stop_time =  std::chrono::steady_clock::now();
+    auto encoded_results = generate(tokenized_input, config, streamer);
+
+    auto decode_start_time =  std::chrono::steady_clock::now();
+    DecodedResults decoded_results = {m_tokenizer.decode(encoded_results.tokens), encoded_results.scores};
+    auto decode_stop_time =  std::chrono::steady_clock::now();
+
+    if (m_is_chat_conversation) {
+        auto answer = decoded_results.texts[0];
+        if (m_chat_generation_finish_status == GenerationStatus::CANCEL)
+            // If chat generation process was cancelled by user, let's rollback to previous state of history
+            m_history.pop_back();
+        else
+            m_history.push_back({{"role", "assistant"}, {"content", answer}});
+    }
+
+    // generate_durations
+    decoded_results.perf_metrics = encoded_results.perf_metrics;
+    auto& raw_counters = decoded_results.perf_metrics.raw_metrics;
+    auto stop_time = std::chrono::steady_clock::now();
+    raw_counters.generate_durations.clear();
+    raw_counters.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
+    raw_counters.tokenization_durations.emplace_back(PerfMetrics::get_microsec(encode_stop_time - start_time));
+    raw_counters.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_stop_time - decode_start_time));
+    decoded_results.perf_metrics.m_evaluated = false;
+    decoded_results.perf_metrics.evaluate_statistics(start_time);
+    return decoded_results;
+}
+
+EncodedResults BucketedLLMPipeline::generate(
+    const EncodedInputs& inputs,
+    OptionalGenerationConfig generation_config,
+    StreamerVariant streamer
+) {
+    auto start_time = std::chrono::steady_clock::now();
+    ov::Tensor input_ids;
+    ov::Tensor attention_mask;
+
+    if (auto data = std::get_if<ov::Tensor>(&inputs)) {
+        input_ids = *data;
+        attention_mask = ov::genai::utils::init_attention_mask(input_ids);
+    } else if (auto data = std::get_if<TokenizedInputs>(&inputs)) {
+        input_ids = data->input_ids;
+        attention_mask = data->attention_mask;
+    }
+
+    ov::Shape prompts_shape = input_ids.get_shape();
+    const size_t batch_size = prompts_shape[0];
+    OPENVINO_ASSERT(batch_size == 1u, "Currently only batch size=1 is supported");
+
+    GenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+    // If stop_token_ids were not provided, take value from default m_generation_config
+    if (config.stop_token_ids.empty())
+        config.stop_token_ids = m_generation_config.stop_token_ids;
+    // If eos_token_id was not provided, take value from default m_generation_config
+    if (config.eos_token_id == -1)
+        config.set_eos_token_id(m_generation_config.eos_token_id);
+    config.validate();
+
+    std::shared_ptr<StreamerBase> streamer_ptr = ov::genai::utils::create_streamer(streamer, m_tokenizer);
+
+    OPENVINO_ASSERT(config.is_greedy_decoding() || config.is_multinomial(),
+        "Currently only greedy and multinomial decoding are supported");
+
+    OPENVINO_ASSERT(config.num_return_sequences == 1u,
+        "Currently only \"num_return_sequences\" equal to 1 is supported!");
+
+    ov::genai::EncodedResults results;
+    auto& raw_perf_counters = results.perf_metrics.raw_metrics;
+    raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
+    // NB: Only batch=1 is supported now
+    results.scores.resize(1u);
+    results.scores[0] = 0u;
+    results.tokens.resize(1u);
+
+    // NB: Check if there is enough space in KV-cache to process input prompt, prompts longer than the largest bucket
+    //     are inferred by chunks, so the limit is the KV cache size leaving a position for the generate request
+    const uint32_t prompt_len = static_cast<uint32_t>(input_ids.get_size());
+    if (prompt_len >= m_kvcache_total) {
+        OPENVINO_THROW("Static Bucketed LLM pipeline may only process prompts up to "
+                       + std::to_string(m_kvcache_total - 1) + " tokens. "
+                       + "Set the \"MAX_PROMPT_LEN\" or \"MIN_RESPONSE_LEN\" config options to increase the limit.");
+    }
+
+    // NB: KV cache of the previous generation is left in the models, it's masked out
+    auto kv_attention_mask = m_generate_request.get_tensor("attention_mask");
+    fill_tensor<int64_t>(kv_attention_mask, 0);
+    m_kv_len = 0u;
+    m_next_position_id = 0;
+
+    const auto chunks = split_prompt_by_buckets(prompt_len, m_prompt_buckets);
+    auto infer_start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        auto& request = m_prefill_requests.at(chunks[i].input_len);
+        const bool has_next_chunk = i + 1 < chunks.size();
+        infer_prompt_chunk(request, input_ids.data<int64_t>() + m_kv_len, attention_mask.data<int64_t>() + m_kv_len,
+                           chunks[i].num_tokens, has_next_chunk);
+    }
+    auto infer_end = std::chrono::steady_clock::now();
+    auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+    raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
+    raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+    raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+    raw_perf_counters.m_batch_sizes.emplace_back(batch_size);
+
+    auto logits = m_prefill_requests.at(chunks.back().input_len).get_tensor("logits");
+    auto logits_len = logits.get_shape()[1];
+    if (logits_len > 1) {
+        // If SliceOut is not applied:
+        logits = make_tensor_slice(logits, 1, logits_len - 1, logits_len);
+    }
+
+    auto sequence_group = std::make_shared<SequenceGroup>(
+        0 /* request_id */, input_ids, config, 1 /* block_size */);
+    sequence_group->schedule_tokens(sequence_group->get_prompt_len());
+    sequence_group->set_output_seq_len(1);
+
+    // NB: Controls what tokens are ready to be pushed into the streamer
+    GenerationHandle handle = std::make_shared<GenerationHandleImpl>(
+        sequence_group->get_generation_stream(), sequence_group->get_sampling_parameters());
+
+    SamplerOutput sampler_output = m_sampler.sample({sequence_group}, logits);
+    stream_generated_tokens(streamer_ptr, handle);
+
+    // NB: The last position of attention mask of the generate request is the one of the input token
+    kv_attention_mask.data<int64_t>()[m_kvcache_total - 1] = 1;
+    int64_t* input_ids_data = m_generate_request.get_tensor("input_ids").data<int64_t>();
+    int64_t* position_ids_data = m_has_position_ids ? m_generate_request.get_tensor("position_ids").data<int64_t>() : nullptr;
+
+    while (sequence_group->is_running() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+        // KV Cache is full, no further generation is possible
+        if (m_kv_len + 1 == m_kvcache_total) {
+            sequence_group->set_out_of_memory();
+            break;
+        }
+
+        sequence_group->schedule_tokens(1);
+        const auto running_sequences = sequence_group->get_running_sequences();
+        OPENVINO_ASSERT(running_sequences.size() == 1u);
+        input_ids_data[0] = running_sequences.front()->get_generated_ids().back();
+        if (position_ids_data) {
+            position_ids_data[0] = m_next_position_id;
+        }
+
+        infer_start = std::chrono::steady_clock::now();
+        m_generate_request.infer();
+        infer_end = std::chrono::steady_clock::now();
+
+        // NB: Append KV cache of the token in place, inputs of the next step are updated accordingly
+        for (const auto& [output_name, input_name] : m_kv_names) {
+            auto past_kv = make_tensor_slice(m_generate_request.get_tensor(input_name), m_kv_seq_len_axis, m_kv_len, m_kv_len + 1);
+            m_generate_request.get_tensor(output_name).copy_to(past_kv);
+        }
+        kv_attention_mask.data<int64_t>()[m_kv_len] = 1;
+        ++m_kv_len;
+        ++m_next_position_id;
+
+        infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+        raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
+        raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+        raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+        raw_perf_counters.m_batch_sizes.emplace_back(batch_size);
+
+        SamplerOutput sampler_output = m_sampler.sample({sequence_group}, m_generate_request.get_tensor("logits"));
+        stream_generated_tokens(streamer_ptr, handle);
+    }
+
+    if (streamer_ptr) { // push streamer's cache
+        streamer_ptr->end();
+    }
+
+    OPENVINO_ASSERT(sequence_group->get_finished_sequences().size() == 1u);
+    auto sequence = sequence_group->get_finished_sequences().front();
+    results.tokens[0] = sequence->get_generated_ids();
+    results.scores[0] = sequence->get_cumulative_log_prob();
+    m_chat_generation_finish_status = sequence_group->get_generation_stream()->get_status();
+    m_sampler.clear_request_info(sequence_group->get_request_id());
+
+    auto stop_time = std::chrono::steady_clock::now();
+    // If is called without tokenization then that stat will not be reported.
+    auto& metrics = results.perf_metrics;
+    metrics.num_input_tokens = batch_size * input_ids.get_shape().at(1);
+    metrics.load_time = this->m_load_time_ms;
+    metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
+    metrics.evaluate_statistics(start_time);
+    return results;
+}
+
+void BucketedLLMPipeline::start_chat(const std::string& system_message) {
+    if (!system_message.empty()) {
+        m_history.push_back({{"role", "system"}, {"content", system_message}});
+    }
+    m_is_chat_conversation = true;
+};
+
+void BucketedLLMPipeline::finish_chat() {
+    m_is_chat_conversation = false;
+    m_history.clear();
+};
+
 std::unique_ptr<LLMPipelineImplBase>
 LLMPipelineFactory::create(const std::filesystem::path& models_path,
+                           const std::string& device,
                            const ov::AnyMap& config) {
-    return create(models_path, Tokenizer(models_path), config);
+    return create(models_path, Tokenizer(models_path), device, config);
 }
 
 std::unique_ptr<LLMPipelineImplBase> LLMPipelineFactory::create(const std::shared_ptr<ov::Model>& model,
                                                                 const ov::genai::Tokenizer& tokenizer,
+                                                                const std::string& device,
                                                                 const ov::AnyMap& properties,
                                                                 const ov::genai::GenerationConfig& generation_config,
                                                                 const std::filesystem::path& models_path) {
     auto properties_copy = properties;
     const auto pipeline_mode = str_to_pipeline(utils::pop_or_default(properties_copy, "STATIC_PIPELINE", std::string("STATEFUL")));
     if (pipeline_mode == StaticPipelineKind::STATEFUL) {
+        OPENVINO_ASSERT(device == "NPU", "\"STATEFUL\" static pipeline is supported only on NPU, use \"BUCKETED\" for ", device);
         return std::make_unique<ov::genai::static_llm::StatefulLLMPipeline>(model,
                                                                             tokenizer,
                                                                             properties_copy,
                                                                             generation_config,
                                                                             models_path);
     }
+    if (pipeline_mode == StaticPipelineKind::BUCKETED) {
+        return std::make_unique<ov::genai::static_llm::BucketedLLMPipeline>(model,
+                                                                            tokenizer,
+                                                                            device,
+                                                                            properties_copy,
+                                                                            generation_config);
+    }
     OPENVINO_ASSERT(false);
 }
 
 std::unique_ptr<LLMPipelineImplBase>
 LLMPipelineFactory::create(const std::filesystem::path& models_path,
                            const ov::genai::Tokenizer& tokenizer,
+                           const std::string& device,
                            const ov::AnyMap& config) {
     auto properties = config;
     const auto pipeline_mode = str_to_pipeline(utils::pop_or_default(properties, "STATIC_PIPELINE", std::string("STATEFUL")));
     if (pipeline_mode == StaticPipelineKind::STATEFUL) {
+        OPENVINO_ASSERT(device == "NPU", "\"STATEFUL\" static pipeline is supported only on NPU, use \"BUCKETED\" for ", device);
         return std::make_unique<ov::genai::static_llm::StatefulLLMPipeline>(models_path, tokenizer, properties);
     }
+    if (pipeline_mode == StaticPipelineKind::BUCKETED) {
+        return std::make_unique<ov::genai::static_llm::BucketedLLMPipeline>(
+            genai::utils::singleton_core().read_model(models_path / "openvino_model.xml", {}, properties),
+            tokenizer, device, properties,
+            utils::from_config_json_if_exists(models_path));
+    }
     OPENVINO_ASSERT(false);
 }
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <map>
 
 #include "llm_pipeline_base.hpp"
 #include "sampler.hpp"
@@ -15,18 +16,36 @@ namespace static_llm {
 struct LLMPipelineFactory {
     static std::unique_ptr<LLMPipelineImplBase> create(const std::filesystem::path& models_path,
                                                        const ov::genai::Tokenizer& tokenizer,
+                                                       const std::string& device,
                                                        const ov::AnyMap& config);
 
     static std::unique_ptr<LLMPipelineImplBase> create(const std::filesystem::path& models_path,
+                                                       const std::string& device,
                                                        const ov::AnyMap& config);
 
     static std::unique_ptr<LLMPipelineImplBase> create(const std::shared_ptr<ov::Model>& model,
                                                        const ov::genai::Tokenizer& tokenizer,
+                                                       const std::string& device,
                                                        const ov::AnyMap& properties,
                                                        const ov::genai::GenerationConfig& generation_config,
                                                        const std::filesystem::path& models_path = {});
 };
 
+struct PromptChunk {
+    // input length of the static model inferring the chunk
+    uint32_t input_len;
+    // number of prompt tokens in the chunk, the rest of the input is padding
+    uint32_t num_tokens;
+};
+
+/**
+ * @brief Splits a prompt into chunks inferred by static models compiled for `buckets` input lengths:
+ * a prompt fitting into a bucket is inferred by the smallest such bucket at once, a longer one is inferred
+ * by chunks of the smallest bucket, where only the first chunk is padded.
+ * @param buckets Sorted input lengths of the static models.
+ */
+std::vector<PromptChunk> split_prompt_by_buckets(uint32_t prompt_len, const std::vector<uint32_t>& buckets);
+
 class StatefulLLMPipeline : public LLMPipelineImplBase {
 public:
     StatefulLLMPipeline(
@@ -70,6 +89,67 @@ private:
     ov::genai::GenerationStatus m_chat_generation_finish_status = ov::genai::GenerationStatus::RUNNING;
 };
 
+/**
+ * @brief Static shapes pipeline, which doesn't depend on the NPU plugin: the stateful model is converted to a stateless one
+ * and compiled for a set of prompt length buckets and for generation of a single token. All the models take KV cache
+ * of `MAX_PROMPT_LEN + MIN_RESPONSE_LEN` tokens with unused positions masked out, so a short prompt doesn't pay
+ * for prefill of `MAX_PROMPT_LEN` tokens. Prompts longer than the largest bucket, including ones longer than `MAX_PROMPT_LEN`,
+ * are inferred by chunks of the smallest one as long as they fit into KV cache. Compiled models are cached by the core
+ * if `ov::cache_dir` is set.
+ */
+class BucketedLLMPipeline : public LLMPipelineImplBase {
+public:
+    BucketedLLMPipeline(
+        const std::shared_ptr<ov::Model>& model,
+        const ov::genai::Tokenizer& tokenizer,
+        const std::string& device,
+        const ov::AnyMap& properties,
+        const ov::genai::GenerationConfig& generation_config
+    );
+
+    DecodedResults generate(
+        StringInputs inputs,
+        OptionalGenerationConfig generation_config,
+        StreamerVariant streamer
+    ) override;
+
+    EncodedResults generate(
+        const EncodedInputs& inputs,
+        OptionalGenerationConfig generation_config,
+        StreamerVariant streamer
+    ) override;
+
+    void start_chat(const std::string& system_message) override;
+    void finish_chat() override;
+
+private:
+    // infers `num_tokens` prompt tokens by `request` and appends their KV cache to the one of the generate request
+    void infer_prompt_chunk(ov::InferRequest& request,
+                            const int64_t* input_ids,
+                            const int64_t* attention_mask,
+                            uint32_t num_tokens,
+                            bool keep_kv_cache_in_request);
+
+    uint32_t m_kvcache_total = 0u;
+    size_t m_kv_seq_len_axis = 2;
+    bool m_has_position_ids = false;
+    std::vector<uint32_t> m_prompt_buckets;
+    // names of outputs with KV cache of new tokens and of corresponding inputs with past KV cache
+    std::vector<std::pair<std::string, std::string>> m_kv_names;
+
+    std::map<uint32_t, ov::InferRequest> m_prefill_requests;
+    // keeps KV cache of the whole sequence, its attention mask marks the filled positions
+    ov::InferRequest m_generate_request;
+    uint32_t m_kv_len = 0u;
+    int64_t m_next_position_id = 0;
+
+    Sampler m_sampler;
+
+    bool m_is_chat_conversation = false;
+    ChatHistory m_history;
+    ov::genai::GenerationStatus m_chat_generation_finish_status = ov::genai::GenerationStatus::RUNNING;
+};
+
 }  // namespace static_llm
 }  // namespace genai
 }  // namespace ov
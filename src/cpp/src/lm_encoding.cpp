@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <regex>
@@ -12,67 +15,254 @@
 #include "utils.hpp"
 #include "debug_utils.hpp"
 #include "lm_encoding.hpp"
+#include "speculative_decoding/stateful_drafter.hpp"
 #include "openvino/genai/perf_metrics.hpp"
 #include "openvino/genai/streamer_base.hpp"
 
 namespace {
 
+// copies [begin, end) range of `axis` of the tensor to a new contiguous tensor
+ov::Tensor slice_tensor(const ov::Tensor& tensor, size_t axis, size_t begin, size_t end) {
+    ov::Coordinate begin_coordinate(tensor.get_shape().size(), 0);
+    ov::Coordinate end_coordinate(tensor.get_shape());
+    begin_coordinate[axis] = begin;
+    end_coordinate[axis] = end;
+    ov::Tensor roi(tensor, begin_coordinate, end_coordinate);
+    ov::Tensor slice(tensor.get_element_type(), roi.get_shape());
+    roi.copy_to(slice);
+    return slice;
+}
+
 /**
- * Set position ids tensor data for next token inference based on provided attention mask
- * Supports multi batch
- * Supports sparse attention_mask
+ * Infers the prompt by chunks of up to `chunk_size` tokens, which bounds size of activations by the chunk instead of the prompt.
+ * Each chunk attends to KV cache of the previous ones, so the last chunk produces logits of the whole prompt.
+ * If the model has `sampled_tokens_indices` input, logits are computed for the last token of each chunk only.
+ * @return Durations of inferences of all chunks in microseconds
  */
-void update_position_ids(ov::Tensor&& position_ids, const ov::Tensor&& attention_mask) {
-    const size_t batch_size = attention_mask.get_shape().at(0);
-    const size_t sequence_length = attention_mask.get_shape().at(1);
-    position_ids.set_shape({batch_size, 1});
-
-    for (size_t batch = 0; batch < batch_size; batch++) {
-        int64_t* mask_start = attention_mask.data<int64_t>() + batch * sequence_length;
-        position_ids.data<int64_t>()[batch] = std::accumulate(mask_start, mask_start + sequence_length - 1, 0);
+float infer_prompt(ov::InferRequest& llm,
+                   const std::string& inputs_name,
+                   const ov::Tensor& inputs,
+                   const ov::Tensor& attention_mask,
+                   const std::optional<ov::Tensor>& position_ids,
+                   size_t chunk_size,
+                   bool has_sampled_tokens_indices = false) {
+    const size_t prompt_len = inputs.get_shape().at(1);
+    // attention mask covers tokens of chat history contained in KV cache as well
+    const size_t history_len = attention_mask.get_shape().at(1) - prompt_len;
+    if (chunk_size == 0 || chunk_size > prompt_len) {
+        chunk_size = prompt_len;
     }
-}
 
-void update_3d_position_ids(ov::Tensor&& position_ids, const ov::Tensor& attention_mask, const int64_t rope_delta) {
-    const size_t batch_size = attention_mask.get_shape().at(0);
-    const size_t sequence_length = attention_mask.get_shape().at(1);
-    const size_t thw_dim_size = 3;
+    float infer_ms = 0.f;
+    for (size_t chunk_begin = 0; chunk_begin < prompt_len; chunk_begin += chunk_size) {
+        const size_t chunk_end = std::min(chunk_begin + chunk_size, prompt_len);
+        if (chunk_end - chunk_begin == prompt_len) {
+            llm.set_tensor(inputs_name, inputs);
+            llm.set_tensor("attention_mask", attention_mask);
+            if (position_ids.has_value())
+                llm.set_tensor("position_ids", *position_ids);
+        } else {
+            llm.set_tensor(inputs_name, slice_tensor(inputs, 1, chunk_begin, chunk_end));
+            llm.set_tensor("attention_mask", slice_tensor(attention_mask, 1, 0, history_len + chunk_end));
+            // the last axis is the sequence one for both 2D and 3D (mrope) position ids
+            if (position_ids.has_value())
+                llm.set_tensor("position_ids", slice_tensor(*position_ids, position_ids->get_shape().size() - 1, chunk_begin, chunk_end));
+        }
+        if (has_sampled_tokens_indices) {
+            ov::Tensor sampled_tokens_indices(ov::element::i64, {1});
+            sampled_tokens_indices.data<int64_t>()[0] = static_cast<int64_t>(chunk_end - chunk_begin) - 1;
+            llm.set_tensor("sampled_tokens_indices", sampled_tokens_indices);
+        }
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        llm.infer();
+        infer_ms += PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+    }
+    return infer_ms;
+}
 
-    position_ids.set_shape({thw_dim_size, batch_size, 1});
-    int64_t* position_ids_data = position_ids.data<int64_t>();
+/**
+ * Infers the prompt of a single sequence on top of KV cache bounded by the sliding window, evicting the oldest tokens
+ * of the window from both the states and `kv_cache_state` so that each chunk fits the cache. Prompt tokens must be
+ * already added to `kv_cache_state`. Position ids continue the positions of KV cache, which are contiguous after eviction.
+ * @return Durations of inferences of all chunks in microseconds and attention mask of KV cache after the prompt
+ */
+std::pair<float, ov::Tensor> infer_prompt_with_sliding_window(ov::InferRequest& llm,
+                                                              const ov::Tensor& input_ids,
+                                                              const ov::Tensor& attention_mask,
+                                                              bool has_position_ids,
+                                                              size_t chunk_size,
+                                                              const ov::genai::SlidingWindowKVCache& sliding_window_kv_cache,
+                                                              ov::genai::KVCacheState& kv_cache_state) {
+    OPENVINO_ASSERT(input_ids.get_shape().at(0) == 1, "Sliding window of KV cache supports only batch size 1");
+    const size_t prompt_len = input_ids.get_shape().at(1);
+    size_t kv_cache_len = attention_mask.get_shape().at(1) - prompt_len;
+    if (chunk_size == 0 || chunk_size > prompt_len) {
+        chunk_size = prompt_len;
+    }
+    // a prompt which doesn't fit the cache is inferred by chunks to evict the window before each of them
+    if (kv_cache_len + prompt_len > sliding_window_kv_cache.get_capacity()) {
+        chunk_size = std::min(chunk_size, sliding_window_kv_cache.get_max_chunk_size());
+    }
 
-    int64_t pos_id = static_cast<int64_t>(sequence_length) - 1 + rope_delta;
+    float infer_ms = 0.f;
+    for (size_t chunk_begin = 0; chunk_begin < prompt_len; chunk_begin += chunk_size) {
+        const size_t chunk_end = std::min(chunk_begin + chunk_size, prompt_len), chunk_len = chunk_end - chunk_begin;
+        const size_t num_tokens_to_evict = sliding_window_kv_cache.get_num_tokens_to_evict(kv_cache_len, chunk_len);
+        if (num_tokens_to_evict > 0) {
+            sliding_window_kv_cache.evict(llm, num_tokens_to_evict);
+            kv_cache_state.evict(sliding_window_kv_cache.get_num_sink_tokens(), num_tokens_to_evict);
+            kv_cache_len -= num_tokens_to_evict;
+        }
 
-    for (size_t batch = 0; batch < batch_size; batch++) {
-        for (size_t dim = 0; dim < thw_dim_size; ++dim) {
-            position_ids_data[dim * batch_size + batch] = pos_id;
+        llm.set_tensor("input_ids", chunk_len == prompt_len ? input_ids : slice_tensor(input_ids, 1, chunk_begin, chunk_end));
+        // padding of KV cache isn't possible for a single sequence, so the whole cache is attended
+        ov::Tensor chunk_attention_mask(ov::element::i64, {1, kv_cache_len + chunk_len});
+        std::fill_n(chunk_attention_mask.data<int64_t>(), chunk_attention_mask.get_size(), 1);
+        llm.set_tensor("attention_mask", chunk_attention_mask);
+        if (has_position_ids) {
+            ov::Tensor chunk_position_ids(ov::element::i64, {1, chunk_len});
+            std::iota(chunk_position_ids.data<int64_t>(), chunk_position_ids.data<int64_t>() + chunk_len, static_cast<int64_t>(kv_cache_len));
+            llm.set_tensor("position_ids", chunk_position_ids);
         }
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        llm.infer();
+        infer_ms += PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+        kv_cache_len += chunk_len;
     }
+    return {infer_ms, llm.get_tensor("attention_mask")};
+}
 }
 
-void update_attention_mask_with_beams(ov::Tensor&& attention_mask, std::vector<int32_t> next_beams) {
-    ov::Tensor original_mask{ov::element::i64, attention_mask.get_shape()};
-    ov::Shape original_shape = original_mask.get_shape();
-    attention_mask.copy_to(original_mask);
+namespace ov {
+namespace genai {
 
-    ov::Shape new_shape{next_beams.size(), original_mask.get_shape().at(1) + 1};
-    attention_mask.set_shape(new_shape);
+bool GenerationStepInputs::reserve_mask(size_t mask_id, size_t num_elements) {
+    if (m_mask_capacities[mask_id] >= num_elements)
+        return false;
+    // grows geometrically if the generation length wasn't known in advance
+    const size_t capacity = std::max(num_elements, 2 * m_mask_capacities[mask_id]);
+    ov::Tensor attention_mask(ov::element::i64, {capacity});
+    if (m_attention_masks[mask_id]) {
+        std::copy_n(m_attention_masks[mask_id].data<const int64_t>(), m_attention_masks[mask_id].get_size(), attention_mask.data<int64_t>());
+        attention_mask.set_shape(m_attention_masks[mask_id].get_shape());
+    }
+    m_attention_masks[mask_id] = attention_mask;
+    m_mask_capacities[mask_id] = capacity;
+    return true;
+}
 
-    for (size_t beam_id = 0; beam_id < next_beams.size(); beam_id++) {
-        const size_t original_prompt_offset = next_beams.at(beam_id) * original_shape.at(1);
-        const size_t result_prompt_offset = beam_id * new_shape.at(1);
+GenerationStepInputs::GenerationStepInputs(const ov::Tensor& attention_mask,
+                                           const std::optional<ov::Tensor>& position_ids,
+                                           std::optional<int64_t> rope_delta,
+                                           size_t max_batch_size,
+                                           size_t max_sequence_length) :
+    m_input_ids(ov::element::i64, {max_batch_size, 1}),
+    m_beam_idx(ov::element::i32, {max_batch_size}),
+    m_has_position_ids(position_ids.has_value()),
+    m_has_3d_position_ids(position_ids.has_value() && position_ids->get_shape().size() == 3 && rope_delta.has_value()),
+    m_rope_delta(rope_delta.value_or(0)) {
+    const size_t batch_size = attention_mask.get_shape().at(0), sequence_length = attention_mask.get_shape().at(1);
+    reserve_mask(m_current_mask, max_batch_size * std::max(max_sequence_length, sequence_length + 1));
+    m_attention_masks[m_current_mask].set_shape(attention_mask.get_shape());
+    attention_mask.copy_to(m_attention_masks[m_current_mask]);
+
+    if (m_has_position_ids) {
+        m_position_ids = m_has_3d_position_ids ? ov::Tensor(ov::element::i64, {3, max_batch_size, 1}) : ov::Tensor(ov::element::i64, {max_batch_size, 1});
+    }
+    m_num_attended_tokens.reserve(max_batch_size);
+    m_next_num_attended_tokens.reserve(max_batch_size);
+    m_next_beams.reserve(max_batch_size);
+    const int64_t* mask_data = attention_mask.data<const int64_t>();
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        m_num_attended_tokens.push_back(std::accumulate(mask_data + batch * sequence_length, mask_data + (batch + 1) * sequence_length, int64_t{0}));
+    }
+}
 
-        int64_t* dest = attention_mask.data<int64_t>() + result_prompt_offset;
-        const int64_t* src = original_mask.data<int64_t>() + original_prompt_offset;
+void GenerationStepInputs::set_to(ov::InferRequest& llm, bool set_input_ids) {
+    if (set_input_ids)
+        llm.set_tensor("input_ids", m_input_ids);
+    llm.set_tensor("attention_mask", m_attention_masks[m_current_mask]);
+    if (m_has_position_ids)
+        llm.set_tensor("position_ids", m_position_ids);
+    llm.set_tensor("beam_idx", m_beam_idx);
+}
 
-        std::memcpy(dest, src, original_shape.at(1) * sizeof(int64_t));
-        attention_mask.data<int64_t>()[result_prompt_offset + new_shape.at(1) - 1] = 1;
+void GenerationStepInputs::evict(ov::InferRequest& llm, size_t begin, size_t num_tokens) {
+    OPENVINO_ASSERT(!m_has_3d_position_ids, "KV cache eviction isn't supported for 3D position ids");
+    ov::Tensor& mask = m_attention_masks[m_current_mask];
+    const size_t batch_size = mask.get_shape().at(0), sequence_length = mask.get_shape().at(1);
+    OPENVINO_ASSERT(begin + num_tokens <= sequence_length);
+    const size_t next_sequence_length = sequence_length - num_tokens;
+    int64_t* mask_data = mask.data<int64_t>();
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        int64_t* row = mask_data + batch * sequence_length;
+        m_num_attended_tokens.at(batch) -= std::accumulate(row + begin, row + begin + num_tokens, int64_t{0});
+        int64_t* next_row = mask_data + batch * next_sequence_length;
+        std::memmove(next_row, row, begin * sizeof(int64_t));
+        std::memmove(next_row + begin, row + begin + num_tokens, (sequence_length - begin - num_tokens) * sizeof(int64_t));
     }
-}
+    mask.set_shape({batch_size, next_sequence_length});
+    llm.set_tensor("attention_mask", mask);
 }
 
-namespace ov {
-namespace genai {
+void GenerationStepInputs::update(ov::InferRequest& llm) {
+    const ov::Tensor& attention_mask = m_attention_masks[m_current_mask];
+    const size_t batch_size = attention_mask.get_shape().at(0), sequence_length = attention_mask.get_shape().at(1);
+    const size_t next_batch_size = m_next_beams.size();
+    const ov::Shape next_shape{next_batch_size, sequence_length + 1};
+
+    bool is_reordered = next_batch_size > batch_size;
+    for (size_t beam_id = 0; beam_id < next_batch_size && !is_reordered; ++beam_id) {
+        is_reordered = m_next_beams[beam_id] != static_cast<int32_t>(beam_id);
+    }
+
+    if (!is_reordered) {
+        // rows are moved to their new offsets starting from the last one, so that none is overwritten before being moved
+        const bool is_reallocated = reserve_mask(m_current_mask, ov::shape_size(next_shape));
+        ov::Tensor& mask = m_attention_masks[m_current_mask];
+        mask.set_shape(next_shape);
+        int64_t* mask_data = mask.data<int64_t>();
+        for (size_t beam_id = next_batch_size; beam_id-- > 0;) {
+            std::memmove(mask_data + beam_id * (sequence_length + 1), mask_data + beam_id * sequence_length, sequence_length * sizeof(int64_t));
+            mask_data[beam_id * (sequence_length + 1) + sequence_length] = 1;
+        }
+        if (is_reallocated)
+            llm.set_tensor("attention_mask", mask);
+    } else {
+        const size_t next_mask = 1 - m_current_mask;
+        reserve_mask(next_mask, ov::shape_size(next_shape));
+        m_attention_masks[next_mask].set_shape(next_shape);
+        const int64_t* src = attention_mask.data<const int64_t>();
+        int64_t* dst = m_attention_masks[next_mask].data<int64_t>();
+        for (size_t beam_id = 0; beam_id < next_batch_size; ++beam_id) {
+            std::copy_n(src + m_next_beams[beam_id] * sequence_length, sequence_length, dst + beam_id * (sequence_length + 1));
+            dst[beam_id * (sequence_length + 1) + sequence_length] = 1;
+        }
+        m_current_mask = next_mask;
+        llm.set_tensor("attention_mask", m_attention_masks[m_current_mask]);
+    }
+
+    m_next_num_attended_tokens.clear();
+    for (int32_t beam : m_next_beams) {
+        m_next_num_attended_tokens.push_back(m_num_attended_tokens.at(beam) + 1);
+    }
+
+    if (m_has_3d_position_ids) {
+        m_position_ids.set_shape({3, next_batch_size, 1});
+        std::fill_n(m_position_ids.data<int64_t>(), m_position_ids.get_size(), static_cast<int64_t>(sequence_length) + m_rope_delta);
+    } else if (m_has_position_ids) {
+        m_position_ids.set_shape({next_batch_size, 1});
+        for (size_t beam_id = 0; beam_id < next_batch_size; ++beam_id) {
+            m_position_ids.data<int64_t>()[beam_id] = m_next_num_attended_tokens[beam_id] - 1;
+        }
+    }
+    std::swap(m_num_attended_tokens, m_next_num_attended_tokens);
+
+    m_beam_idx.set_shape({next_batch_size});
+    std::copy(m_next_beams.begin(), m_next_beams.end(), m_beam_idx.data<int32_t>());
+}
 
 ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     ov::InferRequest& m_llm,
@@ -85,7 +275,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     KVCacheState& kv_cache_state,
     std::optional<EmbeddingsModel> m_embedding,
     std::optional<int64_t> rope_delta,
-    const size_t max_kv_cache_size
+    const size_t max_kv_cache_size,
+    const size_t prefill_chunk_size,
+    const std::optional<SlidingWindowKVCache>& sliding_window_kv_cache
 ) {
     std::vector<GenerationHandle> generations;
     for (SequenceGroup::Ptr sequence_group : sequence_groups) {
@@ -134,15 +326,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
     // Initialize inputs
 
-    if (m_embedding.has_value()) {
-        m_llm.set_tensor("inputs_embeds", input_ids);
-    } else {
+    if (!m_embedding.has_value()) {
         kv_cache_state.add_inputs(input_ids);
-        m_llm.set_tensor("input_ids", input_ids);
     }
-    m_llm.set_tensor("attention_mask", attention_mask);
-    if (position_ids.has_value())
-        m_llm.set_tensor("position_ids", *position_ids);
 
     ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {batch_size});
     std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
@@ -150,10 +336,17 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
     // "Prompt" phase
 
-    const auto infer_start = std::chrono::steady_clock::now();
-    m_llm.infer();
+    float infer_ms = 0.f;
+    // attention mask of KV cache after the prompt, which is shorter than the given one if tokens are evicted
+    ov::Tensor prompt_attention_mask = attention_mask;
+    if (sliding_window_kv_cache.has_value()) {
+        OPENVINO_ASSERT(!m_embedding.has_value(), "Sliding window of KV cache isn't supported for inputs embeddings");
+        std::tie(infer_ms, prompt_attention_mask) = infer_prompt_with_sliding_window(
+            m_llm, input_ids, attention_mask, position_ids.has_value(), prefill_chunk_size, *sliding_window_kv_cache, kv_cache_state);
+    } else {
+        infer_ms = infer_prompt(m_llm, m_embedding.has_value() ? "inputs_embeds" : "input_ids", input_ids, attention_mask, position_ids, prefill_chunk_size);
+    }
     const auto infer_end = std::chrono::steady_clock::now();
-    const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
     raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
     raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
     raw_perf_counters.m_new_token_times.emplace_back(infer_end);
@@ -176,6 +369,21 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
     // "Generation" phase
 
+    // the mask is reserved for the whole generation if it's short enough, otherwise it grows on demand
+    constexpr size_t max_reserved_new_tokens = 4096;
+    size_t max_batch_size = batch_size, max_new_tokens = 0;
+    for (auto& sequence_group : sequence_groups) {
+        const GenerationConfig& config = sequence_group->get_sampling_parameters();
+        max_batch_size = std::max(max_batch_size, config.is_beam_search() ? config.num_beams : config.num_return_sequences);
+        max_new_tokens = std::max(max_new_tokens, sequence_group->get_max_new_tokens());
+    }
+    max_batch_size *= sequence_groups.size();
+    size_t max_sequence_length = prompt_attention_mask.get_shape().at(1) + std::min(max_new_tokens, max_reserved_new_tokens);
+    if (sliding_window_kv_cache.has_value())
+        max_sequence_length = std::min(max_sequence_length, sliding_window_kv_cache->get_capacity() + 1);
+    GenerationStepInputs step_inputs(prompt_attention_mask, position_ids, rope_delta, max_batch_size, max_sequence_length);
+    step_inputs.set_to(m_llm, !m_embedding.has_value());
+
     while (!active_sequence_groups.empty()) {
         size_t total_num_tokens = 0;
 
@@ -186,22 +394,25 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
             total_num_tokens += sequence_group->get_num_scheduled_tokens() * num_sequences;
         }
 
-        ov::Tensor new_input_ids(ov::element::i64, {total_num_tokens, 1});
+        ov::Tensor& new_input_ids = step_inputs.get_input_ids(total_num_tokens);
         int64_t * input_ids_data = new_input_ids.data<int64_t>();
 
-        std::vector<int32_t> next_beams;
+        std::vector<int32_t>& next_beams = step_inputs.get_next_beams();
         size_t current_batch_size = 0;
 
         for (auto& sequence_group : active_sequence_groups) {
-            std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
-            size_t num_running_sequences = running_sequences.size();
+            size_t num_running_sequences = sequence_group->num_running_seqs();
             size_t num_scheduled_tokens = sequence_group->get_num_scheduled_tokens();
             size_t group_position_id = sequence_group->get_num_processed_tokens();
 
-            std::map<size_t, int32_t> beam_idxs = sampler.get_beam_idxs(sequence_group);
+            // sequences of other decoding types continue the only row of their group
+            std::map<size_t, int32_t> beam_idxs;
+            if (sequence_group->get_sampling_parameters().is_beam_search())
+                beam_idxs = sampler.get_beam_idxs(sequence_group);
 
-            for (size_t seq_id = 0; seq_id < num_running_sequences; ++seq_id) {
-                Sequence::CPtr sequence = running_sequences[seq_id];
+            for (const auto& sequence : sequence_group->get_sequences()) {
+                if (!sequence->is_running())
+                    continue;
 
                 for (size_t token_id = 0, position_id = group_position_id; token_id < num_scheduled_tokens; ++token_id, ++position_id) {
                     // compute token for current sequence
@@ -214,7 +425,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
                 input_ids_data += num_scheduled_tokens;
 
                 // for different sequences iteration of beams started from 0, but we collect it to one input_ids
-                next_beams.push_back(beam_idxs[sequence->get_id()] + beam_offets.at(sequence_group->get_request_id()));
+                auto beam_idx_it = beam_idxs.find(sequence->get_id());
+                const int32_t beam_idx = beam_idx_it == beam_idxs.end() ? 0 : beam_idx_it->second;
+                next_beams.push_back(beam_idx + beam_offets.at(sequence_group->get_request_id()));
             }
 
             current_batch_size += num_running_sequences;
@@ -228,8 +441,16 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
             constexpr bool return_remote_tensor = true;
             const ov::Tensor& embed_prompt_tensor = (*m_embedding).infer(new_input_ids, return_remote_tensor);
             m_llm.set_tensor("inputs_embeds", embed_prompt_tensor);
-        } else {
-            m_llm.set_tensor("input_ids", new_input_ids);
+        }
+
+        // the oldest tokens of the window are evicted before the new token is added to full KV cache
+        if (sliding_window_kv_cache.has_value()) {
+            const size_t num_tokens_to_evict = sliding_window_kv_cache->get_num_tokens_to_evict(step_inputs.get_kv_cache_len(), 1);
+            if (num_tokens_to_evict > 0) {
+                sliding_window_kv_cache->evict(m_llm, num_tokens_to_evict);
+                step_inputs.evict(m_llm, sliding_window_kv_cache->get_num_sink_tokens(), num_tokens_to_evict);
+                kv_cache_state.evict(sliding_window_kv_cache->get_num_sink_tokens(), num_tokens_to_evict);
+            }
         }
 
         // we don't need to keep state for non chat mode and for beam_search in chat mode
@@ -238,17 +459,7 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         if (new_input_ids.get_size() == 1)
             kv_cache_state.add_inputs(new_input_ids);
 
-        update_attention_mask_with_beams(m_llm.get_tensor("attention_mask"), next_beams);
-
-        if (position_ids.has_value()) {
-            if (position_ids->get_shape().size() == 3 && rope_delta.has_value()) {
-                update_3d_position_ids(m_llm.get_tensor("position_ids"), m_llm.get_tensor("attention_mask"), rope_delta.value());
-            } else {
-                update_position_ids(m_llm.get_tensor("position_ids"), m_llm.get_tensor("attention_mask"));
-            }
-        }
-
-        m_llm.set_tensor("beam_idx", ov::Tensor{ov::element::i32, {total_num_tokens}, next_beams.data()});
+        step_inputs.update(m_llm);
 
         const auto infer_start = std::chrono::steady_clock::now();
         m_llm.start_async();
@@ -298,9 +509,174 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 }
 
 
+ov::genai::utils::GenerationFinishInfo get_lm_encoded_results_with_candidates(
+    ov::InferRequest& m_llm,
+    const ov::Tensor& input_ids,
+    const ov::Tensor& attention_mask,
+    const std::shared_ptr<StreamerBase>& streamer_ptr,
+    Sampler& sampler,
+    SequenceGroup::Ptr sequence_group,
+    std::optional<ov::Tensor> position_ids,
+    KVCacheState& kv_cache_state,
+    StatefulDrafter& drafter,
+    size_t kv_cache_seq_length_axis,
+    std::optional<AdapterController> adapter_controller,
+    const size_t prefill_chunk_size
+) {
+    OPENVINO_ASSERT(input_ids.get_shape().at(0) == 1, "Assisting generation in the stateful pipeline supports only batch size 1");
+    const GenerationConfig& config = sequence_group->get_sampling_parameters();
+    OPENVINO_ASSERT(config.num_return_sequences == 1 && (config.is_greedy_decoding() || config.is_multinomial()),
+        "Assisting generation in the stateful pipeline supports only greedy and multinomial decoding with a single return sequence");
+
+    GenerationHandle handle = std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), config);
+
+    auto stream_generated_tokens = [&streamer_ptr, &handle]() {
+        if (streamer_ptr && handle->can_read()) {
+            std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read();
+            OPENVINO_ASSERT(generation_outputs.size() <= 1);
+            if (!generation_outputs.empty()) {
+                auto streaming_status = streamer_ptr->write(generation_outputs.begin()->second.generated_ids);
+                if (streaming_status != ov::genai::StreamingStatus::RUNNING) {
+                    streaming_status == ov::genai::StreamingStatus::CANCEL ? handle->cancel() : handle->stop();
+                }
+            }
+        }
+    };
+
+    auto is_running = [&sequence_group]() {
+        return !sequence_group->has_finished() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled();
+    };
+
+    // Initialize results and performance metrics.
+
+    ov::genai::utils::GenerationFinishInfo finish_info;
+    auto& raw_perf_counters = finish_info.results.perf_metrics.raw_metrics;
+    raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
+
+    // Initialize inputs
+
+    kv_cache_state.add_inputs(input_ids);
+
+    ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+    m_llm.set_tensor("beam_idx", beam_idx);
+
+    // "Prompt" phase: logits are computed for the last prompt token only
+
+    constexpr bool has_sampled_tokens_indices = true;
+    const auto infer_ms = infer_prompt(m_llm, "input_ids", input_ids, attention_mask, position_ids, prefill_chunk_size, has_sampled_tokens_indices);
+    const auto infer_end = std::chrono::steady_clock::now();
+    raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
+    raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+    raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+    raw_perf_counters.m_batch_sizes.emplace_back(1);
+
+    sequence_group->schedule_tokens(sequence_group->get_prompt_len());
+    sequence_group->set_output_seq_len(1);
+    sampler.sample({sequence_group}, m_llm.get_tensor("logits"));
+
+    drafter.start(config);
+    const size_t prompt_len = sequence_group->get_prompt_len();
+    // validated tokens of the sequence
+    TokenIds tokens = sequence_group->get_prompt_ids();
+
+    // "Generation" phase
+
+    while (is_running()) {
+        Sequence::Ptr sequence = sequence_group->get_running_sequences().at(0);
+        const TokenIds& generated_ids = sequence->get_generated_ids();
+        const size_t generated_len = generated_ids.size();
+        tokens.insert(tokens.end(), generated_ids.begin() + (tokens.size() - prompt_len), generated_ids.end());
+
+        // the token following the last candidate is generated by the main model anyway
+        const size_t max_num_candidates = !config.is_assisting_generation() ? 0 :
+            std::min(sequence_group->get_max_new_tokens() - generated_len - 1,
+                     config.num_assistant_tokens > 0 ? config.num_assistant_tokens : std::numeric_limits<size_t>::max());
+        const TokenIds candidates = drafter.get_candidates(tokens, config, max_num_candidates);
+        for (int64_t candidate : candidates) {
+            sequence->append_token(candidate, 0.f);
+        }
+        sequence_group->set_num_validated_tokens(candidates.size());
+
+        // the last validated token, which is not in KV cache yet, followed by candidates
+        const size_t num_scheduled_tokens = sequence_group->get_num_available_tokens_for_batching();
+        OPENVINO_ASSERT(num_scheduled_tokens == candidates.size() + 1);
+        sequence_group->schedule_tokens(num_scheduled_tokens);
+        const size_t kv_cache_len = sequence_group->get_num_processed_tokens();
+
+        ov::Tensor new_input_ids(ov::element::i64, {1, num_scheduled_tokens});
+        for (size_t token_id = 0, position_id = kv_cache_len; token_id < num_scheduled_tokens; ++token_id, ++position_id) {
+            new_input_ids.data<int64_t>()[token_id] = position_id < prompt_len ?
+                sequence_group->get_prompt_ids()[position_id] :
+                sequence->get_generated_ids()[position_id - prompt_len];
+        }
+        m_llm.set_tensor("input_ids", new_input_ids);
+        kv_cache_state.add_inputs(new_input_ids);
+
+        // attention mask of KV cache, which may still contain rejected candidates of the previous step, is kept as is
+        ov::Tensor prev_attention_mask = m_llm.get_tensor("attention_mask");
+        ov::Tensor new_attention_mask(ov::element::i64, {1, kv_cache_len + num_scheduled_tokens});
+        std::copy_n(prev_attention_mask.data<const int64_t>(), kv_cache_len, new_attention_mask.data<int64_t>());
+        std::fill_n(new_attention_mask.data<int64_t>() + kv_cache_len, num_scheduled_tokens, 1);
+        m_llm.set_tensor("attention_mask", new_attention_mask);
+
+        if (position_ids.has_value()) {
+            ov::Tensor new_position_ids(ov::element::i64, {1, num_scheduled_tokens});
+            std::iota(new_position_ids.data<int64_t>(), new_position_ids.data<int64_t>() + num_scheduled_tokens, static_cast<int64_t>(kv_cache_len));
+            m_llm.set_tensor("position_ids", new_position_ids);
+        }
+
+        ov::Tensor new_sampled_tokens_indices(ov::element::i64, {num_scheduled_tokens});
+        std::iota(new_sampled_tokens_indices.data<int64_t>(), new_sampled_tokens_indices.data<int64_t>() + num_scheduled_tokens, 0);
+        m_llm.set_tensor("sampled_tokens_indices", new_sampled_tokens_indices);
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        m_llm.start_async();
+
+        stream_generated_tokens();
+
+        m_llm.wait();
+
+        const auto infer_end = std::chrono::steady_clock::now();
+        const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+        raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
+        raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+        raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+
+        sampler.sample({sequence_group}, m_llm.get_tensor("logits"), true);
+        // a step generates accepted candidates and a token of the main model
+        raw_perf_counters.m_batch_sizes.emplace_back(std::max(sequence->get_generated_len(), generated_len + 1) - generated_len);
+
+        // sampler rolls the number of processed tokens back to the last accepted candidate
+        const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+        const size_t new_kv_cache_len = kv_cache_len + num_scheduled_tokens;
+        OPENVINO_ASSERT(num_processed_tokens <= new_kv_cache_len);
+        ov::genai::utils::trim_kv_cache(m_llm, new_kv_cache_len - num_processed_tokens, kv_cache_seq_length_axis, adapter_controller);
+        kv_cache_state.get_state().resize(kv_cache_state.get_state().size() - (new_kv_cache_len - num_processed_tokens));
+        m_llm.get_tensor("attention_mask").set_shape({1, num_processed_tokens});
+    }
+
+    stream_generated_tokens();
+    if (streamer_ptr) { // push streamer's cache
+        streamer_ptr->end();
+    }
+
+    const auto& sequences = sequence_group->get_finished_sequences();
+    if (!sequences.empty()) {
+        finish_info.results.tokens.push_back(sequences[0]->get_generated_ids());
+        finish_info.results.scores.push_back(sequences[0]->get_cumulative_log_prob());
+    }
+    finish_info.streaming_finish_status = sequence_group->get_generation_stream()->get_status();
+
+    sampler.clear_request_info(sequence_group->get_request_id());
+
+    return finish_info;
+}
+
 TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, KVCacheState& kv_cache_state) {
     TokenizedInputs encoded_input;
-    size_t kv_cache_len = kv_cache_state.get_state().size();
+    // tokens evicted from KV cache precede the new ones in the history as well
+    size_t kv_cache_len = kv_cache_state.get_state().size() + kv_cache_state.get_evicted_tokens().size();
     if (kv_cache_len == 0) {
         encoded_input.input_ids = new_chat_tokens;
         ov::Tensor new_attention_mask(ov::element::i64, new_chat_tokens.get_shape());
@@ -340,10 +716,34 @@ void align_kv_cache_and_history(ov::genai::KVCacheTrimManager& kv_history_manage
     if (state.empty())
         return;
 
-    size_t first_diverse_tokens_idx = ov::genai::utils::get_first_history_difference(new_chat_tokens, state);
+    const std::vector<int64_t>& evicted_tokens = kv_cache_state.get_evicted_tokens();
+    size_t first_diverse_tokens_idx = 0;
+    if (evicted_tokens.empty()) {
+        first_diverse_tokens_idx = ov::genai::utils::get_first_history_difference(new_chat_tokens, state);
+    } else {
+        // the history of KV cache is its sink tokens followed by the evicted ones and the rest of the state
+        const size_t num_sink_tokens = kv_cache_state.get_num_sink_tokens();
+        std::vector<int64_t> history(state.begin(), state.begin() + num_sink_tokens);
+        history.insert(history.end(), evicted_tokens.begin(), evicted_tokens.end());
+        history.insert(history.end(), state.begin() + num_sink_tokens, state.end());
+        const size_t first_diverse_history_idx = std::min(ov::genai::utils::get_first_history_difference(new_chat_tokens, history),
+                                                          new_chat_tokens.get_size() - 1);
+        if (first_diverse_history_idx >= num_sink_tokens + evicted_tokens.size()) {
+            first_diverse_tokens_idx = first_diverse_history_idx - evicted_tokens.size();
+        } else {
+            // nothing of the window is kept, so the rest of the history follows the sink tokens again
+            first_diverse_tokens_idx = std::min(first_diverse_history_idx, num_sink_tokens);
+            kv_cache_state.reset_evicted_tokens();
+        }
+    }
+    // the template may re-render the whole history, e.g. so that it's a prefix of the cached tokens,
+    // keep at least one token of the new history to be inferred, since logits of its last token are required
+    first_diverse_tokens_idx = std::min(first_diverse_tokens_idx, new_chat_tokens.get_size() - 1);
     // in the case of beam_search the longest answer is in the kv cache, but the best one is needed
-    // so generated tokens were not added to KVCacheState and num_tokens_to_trim was set to the size of the generated serquence
-    kv_history_manager.num_tokens_to_trim = kv_history_manager.num_tokens_to_trim > 0 ? kv_history_manager.num_tokens_to_trim : (state.size() - first_diverse_tokens_idx);
+    // so generated tokens were not added to KVCacheState and num_tokens_to_trim was set to the size of the generated serquence.
+    // KV cache is trimmed exactly to the longest common prefix of the cached tokens and the new history,
+    // so only the divergent tail is recomputed
+    kv_history_manager.num_tokens_to_trim += state.size() - first_diverse_tokens_idx;
     state.resize(first_diverse_tokens_idx);
 }
 
@@ -1,26 +1,59 @@
 #pragma once
 
+#include <array>
 #include <optional>
 #include "openvino/genai/llm_pipeline.hpp"
 #include "visual_language/embedding_model.hpp"
 #include "sampler.hpp"
+#include "sliding_window_kv_cache.hpp"
 
 namespace ov {
 namespace genai {
 
+class StatefulDrafter;
+
 class KVCacheState {
     std::vector<int64_t> state;
+    // tokens evicted by the sliding window of KV cache, they follow the sink ones in the history, but not in the state
+    size_t num_sink_tokens = 0;
+    std::vector<int64_t> evicted_tokens;
 public:
     std::vector<int64_t>& get_state() {
         return state;
     }
 
+    const std::vector<int64_t>& get_state() const {
+        return state;
+    }
+
     void add_inputs(const ov::Tensor& inputs_ids) {
         std::copy_n(inputs_ids.data<int64_t>(), inputs_ids.get_size(), std::back_inserter(state));
     }
 
+    // mirrors `SlidingWindowKVCache::evict`
+    void evict(size_t sink_tokens, size_t num_tokens) {
+        OPENVINO_ASSERT(state.size() >= sink_tokens + num_tokens);
+        num_sink_tokens = sink_tokens;
+        evicted_tokens.insert(evicted_tokens.end(), state.begin() + sink_tokens, state.begin() + sink_tokens + num_tokens);
+        state.erase(state.begin() + sink_tokens, state.begin() + sink_tokens + num_tokens);
+    }
+
+    size_t get_num_sink_tokens() const {
+        return num_sink_tokens;
+    }
+
+    const std::vector<int64_t>& get_evicted_tokens() const {
+        return evicted_tokens;
+    }
+
+    // the history is contiguous in KV cache again, e.g. after the state is trimmed to the sink tokens
+    void reset_evicted_tokens() {
+        evicted_tokens.clear();
+    }
+
     void reset_state() {
-        return state.clear();
+        state.clear();
+        evicted_tokens.clear();
     }
 };
 
@@ -36,10 +69,80 @@ struct KVCacheTrimManager
 };
 
 
+/**
+ * Inputs of generation steps allocated for the max batch size and updated in place by each step.
+ * Attention mask reserves columns for generated tokens: a step appends a column without reallocation and moves rows
+ * only if the batch has several sequences. Position ids are tracked per row instead of being summed up from the mask.
+ */
+class GenerationStepInputs {
+    ov::Tensor m_input_ids, m_position_ids, m_beam_idx;
+    // reordering of beams copies rows of the mask to the other buffer
+    std::array<ov::Tensor, 2> m_attention_masks;
+    size_t m_current_mask = 0;
+    // number of elements allocated for each buffer of the mask
+    std::array<size_t, 2> m_mask_capacities{};
+    // number of attended tokens of each row, i.e. position id of its next token
+    std::vector<int64_t> m_num_attended_tokens, m_next_num_attended_tokens;
+    std::vector<int32_t> m_next_beams;
+    bool m_has_position_ids, m_has_3d_position_ids;
+    int64_t m_rope_delta;
+
+    // returns true if the buffer is reallocated
+    bool reserve_mask(size_t mask_id, size_t num_elements);
+
+public:
+    GenerationStepInputs(const ov::Tensor& attention_mask,
+                         const std::optional<ov::Tensor>& position_ids,
+                         std::optional<int64_t> rope_delta,
+                         size_t max_batch_size,
+                         size_t max_sequence_length);
+
+    // sets inputs of generation steps to the request, input ids are set only if `set_input_ids`
+    void set_to(ov::InferRequest& llm, bool set_input_ids);
+
+    // number of tokens in KV cache, including the ones of the current step after `update`
+    size_t get_kv_cache_len() const {
+        return m_attention_masks[m_current_mask].get_shape().at(1);
+    }
+
+    // removes columns [begin, begin + num_tokens) of the mask evicted from KV cache, following positions move back accordingly
+    void evict(ov::InferRequest& llm, size_t begin, size_t num_tokens);
+
+    // returns input ids of the next step to be filled by the caller
+    ov::Tensor& get_input_ids(size_t num_tokens) {
+        m_input_ids.set_shape({num_tokens, 1});
+        return m_input_ids;
+    }
+
+    // returns empty beam indices of the next step to be filled by the caller: a row of KV cache each sequence continues
+    std::vector<int32_t>& get_next_beams() {
+        m_next_beams.clear();
+        return m_next_beams;
+    }
+
+    // updates attention mask, position ids and beam_idx for the next beams
+    void update(ov::InferRequest& llm);
+};
+
+
 ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(ov::InferRequest& m_llm, const ov::Tensor& input_ids, const ov::Tensor& attention_mask,
                                                               const std::shared_ptr<StreamerBase>& streamer_ptr, Sampler& sampler, std::vector<SequenceGroup::Ptr> sequence_groups,
                                                               std::optional<ov::Tensor> position_ids, KVCacheState& m_kv_cache_state, std::optional<EmbeddingsModel> m_embedding,
-                                                              std::optional<int64_t> rope_delta = std::nullopt, const size_t max_kv_cache_size = std::numeric_limits<size_t>::max());
+                                                              std::optional<int64_t> rope_delta = std::nullopt, const size_t max_kv_cache_size = std::numeric_limits<size_t>::max(),
+                                                              const size_t prefill_chunk_size = 0,
+                                                              const std::optional<SlidingWindowKVCache>& sliding_window_kv_cache = std::nullopt);
+
+
+/**
+ * Generates tokens of a single sequence group with assisting generation: each step the main model validates
+ * candidates of `drafter` by a single inference, KV cache of rejected candidates is trimmed.
+ * Main model must be transformed by `apply_gather_before_matmul_transformation`.
+ */
+ov::genai::utils::GenerationFinishInfo get_lm_encoded_results_with_candidates(ov::InferRequest& m_llm, const ov::Tensor& input_ids, const ov::Tensor& attention_mask,
+                                                                              const std::shared_ptr<StreamerBase>& streamer_ptr, Sampler& sampler, SequenceGroup::Ptr sequence_group,
+                                                                              std::optional<ov::Tensor> position_ids, KVCacheState& m_kv_cache_state, StatefulDrafter& drafter,
+                                                                              size_t kv_cache_seq_length_axis, std::optional<AdapterController> adapter_controller,
+                                                                              const size_t prefill_chunk_size = 0);
 
 
 void align_kv_cache_and_history(ov::genai::KVCacheTrimManager& kv_history_manager, const ov::Tensor& new_chat_tokens, KVCacheState& kv_cache_state);
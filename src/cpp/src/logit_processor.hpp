@@ -381,6 +381,13 @@ public:
         }
     }
 
+    // false if `apply` leaves logits unchanged at the current generated length, so tokens can be picked from raw logits
+    bool has_applicable_transformers() {
+        return std::any_of(m_logit_transformers.begin(), m_logit_transformers.end(), [this](const auto& transformer) {
+            return transformer->is_applicable(m_generated_tokens);
+        });
+    }
+
     void update_generated_len(size_t updated_len) {
         m_generated_tokens = updated_len;
     }
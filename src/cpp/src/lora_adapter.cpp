@@ -15,6 +15,7 @@
 #include <unordered_set>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <cmath>
 
 #include "openvino/op/add.hpp"
@@ -875,6 +876,8 @@ public:
     DerivedAdapterImpl(const std::shared_ptr<AdapterImpl>& origin, const Derivation& derivation) : origin(origin), derivation(derivation) {}
 
     const LoRATensors& get_tensors() const override {
+        // sub-models of a pipeline are loaded in parallel, so they may request tensors of the same adapter at once
+        std::lock_guard<std::mutex> lock(tensors_mutex);
         if(!tensors) {
             tensors = derivation(origin->get_tensors());
         }
@@ -893,6 +896,7 @@ private:
     std::shared_ptr<AdapterImpl> origin;
     Derivation derivation;
     mutable std::optional<LoRATensors> tensors;
+    mutable std::mutex tensors_mutex;
 };
 
 
@@ -0,0 +1,137 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "model_registry.hpp"
+
+#include <algorithm>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+#include "utils.hpp"
+
+namespace {
+
+// keeps the read model alive while its clone is used
+struct ModelClone {
+    std::shared_ptr<ov::Model> origin;
+    std::shared_ptr<ov::Model> clone;
+};
+
+std::shared_ptr<ov::Model> clone_model(const std::shared_ptr<ov::Model>& origin) {
+    auto model_clone = std::make_shared<ModelClone>(ModelClone{origin, origin->clone()});
+    return std::shared_ptr<ov::Model>(model_clone, model_clone->clone.get());
+}
+
+// keeps the model alive while its compiled model is used, so the model read by the registry stays shared
+struct CompiledModelLease {
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiled_model;
+};
+
+std::string get_model_key(const std::filesystem::path& model_path, const ov::AnyMap& properties) {
+    const std::filesystem::path canonical_path = std::filesystem::canonical(model_path);
+    std::filesystem::path weights_path = canonical_path;
+    weights_path.replace_extension(".bin");
+
+    // NB: a file rewritten since it was read is read again
+    std::string key = canonical_path.string() + ":" +
+        std::to_string(std::filesystem::last_write_time(canonical_path).time_since_epoch().count());
+    if (std::filesystem::exists(weights_path)) {
+        key += ":" + std::to_string(std::filesystem::last_write_time(weights_path).time_since_epoch().count());
+    }
+    // only mmap affects how the IR is read
+    auto enable_mmap_it = properties.find(ov::enable_mmap.name());
+    if (enable_mmap_it != properties.end()) {
+        key += ":mmap=" + enable_mmap_it->second.as<std::string>();
+    }
+    return key;
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+ModelRegistry& ModelRegistry::get() {
+    static ModelRegistry registry;
+    return registry;
+}
+
+std::shared_ptr<ov::Model> ModelRegistry::read_model(const std::filesystem::path& model_path, const ov::AnyMap& properties) {
+    const std::string key = get_model_key(model_path, properties);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto model = m_models[key].lock()) {
+            return clone_model(model);
+        }
+    }
+
+    // NB: models are read out of the lock, so pipelines reading different models don't wait for each other
+    auto model = singleton_core().read_model(model_path, {}, properties);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // another pipeline may have read the same model meanwhile, its copy is kept
+    std::weak_ptr<ov::Model>& entry = m_models[key];
+    if (auto registered_model = entry.lock()) {
+        model = registered_model;
+    } else {
+        entry = model;
+    }
+    return clone_model(model);
+}
+
+std::shared_ptr<ov::CompiledModel> ModelRegistry::compile_model(const std::shared_ptr<ov::Model>& model,
+                                                                const std::string& device,
+                                                                const ov::AnyMap& properties) {
+    const std::optional<std::string> key = get_compiled_model_cache_key(model, device, properties);
+    if (!key.has_value()) {
+        return std::make_shared<ov::CompiledModel>(utils::singleton_core().compile_model(model, device, properties));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto compiled_model = m_compiled_models[*key].lock()) {
+            return compiled_model;
+        }
+    }
+
+    auto lease = std::make_shared<CompiledModelLease>(CompiledModelLease{model, utils::singleton_core().compile_model(model, device, properties)});
+    auto compiled_model = std::shared_ptr<ov::CompiledModel>(lease, &lease->compiled_model);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::weak_ptr<ov::CompiledModel>& entry = m_compiled_models[*key];
+    if (auto registered_compiled_model = entry.lock()) {
+        return registered_compiled_model;
+    }
+    entry = compiled_model;
+    return compiled_model;
+}
+
+template <typename T>
+size_t ModelRegistry::get_num_alive(const std::map<std::string, std::weak_ptr<T>>& entries) {
+    return static_cast<size_t>(std::count_if(entries.begin(), entries.end(), [](const auto& entry) {
+        return !entry.second.expired();
+    }));
+}
+
+size_t ModelRegistry::get_num_models() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_num_alive(m_models);
+}
+
+size_t ModelRegistry::get_num_compiled_models() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_num_alive(m_compiled_models);
+}
+
+std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path, const ov::AnyMap& properties) {
+    auto share_models_it = properties.find(ov::genai::share_models.name());
+    if (share_models_it != properties.end() && share_models_it->second.as<bool>()) {
+        return ModelRegistry::get().read_model(model_path, properties);
+    }
+    return singleton_core().read_model(model_path, {}, properties);
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * @brief Process-wide registry of models shared by pipelines, see `ov::genai::share_models` property.
+ * The registry holds only weak references: a model is released when the last pipeline using it is destroyed,
+ * and reading or compiling it afterwards starts over.
+ */
+class ModelRegistry {
+    std::mutex m_mutex;
+    std::map<std::string, std::weak_ptr<ov::Model>> m_models;
+    std::map<std::string, std::weak_ptr<ov::CompiledModel>> m_compiled_models;
+
+    template <typename T>
+    static size_t get_num_alive(const std::map<std::string, std::weak_ptr<T>>& entries);
+
+public:
+    static ModelRegistry& get();
+
+    /**
+     * @brief Reads the model file once per file version and returns a clone of the read model for each call.
+     * Clones share weights of the read model, so pipelines are free to transform them.
+     * The read model is alive while any of its clones is alive.
+     */
+    std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path, const ov::AnyMap& properties);
+
+    /**
+     * @brief Compiles the model once per key of `get_compiled_model_cache_key` and returns the same compiled model
+     * to all callers. The compiled model is alive while the caller keeps the returned pointer, so a pipeline has to keep it
+     * as long as it uses the compiled model. The compiled model keeps the model alive as well, so pipelines reading the model
+     * later get the same weights. Models without a key (see `get_compiled_model_cache_key`) aren't shared.
+     */
+    std::shared_ptr<ov::CompiledModel> compile_model(const std::shared_ptr<ov::Model>& model,
+                                                     const std::string& device,
+                                                     const ov::AnyMap& properties);
+
+    size_t get_num_models();
+    size_t get_num_compiled_models();
+};
+
+/**
+ * @brief Reads the model by the singleton core, or by the model registry if `ov::genai::share_models` is set in properties.
+ */
+std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_path, const ov::AnyMap& properties);
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
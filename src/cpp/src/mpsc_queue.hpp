@@ -0,0 +1,78 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Unbounded lock-free multi-producer single-consumer queue.
+ * `push` can be called from any number of threads concurrently, while `try_pop` must be called from a single consumer thread.
+ * Producers never wait for each other or for the consumer: a push is a single atomic exchange.
+ * An element pushed concurrently with `try_pop` may become visible to the consumer on the next `try_pop` call.
+ */
+template <typename T>
+class MPSCQueue {
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    // the most recently pushed node, producers append after it
+    std::atomic<Node*> m_head;
+    // node preceding the oldest element, owned by the consumer
+    Node* m_tail;
+    // number of pushed but not popped elements, incremented before an element is linked
+    std::atomic<size_t> m_size{0};
+
+public:
+    MPSCQueue() {
+        Node* stub = new Node();
+        m_head.store(stub, std::memory_order_relaxed);
+        m_tail = stub;
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    ~MPSCQueue() {
+        T value;
+        while (try_pop(value));
+        delete m_tail;
+    }
+
+    void push(T value) {
+        Node* node = new Node();
+        node->value = std::move(value);
+        m_size.fetch_add(1, std::memory_order_relaxed);
+        Node* prev_head = m_head.exchange(node, std::memory_order_acq_rel);
+        prev_head->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Pops the oldest element, must be called by the consumer thread only.
+     * @return Whether an element was popped.
+     */
+    bool try_pop(T& value) {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+        value = std::move(next->value);
+        // next becomes the new stub node
+        next->value = T{};
+        m_tail = next;
+        delete tail;
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @return Whether there are no pushed elements which are not popped yet. Can be called from any thread.
+     */
+    bool empty() const {
+        return m_size.load(std::memory_order_relaxed) == 0;
+    }
+};
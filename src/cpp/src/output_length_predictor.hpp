@@ -0,0 +1,128 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cmath>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+#include "sequence_group.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Estimates how many tokens a sequence group is going to generate per sequence.
+ * Predictions are used by the Scheduler to size the initial KV cache and to admit new prompts only when the running
+ * requests are expected to fit into the cache until they finish, which reduces the number of preemptions.
+ */
+class OutputLengthPredictor {
+public:
+    using Ptr = std::shared_ptr<OutputLengthPredictor>;
+
+    virtual ~OutputLengthPredictor() = default;
+
+    /**
+     * @param sequence_group The sequence group to predict output length for.
+     * @return Expected total number of generated tokens per sequence. Must not exceed `max_new_tokens` of the group.
+     */
+    virtual size_t predict(const SequenceGroup::CPtr& sequence_group) const = 0;
+
+    /**
+     * Collects statistics of a sequence group which has finished generation.
+     * @param sequence_group The finished sequence group.
+     */
+    virtual void register_finished(const SequenceGroup::CPtr& sequence_group) {}
+};
+
+/**
+ * @brief Predicts output length from running averages of output lengths of previously finished requests sharing
+ * the same prompt prefix (e.g. the same system prompt or few-shot template). If there is no history for the prefix, falls back
+ * to the average over all finished requests and, if there is no history at all, to `prompt_len * (initial_multiplier - 1)`.
+ * All predictions are capped by `max_new_tokens`.
+ */
+class HistoricalOutputLengthPredictor : public OutputLengthPredictor {
+    struct Statistics {
+        float mean = 0.0f;
+        size_t count = 0;
+
+        void update(size_t value) {
+            ++count;
+            mean += (static_cast<float>(value) - mean) / count;
+        }
+    };
+
+    size_t m_prefix_len;
+    size_t m_max_num_prefixes;
+    size_t m_initial_multiplier;
+
+    Statistics m_global_statistics;
+    // LRU of prompt prefix hashes, most recently finished prefixes are in front
+    std::list<size_t> m_prefixes_lru;
+    std::unordered_map<size_t, std::pair<Statistics, std::list<size_t>::iterator>> m_prefix_statistics;
+
+    size_t _get_prefix_hash(const SequenceGroup::CPtr& sequence_group) const {
+        const auto& prompt_ids = sequence_group->get_prompt_ids();
+        size_t prefix_len = std::min(prompt_ids.size(), m_prefix_len);
+        const char* data = reinterpret_cast<const char*>(prompt_ids.data());
+        return std::hash<std::string_view>{}(std::string_view(data, prefix_len * sizeof(prompt_ids[0])));
+    }
+
+public:
+    /**
+     * @param prefix_len Number of leading prompt tokens which identify requests of the same kind.
+     * @param max_num_prefixes Maximum number of distinct prefixes to keep statistics for.
+     * @param initial_multiplier Ratio between total sequence length and prompt length assumed when no history is available.
+     */
+    explicit HistoricalOutputLengthPredictor(size_t prefix_len = 64, size_t max_num_prefixes = 4096, size_t initial_multiplier = 2) :
+        m_prefix_len(prefix_len),
+        m_max_num_prefixes(max_num_prefixes),
+        m_initial_multiplier(initial_multiplier) {
+        OPENVINO_ASSERT(prefix_len > 0, "prefix_len must be non-zero");
+        OPENVINO_ASSERT(initial_multiplier > 0, "initial_multiplier must be non-zero");
+    }
+
+    size_t predict(const SequenceGroup::CPtr& sequence_group) const override {
+        size_t max_new_tokens = sequence_group->get_max_new_tokens();
+        size_t prediction = sequence_group->get_prompt_len() * (m_initial_multiplier - 1);
+
+        auto it = sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS ?
+            m_prefix_statistics.find(_get_prefix_hash(sequence_group)) : m_prefix_statistics.end();
+        if (it != m_prefix_statistics.end()) {
+            prediction = static_cast<size_t>(std::ceil(it->second.first.mean));
+        } else if (m_global_statistics.count > 0) {
+            prediction = static_cast<size_t>(std::ceil(m_global_statistics.mean));
+        }
+
+        return std::min(prediction, max_new_tokens);
+    }
+
+    void register_finished(const SequenceGroup::CPtr& sequence_group) override {
+        size_t generated_len = 0;
+        for (const auto& sequence : sequence_group->get_sequences()) {
+            generated_len = std::max(generated_len, sequence->get_generated_len());
+        }
+        m_global_statistics.update(generated_len);
+
+        if (sequence_group->get_sequence_group_type() != SequenceGroupType::TOKENS)
+            return;
+
+        size_t hash = _get_prefix_hash(sequence_group);
+        auto it = m_prefix_statistics.find(hash);
+        if (it == m_prefix_statistics.end()) {
+            if (m_prefix_statistics.size() >= m_max_num_prefixes) {
+                m_prefix_statistics.erase(m_prefixes_lru.back());
+                m_prefixes_lru.pop_back();
+            }
+            m_prefixes_lru.push_front(hash);
+            it = m_prefix_statistics.emplace(hash, std::make_pair(Statistics{}, m_prefixes_lru.begin())).first;
+        } else {
+            m_prefixes_lru.splice(m_prefixes_lru.begin(), m_prefixes_lru, it->second.second);
+        }
+        it->second.first.update(generated_len);
+    }
+};
+
+}
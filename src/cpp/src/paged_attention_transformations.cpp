@@ -3,6 +3,10 @@
 
 #include "paged_attention_transformations.hpp"
 
+#include <deque>
+#include <set>
+
+#include "openvino/op/add.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/sdpa_to_paged_attention.hpp"
 
@@ -76,6 +80,100 @@ std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<
     return kv_cache_config;
 }
 
+void apply_early_exit_transformation(std::shared_ptr<ov::Model> model, size_t num_layers) {
+    std::map<std::string, std::shared_ptr<ov::op::v0::Parameter>> params;
+    std::set<std::shared_ptr<ov::op::v0::Parameter>> used_params;
+    for (const auto& param_ptr : model->get_parameters()) {
+        params[param_ptr->get_friendly_name()] = param_ptr;
+        if (!param_ptr->get_output_target_inputs(0).empty()) {
+            used_params.insert(param_ptr);
+        }
+    }
+
+    // PagedAttention ops in order of decoder layers
+    std::vector<ov::Node*> pa_ops;
+    for (auto it = params.find("key_cache.0"); it != params.end(); it = params.find("key_cache." + std::to_string(pa_ops.size()))) {
+        pa_ops.push_back(it->second->get_output_target_inputs(0).begin()->get_node());
+    }
+    OPENVINO_ASSERT(!pa_ops.empty(), "Early exit requires a model with paged attention, but key_cache inputs are not found");
+    OPENVINO_ASSERT(num_layers > 0 && num_layers < pa_ops.size(),
+                    "Number of early-exit layers must be in [1, ", pa_ops.size() - 1, "], got ", num_layers);
+    const size_t num_model_layers = pa_ops.size();
+
+    // residual connection of a decoder layer is the first Add after its attention, which adds the residual stream (an Add of the previous layer);
+    // returns the Add and the residual stream input of it
+    auto find_residual_add = [] (ov::Node* pa_op) -> std::pair<std::shared_ptr<ov::Node>, ov::Output<ov::Node>> {
+        std::deque<ov::Node*> nodes{pa_op};
+        std::set<ov::Node*> visited{pa_op};
+        while (!nodes.empty()) {
+            ov::Node* node = nodes.front();
+            nodes.pop_front();
+            for (const auto& output : node->outputs()) {
+                for (const auto& target_input : output.get_target_inputs()) {
+                    ov::Node* consumer = target_input.get_node();
+                    if (!visited.insert(consumer).second) {
+                        continue;
+                    }
+                    const size_t residual_input_index = 1 - target_input.get_index();
+                    if (ov::is_type<ov::op::v1::Add>(consumer) && ov::is_type<ov::op::v1::Add>(consumer->get_input_node_ptr(residual_input_index))) {
+                        return {consumer->shared_from_this(), consumer->input_value(residual_input_index)};
+                    }
+                    nodes.push_back(consumer);
+                }
+            }
+        }
+        return {};
+    };
+
+    // the residual stream before the first removed layer
+    auto [exit_residual_add, exit_hidden_states] = find_residual_add(pa_ops[num_layers]);
+    auto last_residual_add = find_residual_add(pa_ops.back()).first;
+    OPENVINO_ASSERT(exit_residual_add && last_residual_add, "Failed to find residual connections of decoder layers for early exit");
+    // the residual stream after the last layer is an input of the final norm, it's the end of a chain of residual Adds
+    std::shared_ptr<ov::Node> last_hidden_states = last_residual_add;
+    for (bool is_chain_continued = true; is_chain_continued;) {
+        is_chain_continued = false;
+        for (const auto& target_input : last_hidden_states->output(0).get_target_inputs()) {
+            if (ov::is_type<ov::op::v1::Add>(target_input.get_node())) {
+                last_hidden_states = target_input.get_node()->shared_from_this();
+                is_chain_continued = true;
+                break;
+            }
+        }
+    }
+    last_hidden_states->output(0).replace(exit_hidden_states);
+    // removed layers are released when nothing refers to them
+    exit_residual_add.reset();
+    last_residual_add.reset();
+    last_hidden_states.reset();
+
+    // score outputs of removed layers keep them alive
+    std::set<ov::Node*> removed_pa_ops(pa_ops.begin() + num_layers, pa_ops.end());
+    const ov::ResultVector results = model->get_results();
+    for (const auto& result : results) {
+        if (removed_pa_ops.count(result->get_input_node_ptr(0))) {
+            model->remove_result(result);
+        }
+    }
+    removed_pa_ops.clear();
+    pa_ops.clear();
+
+    // KV cache and other per-layer inputs of removed layers
+    for (const auto& param_ptr : used_params) {
+        if (param_ptr->get_output_target_inputs(0).empty()) {
+            model->remove_parameter(param_ptr);
+        }
+    }
+    // removed layers are still referenced if the final norm is not fed by the residual stream of the last layer
+    for (size_t layer = num_layers; layer < num_model_layers; ++layer) {
+        const auto& key_cache = params.at("key_cache." + std::to_string(layer));
+        OPENVINO_ASSERT(key_cache->get_output_target_inputs(0).empty(),
+                        "Early exit is not supported for the model topology: decoder layer ", layer, " is still used after the transformation");
+    }
+
+    model->validate_nodes_and_infer_types();
+}
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -33,6 +33,13 @@ std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<
 
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
+/** Turns a model with paged attention into its early-exit variant: hidden states after the first `num_layers` decoder layers are passed
+ * directly to the final norm and LM head, the remaining layers and their KV cache inputs are removed. Weights are shared with the original model.
+ * @param model Pointer to the ov::Model after `apply_paged_attention_transformations`.
+ * @param num_layers Number of the first decoder layers to keep, less than the number of the model's decoder layers.
+ */
+void apply_early_exit_transformation(std::shared_ptr<ov::Model> model, size_t num_layers);
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,91 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/genai/perf_metrics.hpp"
+#include "threadpool.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * @brief Loads independent sub-models of a pipeline in parallel on a bounded pool of threads and records when each of them
+ * was loaded. Loads run in any order, so they must not depend on each other. The pool is bounded, since plugins parallelize
+ * compilation of each model as well and more concurrent compilations only compete for memory.
+ */
+class ParallelModelLoader {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point m_start_time;
+    std::vector<ModelLoadInterval> m_timeline;
+    std::mutex m_timeline_mutex;
+    std::vector<std::future<void>> m_loads;
+    // the last member, so it waits for running loads before other members are destroyed
+    ThreadPool m_pool;
+
+    static float to_ms(Clock::duration duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+public:
+    static size_t default_max_parallel_loads() {
+        return std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 4);
+    }
+
+    explicit ParallelModelLoader(size_t max_parallel_loads = default_max_parallel_loads())
+        : m_start_time(Clock::now()), m_pool(max_parallel_loads) {}
+
+    void add(const std::string& model_name, std::function<void()> load) {
+        m_loads.push_back(m_pool.submit([this, model_name, load = std::move(load)]() {
+            const Clock::time_point start = Clock::now();
+            load();
+            const Clock::time_point stop = Clock::now();
+
+            std::lock_guard<std::mutex> lock(m_timeline_mutex);
+            m_timeline.push_back({model_name, to_ms(start - m_start_time), to_ms(stop - start)});
+        }));
+    }
+
+    /**
+     * @brief Waits for all added loads and returns their intervals sorted by start time.
+     * If some loads failed, the exception of the first added of them is rethrown after all loads are finished.
+     */
+    std::vector<ModelLoadInterval> wait() {
+        std::exception_ptr error;
+        for (auto& load : m_loads) {
+            try {
+                load.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        m_loads.clear();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        std::vector<ModelLoadInterval> timeline = m_timeline;
+        std::sort(timeline.begin(), timeline.end(), [](const ModelLoadInterval& lhs, const ModelLoadInterval& rhs) {
+            return lhs.start < rhs.start;
+        });
+        return timeline;
+    }
+};
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
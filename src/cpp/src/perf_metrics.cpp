@@ -34,6 +34,10 @@ float PerfMetrics::get_load_time() {
     return load_time;
 }
 
+std::vector<ModelLoadInterval> PerfMetrics::get_load_timeline() {
+    return load_timeline;
+}
+
 size_t PerfMetrics::get_num_generated_tokens() {
     evaluate_statistics();
     return num_generated_tokens;
@@ -44,6 +48,14 @@ size_t PerfMetrics::get_num_input_tokens() {
     return num_input_tokens;
 }
 
+size_t PerfMetrics::get_num_reused_history_tokens() {
+    return num_reused_history_tokens;
+}
+
+size_t PerfMetrics::get_num_recomputed_history_tokens() {
+    return num_recomputed_history_tokens;
+}
+
 MeanStdPair PerfMetrics::get_ttft() {
     evaluate_statistics();
     return ttft;
@@ -168,6 +180,8 @@ PerfMetrics PerfMetrics::operator+(const PerfMetrics& right) const {
 
     res.num_generated_tokens += right.num_generated_tokens;
     res.num_input_tokens += right.num_input_tokens;
+    res.num_reused_history_tokens += right.num_reused_history_tokens;
+    res.num_recomputed_history_tokens += right.num_recomputed_history_tokens;
     res.m_evaluated = false;
     return res;
 }
@@ -17,69 +17,95 @@ ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated
     return result;
 }
 
-TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
-    if (num_pred_tokens == 0) {
-        return std::vector<int64_t>{};
+NGramIndex&
+ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_ngram_index(const SequenceGroup::Ptr& request, const Sequence::Ptr& sequence) {
+    const TokenIds& prompt_ids = request->get_prompt_ids();
+    const TokenIds& generated_ids = sequence->get_generated_ids();
+    const size_t sequence_len = prompt_ids.size() + generated_ids.size();
+
+    auto it = m_ngram_indexes.find(sequence->get_id());
+    if (it != m_ngram_indexes.end()) {
+        // the index is extended only if the indexed tokens are a prefix of the sequence: the prompt doesn't change, so the indexed
+        // generated tokens are compared to the sequence; the index is rebuilt otherwise, e.g. if rejected candidates were replaced
+        // by tokens of the main model or tokens were removed after preemption
+        NGramIndex& ngram_index = it->second;
+        const size_t indexed_len = ngram_index.size();
+        const bool is_prefix = indexed_len <= sequence_len && ngram_index.has_tokens_at(prompt_ids.size(), generated_ids.begin());
+        if (!is_prefix) {
+            m_ngram_indexes.erase(it);
+            it = m_ngram_indexes.end();
+        }
+    }
+    if (it == m_ngram_indexes.end()) {
+        it = m_ngram_indexes.emplace(sequence->get_id(), NGramIndex(request->get_sampling_parameters().max_ngram_size)).first;
+        it->second.append(prompt_ids.begin(), prompt_ids.end());
     }
 
-    const size_t input_length = input_ids.size();
-
-    for (int32_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
-        // extract last ngram_size tokens as search ngram
-        std::vector<int64_t> ngram = std::vector<int64_t>{input_ids.cend() - ngram_size, input_ids.cend()};
-
-        // find ngram match in input_ids
-        size_t ngram_i = 0;
-        for (size_t input_i = 0; input_i < input_length - ngram_size; input_i++) {
-            if (ngram[ngram_i] != input_ids[input_i]) {
-                ngram_i = 0;
-                continue;
-            }
-
-            ngram_i++;
-
-            if (ngram_i < ngram_size) {
-                continue;
-            }
-
-            // match found with the end at input_i
-            size_t avaliable_num_pred = std::min(input_length - (input_i + 1), num_pred_tokens);
+    NGramIndex& ngram_index = it->second;
+    ngram_index.append(generated_ids.begin() + (ngram_index.size() - prompt_ids.size()), generated_ids.end());
+    return ngram_index;
+}
 
-            // return candidates with length of avaliable_num_pred
-            return std::vector<int64_t>{input_ids.cbegin() + input_i + 1,
-                                        input_ids.cbegin() + input_i + 1 + avaliable_num_pred};
-        }
-    }
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::set_datastore(std::shared_ptr<const RetrievalDatastore> datastore) {
+    m_datastore = std::move(datastore);
+}
 
-    return std::vector<int64_t>{};
+const std::map<uint64_t, size_t>&
+ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_num_retrieved_candidates() const {
+    return m_num_retrieved_candidates;
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates() {
+    std::set<uint64_t> running_sequence_ids;
+    m_num_retrieved_candidates.clear();
     for (auto& request : m_requests) {
-        const auto prompt = request->get_prompt_ids();
-        size_t max_validation_len = 0;
-        for (auto& running_sequence : request->get_running_sequences()) {
-            const auto generated_tokens = running_sequence->get_generated_ids();
-            TokenIds full_input_ids = prompt;
-            full_input_ids.insert(full_input_ids.end(), generated_tokens.begin(), generated_tokens.end());
+        const auto& sampling_params = request->get_sampling_parameters();
+        std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
+        std::vector<TokenIds> sequences_candidates(running_sequences.size());
+        size_t max_retrieved_len = 0;
+        for (size_t i = 0; i < running_sequences.size(); ++i) {
+            auto& running_sequence = running_sequences[i];
+            running_sequence_ids.insert(running_sequence->get_id());
 
             size_t min_num_assistant_tokens = 0;
-            const auto sampling_params = request->get_sampling_parameters();
             {
                 const auto generated_len = running_sequence->get_generated_len();
                 const auto left_generated_len = std::min(sampling_params.max_new_tokens, sampling_params.max_length) - generated_len - 1;
                 min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
             }
-            TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
+            const NGramIndex& ngram_index = get_ngram_index(request, running_sequence);
+            TokenIds candidates = ngram_index.find_candidates(min_num_assistant_tokens);
+            if (candidates.empty() && m_datastore) {
+                candidates = m_datastore->find_candidates(ngram_index.get_last_tokens(sampling_params.max_ngram_size),
+                                                          min_num_assistant_tokens, sampling_params.max_ngram_size);
+                max_retrieved_len = std::max(max_retrieved_len, candidates.size());
+            }
+            sequences_candidates[i] = std::move(candidates);
+        }
 
-            if (!candidates.empty()) {
-                for (const auto& candidate : candidates) {
-                    running_sequence->append_token(candidate, 0);
-                }
-                max_validation_len = std::max(max_validation_len, candidates.size());
+        // all sequences of a group (beam search or parallel sampling) are validated by the same number of tokens,
+        // sequences of parallel sampling are forked by sampling of the first token, so nothing is validated before it
+        size_t validation_len = 0;
+        const bool is_validation_possible = !sampling_params.is_multinomial() || sampling_params.num_return_sequences == 1 || request->num_total_seqs() > 1;
+        if (!sequences_candidates.empty() && is_validation_possible) {
+            validation_len = std::min_element(sequences_candidates.begin(), sequences_candidates.end(), [] (const TokenIds& lhs, const TokenIds& rhs) {
+                return lhs.size() < rhs.size();
+            })->size();
+        }
+        for (size_t i = 0; i < running_sequences.size(); ++i) {
+            for (size_t j = 0; j < validation_len; ++j) {
+                running_sequences[i]->append_token(sequences_candidates[i][j], 0);
             }
         }
-        request->set_num_validated_tokens(max_validation_len);
+        request->set_num_validated_tokens(validation_len);
+        if (max_retrieved_len > 0 && validation_len > 0) {
+            m_num_retrieved_candidates[request->get_request_id()] = std::min(max_retrieved_len, validation_len);
+        }
+    }
+
+    // drop indexes of finished sequences
+    for (auto it = m_ngram_indexes.begin(); it != m_ngram_indexes.end();) {
+        it = running_sequence_ids.count(it->first) ? std::next(it) : m_ngram_indexes.erase(it);
     }
 }
 
@@ -88,6 +114,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::is_reque
 }
 
 std::vector<SequenceGroup::Ptr> ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_awaiting_requests() {
+    _take_incoming_requests();
     return m_awaiting_requests;
 }
 
@@ -6,6 +6,8 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "continuous_batching_impl.hpp"
+#include "prompt_lookup/ngram_index.hpp"
+#include "prompt_lookup/retrieval_datastore.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -34,6 +36,16 @@ public:
     using SequenceLen = std::pair<uint64_t, uint64_t>;
     std::map<uint64_t, SequenceLen> get_generated_request_len();
 
+    /**
+     * Sets a datastore to retrieve candidates from if a sequence doesn't contain its last n-gram.
+     */
+    void set_datastore(std::shared_ptr<const RetrievalDatastore> datastore);
+
+    /**
+     * @return Number of candidates retrieved from the datastore by the last `generate_candidates` call, per request.
+     */
+    const std::map<uint64_t, size_t>& get_num_retrieved_candidates() const;
+
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
 
@@ -41,6 +53,11 @@ public:
 
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
-    TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
+    // n-gram index of prompt and generated tokens of each running sequence, updated with new tokens only
+    std::map<uint64_t, NGramIndex> m_ngram_indexes;
+    std::shared_ptr<const RetrievalDatastore> m_datastore;
+    std::map<uint64_t, size_t> m_num_retrieved_candidates;
+
+    NGramIndex& get_ngram_index(const SequenceGroup::Ptr& request, const Sequence::Ptr& sequence);
 };
 }
\ No newline at end of file
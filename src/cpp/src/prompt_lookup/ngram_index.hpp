@@ -0,0 +1,116 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Index of n-grams of a token sequence for prompt lookup decoding.
+ * Tokens are appended incrementally: an append indexes the n-grams ending at the new token in O(max_ngram_size).
+ * A lookup finds the earliest occurrence of the longest n-gram ending the sequence and returns the tokens following it
+ * in O(max_ngram_size), independently of the sequence length.
+ */
+class NGramIndex {
+    size_t m_max_ngram_size;
+    std::vector<int64_t> m_tokens;
+    // for each n-gram size - 1: n-gram hash -> position of the last token of the n-gram's earliest occurrence
+    std::vector<std::unordered_map<uint64_t, size_t>> m_ngram_end_positions;
+
+    static uint64_t combine_hash(uint64_t hash, int64_t token) {
+        return (hash ^ static_cast<uint64_t>(token)) * 0x100000001b3ULL + 0x9e3779b97f4a7c15ULL;
+    }
+
+    // calls `callback(ngram_size, hash)` for n-grams of all sizes ending at `end_position`, from the shortest one
+    template <typename Callback>
+    void for_each_ngram(size_t end_position, Callback callback) const {
+        const size_t max_ngram_size = std::min(m_max_ngram_size, end_position + 1);
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (size_t ngram_size = 1; ngram_size <= max_ngram_size; ++ngram_size) {
+            hash = combine_hash(hash, m_tokens[end_position + 1 - ngram_size]);
+            callback(ngram_size, hash);
+        }
+    }
+
+    bool is_same_ngram(size_t lhs_end_position, size_t rhs_end_position, size_t ngram_size) const {
+        return std::equal(m_tokens.begin() + lhs_end_position + 1 - ngram_size, m_tokens.begin() + lhs_end_position + 1,
+                          m_tokens.begin() + rhs_end_position + 1 - ngram_size);
+    }
+
+public:
+    explicit NGramIndex(size_t max_ngram_size) :
+        m_max_ngram_size(max_ngram_size),
+        m_ngram_end_positions(max_ngram_size) {}
+
+    size_t size() const {
+        return m_tokens.size();
+    }
+
+    int64_t back() const {
+        return m_tokens.back();
+    }
+
+    /**
+     * @return Whether the indexed tokens from `position` to the end are equal to the tokens starting at `begin`.
+     */
+    template <typename Iterator>
+    bool has_tokens_at(size_t position, Iterator begin) const {
+        return std::equal(m_tokens.begin() + std::min(position, m_tokens.size()), m_tokens.end(), begin);
+    }
+
+    std::vector<int64_t> get_last_tokens(size_t num_tokens) const {
+        return std::vector<int64_t>(m_tokens.end() - std::min(num_tokens, m_tokens.size()), m_tokens.end());
+    }
+
+    void append(int64_t token) {
+        m_tokens.push_back(token);
+        const size_t end_position = m_tokens.size() - 1;
+        for_each_ngram(end_position, [&](size_t ngram_size, uint64_t hash) {
+            // keeps the earliest occurrence
+            m_ngram_end_positions[ngram_size - 1].emplace(hash, end_position);
+        });
+    }
+
+    template <typename Iterator>
+    void append(Iterator begin, Iterator end) {
+        for (; begin != end; ++begin) {
+            append(*begin);
+        }
+    }
+
+    /**
+     * @return Up to `num_pred_tokens` tokens following the earliest earlier occurrence of the longest n-gram
+     * (up to `max_ngram_size`) ending the sequence, empty if no n-gram ending the sequence occurs earlier.
+     */
+    std::vector<int64_t> find_candidates(size_t num_pred_tokens) const {
+        if (num_pred_tokens == 0 || m_tokens.empty()) {
+            return {};
+        }
+
+        const size_t last_position = m_tokens.size() - 1;
+        size_t match_end_position = 0, match_ngram_size = 0;
+        for_each_ngram(last_position, [&](size_t ngram_size, uint64_t hash) {
+            const auto& ngram_end_positions = m_ngram_end_positions[ngram_size - 1];
+            auto it = ngram_end_positions.find(hash);
+            // the earliest occurrence is the n-gram ending the sequence itself, if it doesn't occur before
+            if (it == ngram_end_positions.end() || it->second == last_position || !is_same_ngram(it->second, last_position, ngram_size)) {
+                return;
+            }
+            match_end_position = it->second;
+            match_ngram_size = ngram_size;
+        });
+
+        if (match_ngram_size == 0) {
+            return {};
+        }
+        const size_t num_candidates = std::min(last_position - match_end_position, num_pred_tokens);
+        return std::vector<int64_t>(m_tokens.begin() + match_end_position + 1, m_tokens.begin() + match_end_position + 1 + num_candidates);
+    }
+};
+
+}
@@ -44,6 +44,7 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
     candidates_timer.end();
     m_sd_metrics.draft_duration += candidates_timer.get_duration();
     auto generated_len_before = m_pipeline->get_generated_request_len();
+    auto num_retrieved_candidates = m_pipeline->get_num_retrieved_candidates();
 
     ManualTimer main_timer("prompt_lookup_decoding: pipeline: step()");
     main_timer.start();
@@ -70,6 +71,9 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
         }        
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, num_matches);
+        if (num_retrieved_candidates.count(request_id)) {
+            m_sd_metrics.update_retrieval_acceptance(prev_validation_len, num_matches);
+        }
     }
 
     // update perf metrics
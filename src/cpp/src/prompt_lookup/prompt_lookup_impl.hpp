@@ -27,7 +27,12 @@ public:
                      const ov::AnyMap& properties,
                      const ov::genai::GenerationConfig& generation_config) {
         m_tokenizer = tokenizer;
-        m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
+        ov::AnyMap pipeline_properties = properties;
+        auto datastore_path = utils::pop_or_default(pipeline_properties, ov::genai::prompt_lookup_datastore.name(), std::string{});
+        m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, pipeline_properties, generation_config);
+        if (!datastore_path.empty()) {
+            m_pipeline->set_datastore(std::make_shared<RetrievalDatastore>(datastore_path));
+        }
     };
 
     GenerationHandle add_request(uint64_t request_id,
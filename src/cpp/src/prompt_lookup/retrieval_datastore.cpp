@@ -0,0 +1,159 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "prompt_lookup/retrieval_datastore.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+constexpr size_t HEADER_SIZE = sizeof(RetrievalDatastore::MAGIC) + sizeof(uint64_t);
+
+void unmap_file(void* mapped_data, size_t mapped_size) {
+#ifdef _WIN32
+    UnmapViewOfFile(mapped_data);
+#else
+    munmap(mapped_data, mapped_size);
+#endif
+}
+
+}  // namespace
+
+RetrievalDatastore::RetrievalDatastore(const std::filesystem::path& path) {
+    OPENVINO_ASSERT(std::filesystem::is_regular_file(path), "Prompt lookup datastore ", path, " does not exist");
+    m_mapped_size = std::filesystem::file_size(path);
+    OPENVINO_ASSERT(m_mapped_size >= HEADER_SIZE, "Prompt lookup datastore ", path, " is truncated");
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    OPENVINO_ASSERT(file != INVALID_HANDLE_VALUE, "Failed to open prompt lookup datastore ", path);
+    HANDLE file_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    OPENVINO_ASSERT(file_mapping != nullptr, "Failed to map prompt lookup datastore ", path);
+    // the view keeps the mapping alive
+    m_mapped_data = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(file_mapping);
+    OPENVINO_ASSERT(m_mapped_data != nullptr, "Failed to map prompt lookup datastore ", path);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    OPENVINO_ASSERT(fd != -1, "Failed to open prompt lookup datastore ", path);
+    void* mapped_data = mmap(nullptr, m_mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    OPENVINO_ASSERT(mapped_data != MAP_FAILED, "Failed to map prompt lookup datastore ", path);
+    m_mapped_data = mapped_data;
+#endif
+
+    const char* data = static_cast<const char*>(m_mapped_data);
+    uint64_t num_tokens = 0;
+    std::memcpy(&num_tokens, data + sizeof(MAGIC), sizeof(num_tokens));
+    if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 || num_tokens > std::numeric_limits<uint32_t>::max() ||
+        m_mapped_size != HEADER_SIZE + num_tokens * (sizeof(int32_t) + sizeof(uint32_t))) {
+        unmap_file(m_mapped_data, m_mapped_size);
+        OPENVINO_THROW("Prompt lookup datastore ", path, " has invalid format");
+    }
+
+    m_num_tokens = num_tokens;
+    m_tokens = reinterpret_cast<const int32_t*>(data + HEADER_SIZE);
+    m_suffix_array = reinterpret_cast<const uint32_t*>(data + HEADER_SIZE + m_num_tokens * sizeof(int32_t));
+}
+
+RetrievalDatastore::~RetrievalDatastore() {
+    unmap_file(m_mapped_data, m_mapped_size);
+}
+
+int RetrievalDatastore::compare_suffix(uint32_t position, const std::vector<int64_t>& ngram) const {
+    for (size_t i = 0; i < ngram.size(); ++i) {
+        if (position + i >= m_num_tokens || m_tokens[position + i] < ngram[i]) {
+            return -1;
+        }
+        if (m_tokens[position + i] > ngram[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+std::vector<int64_t> RetrievalDatastore::find_candidates(const std::vector<int64_t>& last_tokens,
+                                                         size_t num_pred_tokens,
+                                                         size_t max_ngram_size,
+                                                         size_t min_support,
+                                                         size_t max_num_occurrences) const {
+    if (num_pred_tokens == 0 || m_num_tokens == 0) {
+        return {};
+    }
+
+    const uint32_t* suffix_array_end = m_suffix_array + m_num_tokens;
+    for (size_t ngram_size = std::min(max_ngram_size, last_tokens.size()); ngram_size > 0; --ngram_size) {
+        const std::vector<int64_t> ngram(last_tokens.end() - ngram_size, last_tokens.end());
+        // suffixes starting with the n-gram are adjacent in the suffix array
+        const uint32_t* occurrences_begin = std::partition_point(m_suffix_array, suffix_array_end, [&](uint32_t position) {
+            return compare_suffix(position, ngram) < 0;
+        });
+        const uint32_t* occurrences_end = std::partition_point(occurrences_begin, suffix_array_end, [&](uint32_t position) {
+            return compare_suffix(position, ngram) == 0;
+        });
+        if (occurrences_begin == occurrences_end) {
+            continue;
+        }
+
+        // positions following the occurrences, which continue the candidates chosen so far
+        std::vector<size_t> continuations;
+        for (const uint32_t* occurrence = occurrences_begin; occurrence != occurrences_end && continuations.size() < max_num_occurrences; ++occurrence) {
+            continuations.push_back(*occurrence + ngram_size);
+        }
+
+        std::vector<int64_t> candidates;
+        std::unordered_map<int32_t, size_t> next_token_counts;
+        while (candidates.size() < num_pred_tokens) {
+            next_token_counts.clear();
+            for (size_t continuation : continuations) {
+                if (continuation < m_num_tokens && m_tokens[continuation] != DOCUMENT_SEPARATOR) {
+                    ++next_token_counts[m_tokens[continuation]];
+                }
+            }
+            auto most_frequent = std::max_element(next_token_counts.begin(), next_token_counts.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second < rhs.second || (lhs.second == rhs.second && lhs.first > rhs.first);
+            });
+            if (most_frequent == next_token_counts.end() || most_frequent->second < min_support) {
+                break;
+            }
+
+            const int32_t next_token = most_frequent->first;
+            candidates.push_back(next_token);
+            std::vector<size_t> next_continuations;
+            for (size_t continuation : continuations) {
+                if (continuation < m_num_tokens && m_tokens[continuation] == next_token) {
+                    next_continuations.push_back(continuation + 1);
+                }
+            }
+            continuations = std::move(next_continuations);
+        }
+
+        // a shorter n-gram may occur in other contexts which continue
+        if (!candidates.empty()) {
+            return candidates;
+        }
+    }
+    return {};
+}
+
+}
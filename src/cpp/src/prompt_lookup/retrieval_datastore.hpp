@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Read-only datastore of tokenized documents for retrieval drafting in prompt lookup decoding:
+ * continuations of the current suffix of a sequence are looked up in a corpus instead of the sequence itself.
+ * The file is memory-mapped, so it's loaded lazily and shared between processes through the page cache.
+ *
+ * File layout, little-endian:
+ *   char magic[8] = "OVGDS001"
+ *   uint64_t num_tokens
+ *   int32_t tokens[num_tokens]         - documents concatenated with DOCUMENT_SEPARATOR between them
+ *   uint32_t suffix_array[num_tokens]  - start positions of all suffixes of `tokens` in lexicographic order
+ */
+class RetrievalDatastore {
+    const int32_t* m_tokens = nullptr;
+    const uint32_t* m_suffix_array = nullptr;
+    size_t m_num_tokens = 0;
+
+    void* m_mapped_data = nullptr;
+    size_t m_mapped_size = 0;
+
+    // -1, 0 or 1 if the suffix starting at `position` is less than, starts with or is greater than `ngram`
+    int compare_suffix(uint32_t position, const std::vector<int64_t>& ngram) const;
+
+public:
+    static constexpr char MAGIC[8] = {'O', 'V', 'G', 'D', 'S', '0', '0', '1'};
+    static constexpr int32_t DOCUMENT_SEPARATOR = -1;
+
+    explicit RetrievalDatastore(const std::filesystem::path& path);
+    ~RetrievalDatastore();
+
+    RetrievalDatastore(const RetrievalDatastore&) = delete;
+    RetrievalDatastore& operator=(const RetrievalDatastore&) = delete;
+
+    size_t size() const {
+        return m_num_tokens;
+    }
+
+    /**
+     * Finds occurrences of the longest n-gram (up to `max_ngram_size`) ending `last_tokens` and builds the most frequent
+     * continuation of up to `num_pred_tokens` tokens: each next token is the most frequent one among occurrences continuing
+     * the tokens chosen so far, while it's followed by at least `min_support` occurrences.
+     * @param max_num_occurrences Max number of occurrences considered, bounds the lookup time for frequent n-grams.
+     */
+    std::vector<int64_t> find_candidates(const std::vector<int64_t>& last_tokens,
+                                         size_t num_pred_tokens,
+                                         size_t max_ngram_size,
+                                         size_t min_support = 1,
+                                         size_t max_num_occurrences = 64) const;
+};
+
+}
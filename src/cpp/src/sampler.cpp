@@ -46,13 +46,14 @@ std::vector<int64_t> kmp_search(const std::vector<int64_t>& haystack, const std:
     return res;
 }
 
-std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
+std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx, size_t token_offset) {
     ov::Shape shape = logits.get_shape();
     OPENVINO_ASSERT(shape.size() == 3);
     size_t batch = shape[0], seq_len = shape[1], vocab_size = shape[2];
     OPENVINO_ASSERT(batch_idx < batch, "Logits batch size doesn't match the number of beams");
+    OPENVINO_ASSERT(token_offset < seq_len);
 
-    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
+    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - token_offset - 1) * vocab_size;
     const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
     float max_logit = *std::max_element(beam_logits, beam_logits + vocab_size);
     float log_sum = std::log(std::accumulate(
@@ -242,7 +243,8 @@ std::map<size_t, int32_t> Sampler::GroupBeamSearcher::get_beam_idxs() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    const std::pair<size_t, std::set<std::string>>& stop_strings,
+    size_t token_offset) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -324,7 +326,7 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
         std::vector<Beam> candidates;
         candidates.reserve(group_size * 2 * group_size);
         for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
+            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx, token_offset);
 
             // apply diversity penalty
             for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
@@ -476,6 +478,42 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     }
 }
 
+size_t Sampler::GroupBeamSearcher::validate_candidates(const ov::Tensor& logits,
+    size_t num_candidates,
+    SamplerOutput& sampler_output,
+    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    // candidates are removed from beams and appended back by beam search steps made on logits of their positions
+    std::map<uint64_t, TokenIds> candidates;
+    for (const auto& sequence : m_sequence_group->get_running_sequences()) {
+        const auto& generated_ids = sequence->get_generated_ids();
+        OPENVINO_ASSERT(generated_ids.size() >= num_candidates);
+        candidates[sequence->get_id()].assign(generated_ids.end() - num_candidates, generated_ids.end());
+        sequence->remove_last_tokens(num_candidates);
+    }
+
+    for (size_t i = 0; i <= num_candidates; ++i) {
+        const size_t token_offset = num_candidates - i;
+        const std::vector<Sequence::Ptr> running_sequences = m_sequence_group->get_running_sequences();
+        const size_t num_sequences = m_sequence_group->num_total_seqs();
+        select_next_tokens(logits, sampler_output, stop_strings, token_offset);
+        if (token_offset == 0) {
+            break;
+        }
+
+        // a step is accepted if each beam is continued by its candidate, i.e. no beam is forked, dropped or finished:
+        // logits of the next position are computed for the same beams then
+        bool is_accepted = m_sequence_group->num_total_seqs() == num_sequences &&
+                           m_sequence_group->get_running_sequences() == running_sequences;
+        for (size_t j = 0; is_accepted && j < running_sequences.size(); ++j) {
+            is_accepted = running_sequences[j]->get_generated_ids().back() == candidates.at(running_sequences[j]->get_id())[i];
+        }
+        if (!is_accepted || running_sequences.empty() || running_sequences.front()->get_generated_len() >= m_parameters.max_new_tokens) {
+            return token_offset;
+        }
+    }
+    return 0;
+}
+
 Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx) {
     ov::Shape logits_shape = logits.get_shape();
     size_t batch_size = logits_shape[0], seq_len = logits_shape[1], vocab_size = logits_shape[2];
@@ -523,6 +561,39 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     return Token(max_value, max_index);
 }
 
+std::vector<Token> Sampler::_greedy_sample_top_k(const Logits& logits, size_t num_tokens, size_t top_logprobs) const {
+    std::vector<float> top_values(num_tokens, -std::numeric_limits<float>::infinity());
+    std::vector<size_t> top_indexes(num_tokens, 0);
+
+    for (size_t i = 0; i < logits.m_size; ++i) {
+        if (logits.m_data[i] > top_values.back()) {
+            top_values.back() = logits.m_data[i];
+            top_indexes.back() = i;
+
+            for (size_t j = top_values.size() - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
+                std::swap(top_values[j], top_values[j - 1]);
+                std::swap(top_indexes[j], top_indexes[j - 1]);
+            }
+        }
+    }
+
+    float log_sum = 0.0f;
+    if (top_logprobs) {
+        float max_value = top_values.front();
+        log_sum = max_value + std::log(std::accumulate(
+            logits.m_data, logits.m_data + logits.m_size, 0.0f, [max_value](float accumulated, float to_add) {
+                return accumulated + std::exp(to_add - max_value);
+        }));
+    }
+
+    std::vector<Token> top_tokens;
+    top_tokens.reserve(num_tokens);
+    for (size_t i = 0; i < num_tokens && i < logits.m_size; ++i) {
+        top_tokens.emplace_back(top_logprobs ? top_values[i] - log_sum : 0.0f, top_indexes[i]);
+    }
+    return top_tokens;
+}
+
 std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
     // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
     std::vector<float> multinomial_weights;
@@ -714,6 +785,60 @@ bool Sampler::validate_candidate(
     return true;
 }
 
+// argmax of a row of raw logits with its log probability, if requested
+Token greedy_sample_row(const float* logits, size_t vocab_size, bool compute_log_prob) {
+    const float* max_logit = std::max_element(logits, logits + vocab_size);
+    float log_prob = 0.f;
+    if (compute_log_prob) {
+        const float max_value = *max_logit;
+        float sum = 0.f;
+        for (size_t i = 0; i < vocab_size; ++i) {
+            sum += std::exp(logits[i] - max_value);
+        }
+        log_prob = -std::log(sum);
+    }
+    return Token(log_prob, max_logit - logits);
+}
+
+void Sampler::_validate_candidates_greedy(Sequence::Ptr running_sequence,
+                                          const float* sequence_logits,
+                                          size_t vocab_size,
+                                          size_t num_candidates,
+                                          size_t max_new_tokens,
+                                          bool compute_log_probs,
+                                          LogitProcessor& logit_processor,
+                                          SequenceGroupSamplingInfo& sg_sampling_info) {
+    AssistingPipelineInfo& assisting_pipeline_info = sg_sampling_info.get_assisting_pipeline_info();
+    const TokenIds& generated_ids = running_sequence->get_generated_ids();
+    OPENVINO_ASSERT(running_sequence->get_generated_len() >= num_candidates);
+    const size_t verified_len = running_sequence->get_generated_len() - num_candidates;
+    OPENVINO_ASSERT(max_new_tokens >= verified_len);
+    const size_t num_positions = std::min(num_candidates + 1, max_new_tokens - verified_len);
+
+    // rows of `sequence_logits` are positions of candidates followed by the position of the next token
+    for (size_t position = 0; position < num_positions; ++position) {
+        sg_sampling_info.sampler_output.num_generated_tokens++;
+        const size_t token_offset = num_candidates - position;
+        const Token sampled_token = greedy_sample_row(sequence_logits + position * vocab_size, vocab_size, compute_log_probs);
+        if (token_offset > 0 && generated_ids[verified_len + position] == sampled_token.m_index) {
+            running_sequence->update_generated_log_prob(verified_len + position, sampled_token.m_log_prob);
+            logit_processor.register_new_generated_token(sampled_token.m_index);
+            continue;
+        }
+        // the first rejected candidate is replaced by the token of the main model
+        if (token_offset > 0) {
+            running_sequence->remove_last_tokens(token_offset);
+            assisting_pipeline_info.max_removed_tokens_per_request = std::max(assisting_pipeline_info.max_removed_tokens_per_request, token_offset);
+        }
+        register_new_token(sampled_token, running_sequence, logit_processor, true, true);
+        return;
+    }
+
+    // max_new_tokens is reached on accepted candidates, the rest of them are dropped
+    sg_sampling_info.sampler_output.num_generated_tokens++;
+    stop_sample_tokens(running_sequence, num_candidates - num_positions, 0, assisting_pipeline_info.max_removed_tokens_per_request);
+}
+
 float get_p_prime(Sequence::Ptr& running_sequence,
                   const Token& sampled_token,
                   size_t token_offset) {
@@ -773,10 +898,24 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
         size_t num_running_sequences = sequence_group->num_running_seqs();
         if (sampling_params.is_greedy_decoding()) {
-            OPENVINO_ASSERT(num_running_sequences == 1);
+            // several greedy sequences are branches of tree speculation or draft sequences following beams of main model
+            OPENVINO_ASSERT(num_running_sequences == 1 || sampling_params.is_assisting_generation());
         }
+        // greedy candidates are validated by argmax of raw logits of all positions at once,
+        // unless logits have to be processed position by position
+        const bool is_batched_greedy_validation = is_validation_mode_enabled && num_tokens_to_process > 0 &&
+                                                  sampling_params.is_greedy_decoding() && !logit_processor.has_applicable_transformers();
+        const size_t vocab_size = sequence_group_logits.get_shape().back();
         for (size_t running_sequence_id = 0; running_sequence_id < num_running_sequences; ++running_sequence_id) {
             auto& running_sequence = running_sequences[running_sequence_id];
+            if (is_batched_greedy_validation) {
+                const size_t first_row = running_sequence_id * output_seq_len + output_seq_len - num_tokens_to_process - 1;
+                _validate_candidates_greedy(running_sequence, sequence_group_logits.data<const float>() + first_row * vocab_size, vocab_size,
+                                            num_tokens_to_process, sequence_group->get_max_new_tokens(), sampling_params.logprobs > 0,
+                                            logit_processor, sg_sampling_info);
+                assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
+                continue;
+            }
             bool is_validation_passed = true;
             // make `num_tokens_to_process` iteration to validate a candidate generated by `draft_model` + 1 iteration to generate one more token by `main_model`
             for (size_t i = 0; i <= num_tokens_to_process; ++i) {
@@ -805,7 +944,20 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
 
                 Token sampled_token;
                 bool is_generate_n_tokens = false;
-                if (sampling_params.is_greedy_decoding()) {
+                // draft model starts branches of tree speculation from its top tokens following the validated sequence
+                bool is_start_branches = !is_validation_mode_enabled && sampling_params.num_assistant_branches > 1 &&
+                                         sequence_group->num_total_seqs() == 1 && running_sequence->get_generated_len() > 0;
+                if (sampling_params.is_greedy_decoding() && is_start_branches) {
+                    auto top_tokens = _greedy_sample_top_k(logit_vector, sampling_params.num_assistant_branches, sampling_params.logprobs);
+                    std::list<uint64_t> forked_seq_ids;
+                    for (size_t branch_id = 1; branch_id < top_tokens.size(); ++branch_id) {
+                        const auto forked_sequence = sequence_group->fork_sequence(running_sequence);
+                        forked_seq_ids.push_back(forked_sequence->get_id());
+                        register_new_token(top_tokens[branch_id], forked_sequence, logit_processor, true, false);
+                    }
+                    sg_sampling_info.sampler_output.m_forked_sequences.insert({running_sequence->get_id(), forked_seq_ids});
+                    sampled_token = top_tokens.front();
+                } else if (sampling_params.is_greedy_decoding()) {
                     sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
                 } else {
                     // is_multinomial()
@@ -855,6 +1007,23 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
             }
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
         }
+        // tree speculation: the longest accepted branch is committed under the grouped id of the request's sequence,
+        // KV blocks of the other branches are freed
+        if (is_validation_mode_enabled && sampling_params.num_assistant_branches > 1 && num_running_sequences > 1) {
+            auto committed_branch = *std::max_element(running_sequences.begin(), running_sequences.end(),
+                [] (const Sequence::Ptr& lhs, const Sequence::Ptr& rhs) {
+                    return lhs->get_generated_len() < rhs->get_generated_len();
+                });
+            const uint64_t grouped_id = running_sequences.front()->get_grouped_id();
+            for (const auto& branch : running_sequences) {
+                if (branch == committed_branch)
+                    continue;
+                sequence_group->remove_sequence(branch->get_id());
+                sg_sampling_info.sampler_output.m_dropped_sequences.push_back(branch->get_id());
+            }
+            committed_branch->set_grouped_id(grouped_id);
+            assisting_pipeline_info.min_generated_len = committed_branch->get_generated_len();
+        }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
         for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
@@ -873,7 +1042,17 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         }
 
         // current algorithm already adds new tokens to running sequences and
-        beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_strings);
+        // candidates of an assisting model are validated by beam search steps on their positions
+        if (num_tokens_to_process > 0) {
+            const size_t num_removed_tokens = beam_searcher->validate_candidates(sequence_group_logits, num_tokens_to_process,
+                                                                                 sg_sampling_info.sampler_output, stop_strings);
+            if (num_removed_tokens > 0 && sequence_group->num_running_seqs() > 0) {
+                assisting_pipeline_info.max_removed_tokens_per_request = num_removed_tokens;
+                assisting_pipeline_info.min_generated_len = sequence_group->get_running_sequences().front()->get_generated_len();
+            }
+        } else {
+            beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_strings);
+        }
 
         // check max length stop criteria
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
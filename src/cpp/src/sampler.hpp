@@ -31,7 +31,8 @@ inline bool is_stop_token_id_hit(int64_t generated_token, const std::set<int64_t
     return false;
 }
 
-std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx);
+// log probabilities of tokens at position `token_offset` from the end of `batch_idx` sequence of logits
+std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx, size_t token_offset = 0);
 
 struct SamplerOutput {
     // IDs of sequences that need to be dropped
@@ -63,11 +64,16 @@ class Sampler {
 
     Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
+    std::vector<Token> _greedy_sample_top_k(const Logits& logits, size_t num_tokens, size_t top_logprobs) const;
     std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
     std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample);
+    // validates all candidates of a greedy sequence by argmax of raw logits of their positions in one pass
+    void _validate_candidates_greedy(Sequence::Ptr running_sequence, const float* sequence_logits, size_t vocab_size,
+                                     size_t num_candidates, size_t max_new_tokens, bool compute_log_probs,
+                                     LogitProcessor& logit_processor, SequenceGroupSamplingInfo& sg_sampling_info);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
                                                         LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
@@ -153,7 +159,15 @@ class Sampler::GroupBeamSearcher {
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings,
+                            size_t token_offset = 0);
+    /**
+     * Validates `num_candidates` last tokens of the beams generated by an assisting model: beam search steps are made on logits
+     * of their positions while every beam is continued by its candidate token.
+     * @return Number of rejected candidate positions.
+     */
+    size_t validate_candidates(const ov::Tensor& logits, size_t num_candidates, SamplerOutput& sampler_output,
+                               const std::pair<size_t, std::set<std::string>>& stop_strings);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdlib>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/genai/scheduler_config.hpp"
+#include "openvino/genai/kv_block_pool.hpp"
 #include "block_manager.hpp"
 #include "sequence_group.hpp"
 #include "cache_manager.hpp"
+#include "output_length_predictor.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
 
@@ -20,6 +23,7 @@ class Scheduler {
     bool m_can_use_partial_preemption;
 
     SchedulerConfig m_config;
+    size_t m_num_layers;
     std::shared_ptr<BlockManager> m_block_manager;
     friend class CacheStateDumper;
 
@@ -30,6 +34,24 @@ class Scheduler {
     const float m_cache_growth_factor = 2; // commmon values 1.5 or 2
 
     std::shared_ptr<CacheManager> m_cache_manager;
+
+    // Estimates output lengths of requests for initial KV cache sizing and admission of new prompts
+    OutputLengthPredictor::Ptr m_output_length_predictor;
+
+    // total number of preemptions performed during the lifetime of the scheduler
+    size_t m_num_preemptions = 0;
+
+    // vLLM case with chunked prefill and prompt-only batches: whether running sequences should
+    // get a decode step before the next chunk of a partially processed prompt
+    bool m_decode_step_pending = false;
+
+    // Shared pool which KV blocks are taken from instead of being limited by device memory only
+    std::shared_ptr<KVBlockPool> m_kv_block_pool;
+    size_t m_kv_block_pool_pipeline_id = 0;
+
+    // Hashes of cached prefixes shared with a scheduler of another pipeline, kept to be set to a new block manager
+    std::shared_ptr<PrefixHashRegistry> m_prefix_hash_registry;
+    bool m_is_prefix_hash_leader = false;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -47,16 +69,113 @@ public:
     Scheduler(size_t block_size, std::shared_ptr<CacheManager> cache_manager, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true) :
         m_cache_manager(cache_manager),
         m_can_use_partial_preemption(can_use_partial_preemption),
-        m_config(config) {
+        m_config(config),
+        m_num_layers(num_layers) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
+        m_output_length_predictor = std::make_shared<HistoricalOutputLengthPredictor>(64, 4096, m_kv_blocks_initial_multiplier);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
     }
 
+    ~Scheduler() {
+        _unregister_from_kv_block_pool();
+    }
+
     void release() {
+        _unregister_from_kv_block_pool();
         m_cache_manager.reset();
         m_block_manager.reset();
     }
 
+    /**
+     * Makes the scheduler take KV blocks from a pool shared with other pipelines.
+     * @param kv_block_pool The shared pool.
+     * @param quota Number of blocks guaranteed to this scheduler by the pool.
+     */
+    void set_kv_block_pool(std::shared_ptr<KVBlockPool> kv_block_pool, size_t quota) {
+        OPENVINO_ASSERT(kv_block_pool != nullptr, "KV block pool must not be null");
+        OPENVINO_ASSERT(m_config.num_kv_blocks == 0 && m_config.cache_size == 0,
+            "KV cache size is defined by the shared KV block pool, so num_kv_blocks and cache_size must not be set in SchedulerConfig");
+        OPENVINO_ASSERT(m_block_manager->get_total_number_of_kv_blocks() == 0, "KV block pool must be set before KV cache is allocated");
+        _unregister_from_kv_block_pool();
+        m_kv_block_pool_pipeline_id = kv_block_pool->register_pipeline(quota, get_block_size(), m_cache_manager->get_block_size_in_bytes());
+        m_kv_block_pool = std::move(kv_block_pool);
+    }
+
+    /**
+     * Shares hashes of cached prefix blocks with a scheduler of another pipeline processing the same requests,
+     * so the follower evicts prefixes cached by the leader last, see PrefixHashRegistry.
+     * @param prefix_hash_registry The registry shared by both schedulers.
+     * @param is_leader Whether this scheduler reports its cached prefixes or keeps prefixes reported by the other one.
+     */
+    void set_prefix_hash_registry(std::shared_ptr<PrefixHashRegistry> prefix_hash_registry, bool is_leader) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix hashes can be shared only if prefix caching is enabled");
+        m_prefix_hash_registry = prefix_hash_registry;
+        m_is_prefix_hash_leader = is_leader;
+        m_block_manager->set_prefix_hash_registry(std::move(prefix_hash_registry), is_leader);
+    }
+
+    /**
+     * @return Whether the scheduler could not schedule anything because other pipelines hold blocks of the shared KV block pool,
+     * so requests should wait instead of being dropped as out of memory.
+     */
+    bool is_waiting_for_kv_blocks() const {
+        return m_kv_block_pool && m_kv_block_pool->is_starving(m_kv_block_pool_pipeline_id);
+    }
+
+    /**
+     * Blocks the calling thread until other pipelines return blocks to the shared KV block pool or the timeout expires.
+     */
+    void wait_for_kv_blocks(std::chrono::milliseconds timeout) {
+        if (m_kv_block_pool)
+            m_kv_block_pool->wait_for_blocks(m_kv_block_pool_pipeline_id, timeout);
+    }
+
+    /**
+     * @return Whether this scheduler holds blocks borrowed from the shared KV block pool above its quota, which are needed
+     * by other pipelines not able to take blocks within their quotas.
+     */
+    bool must_return_kv_blocks() const {
+        return m_kv_block_pool && m_kv_block_pool->get_num_blocks_to_return(m_kv_block_pool_pipeline_id) > 0;
+    }
+
+    /**
+     * Preempts all sequence groups holding KV cache and returns all KV blocks, including cached prefixes, to the shared
+     * KV block pool. The preempted sequence groups are recomputed once the scheduler takes blocks from the pool again,
+     * and blocks reserved for starving pipelines are not lent to it until they take their quotas.
+     */
+    void return_kv_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        OPENVINO_ASSERT(m_kv_block_pool, "KV blocks can be returned only to the shared KV block pool");
+        for (const auto& sequence_group : sequence_groups) {
+            if (sequence_group->get_num_processed_tokens() == 0)
+                continue;
+            for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+                if (m_block_manager->has_block_table(sequence->get_id()))
+                    m_block_manager->free_sequence(sequence->get_id());
+            }
+            sequence_group->preempt_tokens(sequence_group->get_num_processed_tokens());
+            if (sequence_group->get_num_evicted_tokens() != 0) {
+                sequence_group->reset_eviction_token_count();
+            }
+            sequence_group->set_waiting();
+            ++m_num_preemptions;
+        }
+        _release_all_kv_blocks();
+    }
+
+    /**
+     * Returns KV blocks to the shared KV block pool, so other pipelines can use this memory. Must be called when there are
+     * no sequences occupying KV cache. Does nothing if blocks of the pool are not used. With prefix caching, cached prefixes
+     * are kept as long as the scheduler holds no more blocks than its quota, otherwise they are dropped with all blocks.
+     */
+    void release_kv_blocks() {
+        if (!m_kv_block_pool)
+            return;
+        if (m_config.enable_prefix_caching &&
+            m_block_manager->get_total_number_of_kv_blocks() <= m_kv_block_pool->get_quota(m_kv_block_pool_pipeline_id))
+            return;
+        _release_all_kv_blocks();
+    }
+
     Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
         Output scheduler_output;
         // map of src -> dst blocks copies, which need to be performed by CacheManager
@@ -75,15 +194,27 @@ public:
             _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
             // some tokens from generation prompt are also scheduled
             _schedule_prompt_phase_dynamic_split_fuse(sequence_groups, scheduler_output);
+        } else if (m_config.enable_chunked_prefill && !m_config.prompt_only_batches) {
+            // vLLM case with chunked prefill mixed with generation
+            // generation phase is scheduled first, prompt chunks take the rest of the batch
+            _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+            _schedule_prompt_phase_vllm(sequence_groups, scheduler_output);
         } else {
             // vLLM case
-            // schedule prompt phase using whole prompt's input_ids
+            // schedule prompt phase using whole prompt's input_ids (or its chunk if chunked prefill is enabled)
+            if (m_decode_step_pending) {
+                // interleave chunks of long prompts with generation steps of running sequences
+                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+                m_decode_step_pending = false;
+            }
 
-            _schedule_prompt_phase_vllm(sequence_groups, scheduler_output);
+            if (scheduler_output.m_scheduled_sequence_groups_ids.empty()) {
+                m_decode_step_pending = _schedule_prompt_phase_vllm(sequence_groups, scheduler_output);
 
-            if (!scheduler_output.is_prompt) {
-                // prompt sequences are not scheduler => scheduler generation phase by dynamic_split_fuse implementation
-                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+                if (!scheduler_output.is_prompt) {
+                    // prompt sequences are not scheduler => scheduler generation phase by dynamic_split_fuse implementation
+                    _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+                }
             }
         }
 
@@ -144,6 +275,19 @@ public:
         m_block_manager->free_blocks_from_sequence(seq_id, per_layer_logical_block_indices_to_free);
     }
 
+    void set_output_length_predictor(OutputLengthPredictor::Ptr output_length_predictor) {
+        OPENVINO_ASSERT(output_length_predictor != nullptr, "Output length predictor must not be null");
+        m_output_length_predictor = std::move(output_length_predictor);
+    }
+
+    const OutputLengthPredictor::Ptr& get_output_length_predictor() const {
+        return m_output_length_predictor;
+    }
+
+    size_t get_num_preemptions() const {
+        return m_num_preemptions;
+    }
+
 private:
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
@@ -162,6 +306,7 @@ private:
         size_t preempted_tokens = 0;
         size_t num_blocks_occupied_by_sequence = m_block_manager->get_number_of_blocks_occupied_by_sequence(sequence_group);
         bool was_evicted_from = (sequence_group->get_num_evicted_tokens() != 0);
+        ++m_num_preemptions;
 
         if (num_blocks_occupied_by_sequence <= blocks_needed || !m_can_use_partial_preemption || was_evicted_from) {
             auto sequences = sequence_group->get_not_finished_sequences();
@@ -194,7 +339,7 @@ private:
         preempted_tokens = tokens_in_last_block + std::max<size_t>((int)logical_blocks_released - 1, 0) * block_size;
 
         // case when preemption requires preempt prompt tokens
-        if (!m_config.dynamic_split_fuse && processed_tokens - preempted_tokens < sequence_group->get_prompt_len()) {
+        if (!m_config.dynamic_split_fuse && !m_config.enable_chunked_prefill && processed_tokens - preempted_tokens < sequence_group->get_prompt_len()) {
             // preempt prompt fully to not leave partially generated prompt
             preempted_tokens = processed_tokens;
             for (auto sequence: sequence_group->get_not_finished_sequences()) {
@@ -223,6 +368,35 @@ private:
         return std::numeric_limits<size_t>::max();
     }
 
+    /**
+     * @return The number of KV blocks the sequence group is expected to additionally occupy until it finishes generation
+     * according to the output length predictor.
+     */
+    size_t _get_num_predicted_blocks(const SequenceGroup::Ptr& sequence_group) const {
+        size_t block_size = get_block_size();
+        size_t predicted_len = sequence_group->get_prompt_len() + m_output_length_predictor->predict(sequence_group);
+        size_t num_predicted_blocks = (predicted_len + block_size - 1) / block_size;
+        size_t num_logical_blocks = sequence_group->get_num_logical_blocks();
+        if (num_predicted_blocks <= num_logical_blocks)
+            return 0;
+        return (num_predicted_blocks - num_logical_blocks) * std::max<size_t>(sequence_group->num_running_seqs(), 1);
+    }
+
+    /**
+     * @return The number of KV blocks which should be kept free for the sequence groups already holding KV cache,
+     * so they can reach their predicted output length without being preempted.
+     */
+    size_t _get_num_reserved_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) const {
+        size_t num_reserved_blocks = 0;
+        for (const auto& sequence_group : sequence_groups) {
+            if (sequence_group->get_num_processed_tokens() == 0 || sequence_group->is_waiting() || sequence_group->has_finished() ||
+                sequence_group->handle_stopped() || sequence_group->handle_cancelled())
+                continue;
+            num_reserved_blocks += _get_num_predicted_blocks(sequence_group);
+        }
+        return num_reserved_blocks;
+    }
+
     void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
 
@@ -251,6 +425,9 @@ private:
         //    greedy scheduling of prompt with higher priority
         // 2. The mechanism below performs greedy scheduling of high priority prompts
 
+        // blocks reserved for the predicted outputs of sequence groups which already hold KV cache
+        size_t num_reserved_blocks = m_config.use_output_length_prediction ? _get_num_reserved_blocks(sequence_groups) : 0;
+
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
@@ -279,6 +456,18 @@ private:
                         break;
                     }
                 }
+
+                // admit a new prompt only if running requests are expected to finish without preemption
+                const bool is_new_prompt = sequence_group->get_num_processed_tokens() == 0;
+                if (m_config.use_output_length_prediction && is_new_prompt) {
+                    while (!m_block_manager->can_allocate_blocks(num_required_blocks + num_reserved_blocks)) {
+                        if (!_try_increase_cache()) {
+                            break;
+                        }
+                    }
+                    if (num_reserved_blocks > 0 && !m_block_manager->can_allocate_blocks(num_required_blocks + num_reserved_blocks))
+                        break;
+                }
                 size_t num_scheduled_blocks = std::min(num_required_blocks, m_block_manager->num_free_blocks());
                 // some scheduled blocks can be no fully occupied, so we need to take min between num_scheduled_blocks
                 // and total "scheduled capacity"
@@ -297,6 +486,9 @@ private:
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
                     }
+
+                    if (m_config.use_output_length_prediction && is_new_prompt)
+                        num_reserved_blocks += _get_num_predicted_blocks(sequence_group);
                 }
 
                 // if we added maximum amount of tokens to compute
@@ -378,20 +570,31 @@ private:
         }
     }
 
-    void _schedule_prompt_phase_vllm(std::vector<SequenceGroup::Ptr>& sequence_groups, Output& scheduler_output) {
+    /**
+     * @return Whether a prompt was scheduled partially, i.e. its remaining part is to be processed by the next steps.
+     * Can happen only if chunked prefill is enabled.
+     */
+    bool _schedule_prompt_phase_vllm(std::vector<SequenceGroup::Ptr>& sequence_groups, Output& scheduler_output) {
         // Current scheduling method schedules prompts only in a manner similar to vLLM:
         // - Limits max batch size by:
         //   - max_num_seqs (256 in vLLM's defaults)
         //   - max_num_batched_tokens (max_model_length (and at least 2048) in vLLM's defaults)
+        // - If chunked prefill is enabled, prompts longer than the rest of the batch are split into chunks
 
         OPENVINO_ASSERT(!m_config.dynamic_split_fuse, "Internal error: we are in vLLM scheduling");
         OPENVINO_ASSERT(m_config.max_num_seqs <= m_config.max_num_batched_tokens, "Max num batched tokens (", m_config.max_num_batched_tokens,
             ") must be greater or equal to max num sequences (", m_config.max_num_seqs, ")");
-        OPENVINO_ASSERT(scheduler_output.m_scheduled_sequence_groups_ids.empty(), "Internal error: in vLLM scheduling, prompt phase is always first one");
+        const bool has_generation_tokens = !scheduler_output.m_scheduled_sequence_groups_ids.empty();
+        OPENVINO_ASSERT(!has_generation_tokens || (m_config.enable_chunked_prefill && !m_config.prompt_only_batches),
+            "Internal error: in vLLM scheduling, prompt phase is always first one");
+        bool has_partially_scheduled_prompt = false;
 
         // TODO: it currently does not handle beam search, where beam width should contribute to total number of "num running sequences"
         size_t num_running_sequence_groups = _num_running_sequence_groups(sequence_groups);
 
+        // blocks reserved for the predicted outputs of sequence groups which already hold KV cache
+        size_t num_reserved_blocks = m_config.use_output_length_prediction ? _get_num_reserved_blocks(sequence_groups) : 0;
+
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
@@ -400,33 +603,50 @@ private:
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
                 // here we also assume that sequence must be scheduler in a single shot and has no already generated context
-                if (!m_config.enable_prefix_caching)
+                if (!m_config.enable_prefix_caching && !m_config.enable_chunked_prefill)
                     OPENVINO_ASSERT(sequence_group->get_context_len() == 0);
                 size_t num_available_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t sequence_len = sequence_group->get_num_available_tokens_for_batching();
 
                 // TODO: better handling
                 // e.g. return status that sequence is ignored and cannot be processed by current scheduling algorigthm
-                OPENVINO_ASSERT(m_config.max_num_batched_tokens >= sequence_len, "Sequence length (", sequence_len, ") is longer than max number of tokens in batch (", m_config.max_num_batched_tokens, ")");
+                OPENVINO_ASSERT(m_config.enable_chunked_prefill || m_config.max_num_batched_tokens >= sequence_len, "Sequence length (", sequence_len,
+                    ") is longer than max number of tokens in batch (", m_config.max_num_batched_tokens, "). Consider enabling chunked prefill");
 
                 // if we limited by max_num_seqs condition
                 if (num_running_sequence_groups >= m_config.max_num_seqs)
                     break;
 
                 // apply max num batched tokens limitation
-                if (num_available_tokens_in_megabatch < sequence_len)
+                if (m_config.enable_chunked_prefill) {
+                    // schedule as much of the prompt as fits into the batch, the rest is processed by the next steps
+                    sequence_len = std::min(sequence_len, num_available_tokens_in_megabatch);
+                    if (sequence_len == 0)
+                        break;
+                } else if (num_available_tokens_in_megabatch < sequence_len) {
                     break;
+                }
 
                 // apply KV cache limitations
                 size_t block_size = get_block_size();
-                const size_t num_required_blocks = (sequence_len + block_size - 1) / block_size;
-                while (!m_block_manager->can_allocate_blocks(num_required_blocks)){
+                size_t num_required_blocks = (sequence_len + block_size - 1) / block_size;
+                if (m_config.enable_chunked_prefill) {
+                    // the last block allocated for previous chunks of the prompt can be partially filled
+                    size_t currently_allocated_token_slots = sequence_group->get_num_blocks() * block_size;
+                    size_t occupied_token_slots = sequence_group->get_num_processed_tokens() - sequence_group->get_num_evicted_tokens();
+                    size_t available_slots = currently_allocated_token_slots - occupied_token_slots;
+                    num_required_blocks = sequence_len > available_slots ? (sequence_len - available_slots + block_size - 1) / block_size : 0;
+                }
+                while (!m_block_manager->can_allocate_blocks(num_required_blocks + num_reserved_blocks)){
                     if (!_try_increase_cache()) {
                         break;
                     }
                 }
                 if (!m_block_manager->can_allocate_blocks(num_required_blocks))
                     break;
+                // admit a new prompt only if running requests are expected to finish without preemption
+                if (num_reserved_blocks > 0 && !m_block_manager->can_allocate_blocks(num_required_blocks + num_reserved_blocks))
+                    break;
 
                 // add scheduling information
                 {
@@ -447,12 +667,24 @@ private:
                     }
 
                     // update "is_prompt" flag
-                    scheduler_output.is_prompt = true;
+                    scheduler_output.is_prompt = !has_generation_tokens;
+
+                    if (sequence_group->get_context_len() < sequence_group->get_prompt_len())
+                        has_partially_scheduled_prompt = true;
                 }
 
+                if (m_config.use_output_length_prediction)
+                    num_reserved_blocks += _get_num_predicted_blocks(sequence_group);
+
                 num_running_sequence_groups += 1;
+
+                // if we added maximum amount of tokens to compute
+                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                    break;
             }
         }
+
+        return has_partially_scheduled_prompt;
     }
 
     void _clear_waiting_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
@@ -492,12 +724,33 @@ private:
         return total_device_memory - used_device_mem;
     }
 
+    void _unregister_from_kv_block_pool() {
+        if (m_kv_block_pool) {
+            m_kv_block_pool->unregister_pipeline(m_kv_block_pool_pipeline_id);
+            m_kv_block_pool.reset();
+        }
+    }
+
+    void _release_all_kv_blocks() {
+        size_t num_kv_blocks = m_block_manager->get_total_number_of_kv_blocks();
+        OPENVINO_ASSERT(m_block_manager->num_free_blocks() == num_kv_blocks, "KV blocks cannot be released while they are occupied by sequences");
+        if (num_kv_blocks > 0) {
+            // cached prefixes are dropped together with the blocks
+            m_block_manager = std::make_shared<BlockManager>(0, m_config.enable_prefix_caching, get_block_size(), m_num_layers);
+            if (m_prefix_hash_registry) {
+                m_block_manager->set_prefix_hash_registry(m_prefix_hash_registry, m_is_prefix_hash_leader);
+            }
+            m_cache_manager->release_cache();
+        }
+        m_kv_block_pool->release(m_kv_block_pool_pipeline_id, num_kv_blocks);
+    }
+
     void _initialize_cache(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t blocks_sum = 0;
         for (auto idx = 0; idx < sequence_groups.size(); idx++) {
-            auto seq_length = sequence_groups[idx]->get_prompt_len() * m_kv_blocks_initial_multiplier;
+            // without any history, predictor assumes output of (m_kv_blocks_initial_multiplier - 1) * prompt length
+            auto seq_length = sequence_groups[idx]->get_prompt_len() + m_output_length_predictor->predict(sequence_groups[idx]);
             auto gen_config = sequence_groups[idx]->get_sampling_parameters();
-            seq_length = std::min(seq_length, sequence_groups[idx]->get_prompt_len() + sequence_groups[idx]->get_max_new_tokens());
             size_t blocks_num = std::ceil(static_cast<float>(seq_length) / m_block_manager->get_block_size());
             if (gen_config.is_beam_search()) {
                 blocks_num *= gen_config.num_beams;
@@ -506,8 +759,14 @@ private:
             }
             blocks_sum += blocks_num;
         }
-        m_block_manager->increase_kv_blocks_number(blocks_sum);
         m_dynamic_memory_allocation = true;
+        if (m_kv_block_pool) {
+            blocks_sum = m_kv_block_pool->acquire(m_kv_block_pool_pipeline_id, blocks_sum);
+            // other pipelines hold all available blocks, initialization is retried on the next step
+            if (blocks_sum == 0)
+                return;
+        }
+        m_block_manager->increase_kv_blocks_number(blocks_sum);
     }
 
     bool _try_increase_cache() {
@@ -518,7 +777,13 @@ private:
         size_t current_num_of_kv_blocks = m_block_manager->get_total_number_of_kv_blocks();
         size_t new_blocks_num = current_num_of_kv_blocks * m_cache_growth_factor;
 
-        if (device.find("GPU") == std::string::npos) {
+        if (m_kv_block_pool) {
+            size_t num_blocks_to_add = std::max<size_t>(new_blocks_num - current_num_of_kv_blocks, 1);
+            size_t num_granted_blocks = m_kv_block_pool->acquire(m_kv_block_pool_pipeline_id, num_blocks_to_add);
+            if (num_granted_blocks == 0)
+                return false;
+            m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + num_granted_blocks);
+        } else if (device.find("GPU") == std::string::npos) {
             m_block_manager->increase_kv_blocks_number(new_blocks_num);
         } else {
             const size_t available_gpu_memory = _get_available_gpu_memory();
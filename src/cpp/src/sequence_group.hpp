@@ -56,6 +56,7 @@ class Sequence {
 
     Sequence(const Sequence& seq, const uint64_t id) :
         m_generated_ids(seq.m_generated_ids),
+        m_generated_log_probs(seq.m_generated_log_probs),
         m_grouped_id(id),
         m_status(seq.m_status),
         m_cumulative_log_prob(seq.m_cumulative_log_prob),
@@ -87,6 +88,10 @@ public:
         return m_grouped_id;
     }
 
+    void set_grouped_id(uint64_t grouped_id) {
+        m_grouped_id = grouped_id;
+    }
+
     bool has_finished() const {
         return m_status == SequenceStatus::FINISHED;
     }
@@ -602,6 +607,14 @@ public:
         return forked_sequence;
     }
 
+    // forks a sequence with the grouped id of a sequence of another pipeline, e.g. a draft branch in speculative decoding
+    Sequence::Ptr fork_sequence(Sequence::CPtr sequence, uint64_t grouped_id) {
+        auto forked_sequence = Sequence::fork(sequence, grouped_id);
+        m_sequences.emplace_back(forked_sequence);
+        m_next_sequence_id = std::max(m_next_sequence_id, grouped_id + 1);
+        return forked_sequence;
+    }
+
     const ov::genai::GenerationConfig& get_sampling_parameters() const {
         return m_sampling_params;
     }
@@ -749,7 +762,7 @@ public:
         m_generation_stream->push(std::move(outputs));
     }
 
-    size_t get_max_new_tokens() {
+    size_t get_max_new_tokens() const {
         return m_sampling_params.get_max_new_tokens(get_prompt_len());
     }
 };
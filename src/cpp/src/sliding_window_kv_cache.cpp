@@ -0,0 +1,189 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sliding_window_kv_cache.hpp"
+
+#include <cmath>
+#include <fstream>
+
+#include "json_utils.hpp"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+bool is_key_state(const std::string& name) {
+    const std::string suffix = "key";
+    return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// copies `length` positions of `axis` of src starting from `src_begin` to dst starting from `dst_begin`
+void copy_positions(const ov::Tensor& src, ov::Tensor& dst, size_t axis, size_t src_begin, size_t dst_begin, size_t length) {
+    if (length == 0)
+        return;
+    ov::Coordinate src_roi_begin(src.get_shape().size(), 0), src_roi_end(src.get_shape());
+    ov::Coordinate dst_roi_begin(dst.get_shape().size(), 0), dst_roi_end(dst.get_shape());
+    src_roi_begin[axis] = src_begin;
+    src_roi_end[axis] = src_begin + length;
+    dst_roi_begin[axis] = dst_begin;
+    dst_roi_end[axis] = dst_begin + length;
+    ov::Tensor dst_roi(dst, dst_roi_begin, dst_roi_end);
+    ov::Tensor(src, src_roi_begin, src_roi_end).copy_to(dst_roi);
+}
+
+// rotates heads of positions [begin, end) of `axis` by angles given by cos / sin for each pair of rotated dimensions,
+// which are the first and the second halves of the rotated part of a head as in `rotate_half` of HF transformers
+template <typename T>
+void rotate_keys(ov::Tensor& keys, size_t axis, size_t begin, const std::vector<float>& cos, const std::vector<float>& sin) {
+    const ov::Shape& shape = keys.get_shape();
+    const size_t head_size = shape.back(), num_pairs = cos.size();
+    size_t outer_size = 1, inner_size = 1;
+    for (size_t i = 0; i < axis; ++i)
+        outer_size *= shape[i];
+    for (size_t i = axis + 1; i < shape.size(); ++i)
+        inner_size *= shape[i];
+
+    T* data = keys.data<T>();
+    for (size_t outer = 0; outer < outer_size; ++outer) {
+        for (size_t position = begin; position < shape[axis]; ++position) {
+            T* position_data = data + (outer * shape[axis] + position) * inner_size;
+            for (size_t head = 0; head < inner_size / head_size; ++head) {
+                T* head_data = position_data + head * head_size;
+                for (size_t i = 0; i < num_pairs; ++i) {
+                    const float x = static_cast<float>(head_data[i]), y = static_cast<float>(head_data[i + num_pairs]);
+                    head_data[i] = static_cast<T>(x * cos[i] - y * sin[i]);
+                    head_data[i + num_pairs] = static_cast<T>(y * cos[i] + x * sin[i]);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+RopeConfig::RopeConfig(const std::filesystem::path& config_path) {
+    std::ifstream file(config_path);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", config_path);
+
+    nlohmann::json data = nlohmann::json::parse(file);
+    using utils::read_json_param;
+
+    read_json_param(data, "rope_theta", rope_theta);
+    read_json_param(data, "partial_rotary_factor", partial_rotary_factor);
+    if (data.contains("rope_scaling") && data["rope_scaling"].is_object()) {
+        const nlohmann::json& rope_scaling = data["rope_scaling"];
+        read_json_param(rope_scaling, "type", scaling_type);
+        read_json_param(rope_scaling, "rope_type", scaling_type);
+        read_json_param(rope_scaling, "factor", scaling_factor);
+        read_json_param(rope_scaling, "low_freq_factor", low_freq_factor);
+        read_json_param(rope_scaling, "high_freq_factor", high_freq_factor);
+        read_json_param(rope_scaling, "original_max_position_embeddings", original_max_position_embeddings);
+    }
+}
+
+std::vector<double> RopeConfig::get_inv_freqs(size_t head_size) const {
+    OPENVINO_ASSERT(scaling_type == "default" || scaling_type == "linear" || scaling_type == "llama3",
+                    "Keys of KV cache can't be rotated for RoPE scaling type ", scaling_type);
+    const size_t rotary_size = static_cast<size_t>(head_size * partial_rotary_factor) / 2 * 2;
+
+    std::vector<double> inv_freqs(rotary_size / 2);
+    for (size_t i = 0; i < inv_freqs.size(); ++i) {
+        inv_freqs[i] = std::pow(rope_theta, -static_cast<double>(2 * i) / rotary_size);
+    }
+
+    if (scaling_type == "linear") {
+        for (double& inv_freq : inv_freqs) {
+            inv_freq /= scaling_factor;
+        }
+    } else if (scaling_type == "llama3") {
+        // low frequencies are scaled, high ones are kept and medium ones are interpolated between them
+        const double low_freq_wavelen = original_max_position_embeddings / low_freq_factor;
+        const double high_freq_wavelen = original_max_position_embeddings / high_freq_factor;
+        for (double& inv_freq : inv_freqs) {
+            const double wavelen = 2 * PI / inv_freq;
+            if (wavelen > low_freq_wavelen) {
+                inv_freq /= scaling_factor;
+            } else if (wavelen >= high_freq_wavelen) {
+                const double smooth = (original_max_position_embeddings / wavelen - low_freq_factor) / (high_freq_factor - low_freq_factor);
+                inv_freq = (1 - smooth) * inv_freq / scaling_factor + smooth * inv_freq;
+            }
+        }
+    }
+    return inv_freqs;
+}
+
+SlidingWindowKVCache::SlidingWindowKVCache(size_t num_sink_tokens,
+                                           size_t window_size,
+                                           size_t seq_length_axis,
+                                           const RopeConfig& rope_config,
+                                           const std::optional<AdapterController>& adapter_controller)
+    : m_num_sink_tokens(num_sink_tokens),
+      m_window_size(window_size),
+      m_eviction_step(std::max<size_t>(window_size / 8, 1)),
+      m_seq_length_axis(seq_length_axis),
+      m_rope_config(rope_config),
+      m_adapter_controller(adapter_controller) {
+    OPENVINO_ASSERT(window_size > 0, "Sliding window of KV cache must contain at least one token");
+    // unsupported RoPE is reported at construction rather than at the first eviction
+    m_rope_config.get_inv_freqs(2);
+}
+
+size_t SlidingWindowKVCache::get_num_tokens_to_evict(size_t kv_cache_len, size_t num_new_tokens) const {
+    if (kv_cache_len + num_new_tokens <= get_capacity())
+        return 0;
+    OPENVINO_ASSERT(num_new_tokens <= m_window_size, "Number of new tokens ", num_new_tokens, " exceeds the sliding window of KV cache ", m_window_size);
+    const size_t num_tokens = std::max(kv_cache_len + num_new_tokens - get_capacity(), m_eviction_step);
+    return std::min(num_tokens, kv_cache_len - m_num_sink_tokens);
+}
+
+void SlidingWindowKVCache::evict(ov::InferRequest& request, size_t num_tokens) const {
+    if (num_tokens == 0)
+        return;
+
+    std::optional<AdapterController> adapter_controller = m_adapter_controller;
+    size_t num_key_states = 0;
+    for (auto& state : request.query_state()) {
+        if (adapter_controller && adapter_controller->has_state_name(state.get_name()))
+            continue;
+
+        ov::Tensor old_tensor = state.get_state();
+        ov::Shape shape = old_tensor.get_shape();
+        const size_t kv_cache_len = shape.at(m_seq_length_axis);
+        OPENVINO_ASSERT(kv_cache_len >= m_num_sink_tokens + num_tokens, "Can't evict ", num_tokens, " tokens from KV cache of ", kv_cache_len, " tokens");
+        shape[m_seq_length_axis] -= num_tokens;
+
+        ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
+        copy_positions(old_tensor, new_tensor, m_seq_length_axis, 0, 0, m_num_sink_tokens);
+        copy_positions(old_tensor, new_tensor, m_seq_length_axis, m_num_sink_tokens + num_tokens, m_num_sink_tokens,
+                       kv_cache_len - m_num_sink_tokens - num_tokens);
+
+        if (is_key_state(state.get_name())) {
+            ++num_key_states;
+            // the window moves by `num_tokens` positions back, i.e. keys are rotated by the negative angle
+            std::vector<float> cos, sin;
+            for (double inv_freq : m_rope_config.get_inv_freqs(shape.back())) {
+                cos.push_back(static_cast<float>(std::cos(num_tokens * inv_freq)));
+                sin.push_back(static_cast<float>(-std::sin(num_tokens * inv_freq)));
+            }
+            const ov::element::Type type = new_tensor.get_element_type();
+            if (type == ov::element::f32) {
+                rotate_keys<float>(new_tensor, m_seq_length_axis, m_num_sink_tokens, cos, sin);
+            } else if (type == ov::element::f16) {
+                rotate_keys<ov::float16>(new_tensor, m_seq_length_axis, m_num_sink_tokens, cos, sin);
+            } else if (type == ov::element::bf16) {
+                rotate_keys<ov::bfloat16>(new_tensor, m_seq_length_axis, m_num_sink_tokens, cos, sin);
+            } else {
+                OPENVINO_THROW("Keys of KV cache of type ", type, " can't be rotated");
+            }
+        }
+
+        state.set_state(new_tensor);
+    }
+    OPENVINO_ASSERT(num_key_states > 0, "Keys of KV cache aren't found: names of their variables are expected to end with 'key'");
+}
+
+}  // namespace genai
+}  // namespace ov
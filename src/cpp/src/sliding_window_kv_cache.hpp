@@ -0,0 +1,94 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief RoPE parameters of config.json of the model, which are required to move cached keys to other positions.
+ * Only `rotate_half` RoPE of Llama-like models is supported, with partial rotary embeddings and linear or llama3 frequency scaling.
+ */
+struct RopeConfig {
+    double rope_theta = 10000.0;
+    float partial_rotary_factor = 1.f;
+    std::string scaling_type = "default";
+    float scaling_factor = 1.f;
+    // parameters of llama3 scaling
+    float low_freq_factor = 1.f;
+    float high_freq_factor = 4.f;
+    size_t original_max_position_embeddings = 8192;
+
+    RopeConfig() = default;
+    explicit RopeConfig(const std::filesystem::path& config_path);
+
+    /**
+     * @brief Returns inverse frequencies of pairs of rotated dimensions of a head, i.e. rotation angles per position.
+     */
+    std::vector<double> get_inv_freqs(size_t head_size) const;
+};
+
+/**
+ * @brief KV cache of the stateful pipeline bounded by attention sinks and a sliding window, see StreamingLLM
+ * (https://arxiv.org/abs/2309.17453). Variable states keep KV of the first `num_sink_tokens` tokens of the sequence, which
+ * collect a large share of attention regardless of their content, and of up to `window_size` most recent tokens.
+ *
+ * When the cache is full, the oldest tokens of the window are evicted from the middle of the states, and keys of the rest
+ * of the window are rotated back by the number of evicted tokens. So the cache stays contiguous in RoPE positions and
+ * the next token is inferred at the position equal to the cache length, which never exceeds the capacity of the cache.
+ * Eviction rewrites all variable states, so it frees 1/8 of the window at once rather than a token per step.
+ */
+class SlidingWindowKVCache {
+    size_t m_num_sink_tokens;
+    size_t m_window_size;
+    size_t m_eviction_step;
+    size_t m_seq_length_axis;
+    RopeConfig m_rope_config;
+    std::optional<AdapterController> m_adapter_controller;
+
+public:
+    SlidingWindowKVCache(size_t num_sink_tokens,
+                         size_t window_size,
+                         size_t seq_length_axis,
+                         const RopeConfig& rope_config = {},
+                         const std::optional<AdapterController>& adapter_controller = std::nullopt);
+
+    size_t get_num_sink_tokens() const {
+        return m_num_sink_tokens;
+    }
+
+    // max number of tokens in KV cache
+    size_t get_capacity() const {
+        return m_num_sink_tokens + m_window_size;
+    }
+
+    // max number of tokens of a prompt inferred at once if the prompt doesn't fit the window
+    size_t get_max_chunk_size() const {
+        return std::max<size_t>(m_window_size / 2, 1);
+    }
+
+    /**
+     * @brief Returns number of tokens to evict so that `num_new_tokens` can be inferred on top of `kv_cache_len` cached tokens,
+     * 0 if they fit the cache.
+     */
+    size_t get_num_tokens_to_evict(size_t kv_cache_len, size_t num_new_tokens) const;
+
+    /**
+     * @brief Evicts `num_tokens` tokens following the sink ones from KV cache of the request and rotates keys of the rest of the window.
+     * Keys are recognized by names of variable states ending with "key", as the ones of models exported by optimum-intel.
+     */
+    void evict(ov::InferRequest& request, size_t num_tokens) const;
+};
+
+}  // namespace genai
+}  // namespace ov
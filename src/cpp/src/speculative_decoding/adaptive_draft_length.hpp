@@ -0,0 +1,132 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace ov::genai {
+
+/**
+ * @brief Chooses the number of draft tokens for each request of speculative decoding at every step.
+ *
+ * If each draft token is accepted with probability `a` and a draft model iteration costs `c` of a main model step,
+ * drafting `k` tokens yields `1 + a + ... + a^k` tokens per `1 + k * c` of main model step time. The controller estimates
+ * `a` per request from its recent acceptance history and `c` from measured step durations, and picks `k` maximizing
+ * the ratio, up to `num_assistant_tokens` of the request. `k = 0` disables drafting for the request; such requests
+ * periodically draft a single token to notice when acceptance improves.
+ */
+class AdaptiveDraftLengthController {
+    struct RequestState {
+        // exponentially decayed numbers of accepted draft tokens and of observed accept / reject decisions
+        float num_accepted = 0.f;
+        float num_decisions = 0.f;
+        size_t num_draft_tokens = 0;
+        size_t num_steps_without_drafting = 0;
+    };
+
+    float m_decay;
+    size_t m_probe_interval;
+    // ratio of a draft model iteration duration to a main model step duration, 0 until measured
+    float m_cost_ratio = 0.f;
+    std::map<uint64_t, RequestState> m_requests;
+
+public:
+    /**
+     * @param decay Weight of acceptance history at each step, lower values adapt faster.
+     * @param probe_interval Number of steps after which a request with disabled drafting drafts a single token.
+     */
+    explicit AdaptiveDraftLengthController(float decay = 0.8f, size_t probe_interval = 16) :
+        m_decay(decay),
+        m_probe_interval(probe_interval) {}
+
+    /**
+     * @return Expected acceptance probability of a draft token of the request.
+     */
+    float get_acceptance_rate(uint64_t request_id) const {
+        auto it = m_requests.find(request_id);
+        // uniform prior, so requests without history are not disabled before they draft
+        if (it == m_requests.end())
+            return 0.5f;
+        return (it->second.num_accepted + 1.f) / (it->second.num_decisions + 2.f);
+    }
+
+    float get_cost_ratio() const {
+        return m_cost_ratio;
+    }
+
+    /**
+     * Chooses the number of draft tokens for the next step of the request.
+     * @param max_num_draft_tokens Upper bound, `num_assistant_tokens` of the request.
+     */
+    size_t choose_num_draft_tokens(uint64_t request_id, size_t max_num_draft_tokens) {
+        RequestState& state = m_requests[request_id];
+        // step durations are not measured yet
+        if (m_cost_ratio == 0.f) {
+            state.num_draft_tokens = max_num_draft_tokens;
+            return state.num_draft_tokens;
+        }
+
+        float acceptance_rate = get_acceptance_rate(request_id);
+        size_t best_num_draft_tokens = 0;
+        float best_speedup = 1.f, expected_num_tokens = 1.f, acceptance_of_prefix = 1.f;
+        for (size_t num_draft_tokens = 1; num_draft_tokens <= max_num_draft_tokens; ++num_draft_tokens) {
+            acceptance_of_prefix *= acceptance_rate;
+            expected_num_tokens += acceptance_of_prefix;
+            float speedup = expected_num_tokens / (1.f + num_draft_tokens * m_cost_ratio);
+            if (speedup > best_speedup) {
+                best_speedup = speedup;
+                best_num_draft_tokens = num_draft_tokens;
+            }
+        }
+
+        if (best_num_draft_tokens == 0 && max_num_draft_tokens > 0 && ++state.num_steps_without_drafting >= m_probe_interval) {
+            state.num_steps_without_drafting = 0;
+            best_num_draft_tokens = 1;
+        } else if (best_num_draft_tokens > 0) {
+            state.num_steps_without_drafting = 0;
+        }
+
+        state.num_draft_tokens = best_num_draft_tokens;
+        return state.num_draft_tokens;
+    }
+
+    /**
+     * @return The number of draft tokens chosen for the last step of the request.
+     */
+    size_t get_num_draft_tokens(uint64_t request_id) const {
+        auto it = m_requests.find(request_id);
+        return it == m_requests.end() ? 0 : it->second.num_draft_tokens;
+    }
+
+    /**
+     * Registers the result of validation of the request's draft tokens by the main model.
+     */
+    void update_acceptance(uint64_t request_id, size_t num_draft_tokens, size_t num_accepted_tokens) {
+        if (num_draft_tokens == 0)
+            return;
+        RequestState& state = m_requests[request_id];
+        // draft tokens are accepted until the first rejected one, the rest are not decided
+        bool has_rejected_token = num_accepted_tokens < num_draft_tokens;
+        state.num_accepted = m_decay * state.num_accepted + num_accepted_tokens;
+        state.num_decisions = m_decay * state.num_decisions + num_accepted_tokens + (has_rejected_token ? 1 : 0);
+    }
+
+    /**
+     * Registers measured durations of a draft model iteration and of a main model step.
+     */
+    void update_step_durations(float draft_iteration_duration, float main_step_duration) {
+        if (draft_iteration_duration <= 0.f || main_step_duration <= 0.f)
+            return;
+        float cost_ratio = draft_iteration_duration / main_step_duration;
+        m_cost_ratio = m_cost_ratio == 0.f ? cost_ratio : m_decay * m_cost_ratio + (1.f - m_decay) * cost_ratio;
+    }
+
+    void remove_request(uint64_t request_id) {
+        m_requests.erase(request_id);
+    }
+};
+
+}
@@ -210,21 +210,115 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::init_r
     return {0, 0};
 }
 
+void
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update_branches(SequenceGroup::Ptr request,
+                                                                                          const GeneratedSequences& candidates) {
+    std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
+    if (running_sequences.empty()) {
+        return;
+    }
+    // new branches share KV cache blocks of the validated part of the sequence
+    Sequence::Ptr sequence_to_fork = running_sequences.front();
+    for (const auto& candidate : candidates) {
+        bool is_branch_present = std::any_of(running_sequences.begin(), running_sequences.end(), [&candidate] (const Sequence::Ptr& sequence) {
+            return sequence->get_grouped_id() == candidate.first;
+        });
+        if (is_branch_present) {
+            continue;
+        }
+        const auto forked_sequence = request->fork_sequence(sequence_to_fork, candidate.first);
+        if (m_scheduler->has_block_table(sequence_to_fork->get_id())) {
+            m_scheduler->fork_sequence(sequence_to_fork->get_id(), forked_sequence->get_id());
+        }
+    }
+}
+
+size_t get_common_prefix_len(const std::vector<int64_t>& lhs, const std::vector<int64_t>& rhs) {
+    const size_t max_prefix_len = std::min(lhs.size(), rhs.size());
+    return std::mismatch(lhs.begin(), lhs.begin() + max_prefix_len, rhs.begin()).first - lhs.begin();
+}
+
+void
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::follow_sequences(SequenceGroup::Ptr request,
+                                                                                           const GeneratedSequences& sequences) {
+    std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
+    bool is_same_sequences = running_sequences.size() == sequences.size() &&
+        std::all_of(running_sequences.begin(), running_sequences.end(), [&sequences] (const Sequence::Ptr& running_sequence) {
+            return sequences.count(running_sequence->get_grouped_id()) > 0;
+        });
+    if (running_sequences.empty() || is_same_sequences) {
+        return;
+    }
+
+    // each sequence of main model continues the running sequence sharing the longest prefix with it,
+    // the one with the same grouped id is preferred
+    std::vector<std::vector<uint64_t>> continuing_grouped_ids(running_sequences.size());
+    for (const auto& sequence : sequences) {
+        size_t continued_idx = 0, continued_prefix_len = 0;
+        for (size_t i = 0; i < running_sequences.size(); ++i) {
+            const size_t prefix_len = get_common_prefix_len(running_sequences[i]->get_generated_ids(), sequence.second.token_ids);
+            if (i == 0 || prefix_len > continued_prefix_len ||
+                (prefix_len == continued_prefix_len && running_sequences[i]->get_grouped_id() == sequence.first)) {
+                continued_idx = i;
+                continued_prefix_len = prefix_len;
+            }
+        }
+        continuing_grouped_ids[continued_idx].push_back(sequence.first);
+    }
+
+    for (size_t i = 0; i < running_sequences.size(); ++i) {
+        const auto& running_sequence = running_sequences[i];
+        const auto& grouped_ids = continuing_grouped_ids[i];
+        if (grouped_ids.empty()) {
+            if (m_scheduler->has_block_table(running_sequence->get_id())) {
+                m_scheduler->free_sequence(running_sequence->get_id());
+            }
+            request->remove_sequence(running_sequence->get_id());
+            continue;
+        }
+
+        // the running sequence itself continues as one of them, others fork it and share its KV cache blocks
+        auto same_id_it = std::find(grouped_ids.begin(), grouped_ids.end(), running_sequence->get_grouped_id());
+        const uint64_t kept_grouped_id = same_id_it != grouped_ids.end() ? *same_id_it : grouped_ids.front();
+        for (const auto grouped_id : grouped_ids) {
+            if (grouped_id == kept_grouped_id) {
+                continue;
+            }
+            const auto forked_sequence = request->fork_sequence(running_sequence, grouped_id);
+            if (m_scheduler->has_block_table(running_sequence->get_id())) {
+                m_scheduler->fork_sequence(running_sequence->get_id(), forked_sequence->get_id());
+            }
+        }
+        running_sequence->set_grouped_id(kept_grouped_id);
+    }
+}
+
 UpdateRequestResult
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update_request(uint64_t request_id,
                                                                                          const GeneratedSequences& candidates,
-                                                                                         bool is_update_logit_processor) {
+                                                                                         bool is_update_logit_processor,
+                                                                                         bool is_keep_drafted_ahead) {
     UpdateRequestResult result{0, 0};
     for (auto& request : m_requests) {
         if (request_id != request->get_request_id()) {
             continue;
         }
 
+        if (!candidates.empty() && !m_is_validation_mode_enabled) {
+            follow_sequences(request, candidates);
+        } else if (!candidates.empty() && request->get_sampling_parameters().num_assistant_branches > 1) {
+            update_branches(request, candidates);
+        }
+
         std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
         OPENVINO_ASSERT(running_sequences.size() > 0);
         size_t min_generated_tokens, min_candidate_len;
-        if (running_sequences.front()->get_generated_len() == 0 && !request->get_num_tokens_to_validate()) {
+        const bool is_init_request = running_sequences.front()->get_generated_len() == 0 && !request->get_num_tokens_to_validate();
+        if (is_init_request) {
             m_sampler->create_logit_processor(request_id, request->get_sampling_parameters(), request->get_prompt_ids());
+        }
+        // several sequences are initialized as existing empty ones
+        if (is_init_request && running_sequences.size() == 1) {
             auto& logit_processor = m_sampler->get_logit_processor(request_id);
             result.inserted_tokens_cnt = init_request(request, candidates, logit_processor, is_update_logit_processor);
             min_generated_tokens = result.inserted_tokens_cnt;
@@ -235,6 +329,14 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             auto& logit_processor = m_sampler->get_logit_processor(request_id);
             std::tie(min_generated_tokens, min_candidate_len) = get_prefix_len(running_sequences, candidates);
 
+            // all validated tokens match the draft, so tokens drafted ahead during validation continue the sequence
+            if (is_keep_drafted_ahead && !m_is_validation_mode_enabled && running_sequences.size() == 1 &&
+                min_generated_tokens == min_candidate_len) {
+                const size_t max_new_tokens = request->get_sampling_parameters().max_new_tokens;
+                request->pause_generation(running_sequences.front()->get_generated_len() >= max_new_tokens - 1);
+                break;
+            }
+
             for (auto& running_sequence : running_sequences) {
                 if (!candidates.count(running_sequence->get_grouped_id())) {
                     continue;
@@ -288,6 +390,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::i
 }
 
 std::vector<SequenceGroup::Ptr> ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_awaiting_requests() {
+    _take_incoming_requests();
     return m_awaiting_requests;
 }
 
@@ -295,9 +398,14 @@ size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl:
     return m_batch_size;
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_prefix_hash_registry(std::shared_ptr<PrefixHashRegistry> prefix_hash_registry,
+                                                                                                    bool is_leader) {
+    m_scheduler->set_prefix_hash_registry(std::move(prefix_hash_registry), is_leader);
+}
+
 void
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_awaiting_requests(bool is_pause_request) {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    _take_incoming_requests();
     if (is_pause_request) {
         for (auto& awaiting_request : m_awaiting_requests) {
             awaiting_request->pause_generation(true);
@@ -307,7 +415,22 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
-void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep(AdaptiveDraftLengthController* draft_length_controller) {
+    // number of draft tokens of requests with `num_assistant_tokens`, chosen by the controller for this step
+    std::map<uint64_t, size_t> num_draft_tokens;
+    if (draft_length_controller) {
+        for (auto& request : m_requests) {
+            const auto& sampling_params = request->get_sampling_parameters();
+            if (sampling_params.num_assistant_tokens == 0)
+                continue;
+            size_t request_num_draft_tokens = draft_length_controller->choose_num_draft_tokens(request->get_request_id(), sampling_params.num_assistant_tokens);
+            num_draft_tokens[request->get_request_id()] = request_num_draft_tokens;
+            // drafting is disabled, the request catches up with the main model's tokens when it drafts again
+            if (request_num_draft_tokens == 0 && request->get_context_len() > request->get_prompt_len())
+                request->pause_generation(true);
+        }
+    }
+
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
     // cycle to generate several tokens per one iteration for speculative decoding case
@@ -327,7 +450,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == 0 && sampling_params.num_return_sequences > 1) {
                 request->pause_generation(true);
-            } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
+            } else if (sampling_params.assistant_confidence_threshold == 0.f &&
+                       (num_draft_tokens.count(request->get_request_id()) ? num_draft_tokens[request->get_request_id()] : sampling_params.num_assistant_tokens) <= generated_tokens_cnt) {
                 request->pause_generation(true);
             } else if (sampling_params.max_new_tokens == 0) {
                 request->pause_generation(true);
@@ -337,5 +461,6 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
             to_generate |= request->can_generate_tokens();
         }
     }
+    return generated_tokens_cnt;
 }
 }
\ No newline at end of file
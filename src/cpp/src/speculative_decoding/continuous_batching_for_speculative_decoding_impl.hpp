@@ -7,6 +7,7 @@
 
 #include "continuous_batching_impl.hpp"
 #include "speculative_decoding/update_request_structs.hpp"
+#include "speculative_decoding/adaptive_draft_length.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -22,12 +23,21 @@ public:
                                                  const ov::AnyMap& plugin_config,
                                                  bool is_validation_mode_enabled);
 
-    void multistep();
+    /**
+     * Generates draft tokens for all requests.
+     * @param draft_length_controller Chooses the number of draft tokens for requests with `num_assistant_tokens`, if set.
+     * @return Number of executed draft model iterations.
+     */
+    size_t multistep(AdaptiveDraftLengthController* draft_length_controller = nullptr);
 
     void finish_request(int64_t request_id = -1);
     void pull_awaiting_requests(bool is_pause_request = false);
     GeneratedRequests get_generated_requests();
-    UpdateRequestResult update_request(uint64_t request_id, const GeneratedSequences& candidates, bool is_update_logit_processor);
+    /**
+     * @param is_keep_drafted_ahead Draft model keeps tokens generated beyond the candidates if all candidates match its sequence.
+     */
+    UpdateRequestResult update_request(uint64_t request_id, const GeneratedSequences& candidates, bool is_update_logit_processor,
+                                       bool is_keep_drafted_ahead = false);
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
 
@@ -35,8 +45,22 @@ public:
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    /**
+     * Shares hashes of cached prefixes with the pipeline of the other model: main model is the leader, see PrefixHashRegistry.
+     */
+    void set_prefix_hash_registry(std::shared_ptr<PrefixHashRegistry> prefix_hash_registry, bool is_leader);
+
 protected:
     void finish_request(SequenceGroup::Ptr request);
+    /**
+     * Tree speculation: main model forks a sequence for each new draft branch to validate all branches in one step.
+     */
+    void update_branches(SequenceGroup::Ptr request, const GeneratedSequences& candidates);
+    /**
+     * Draft model keeps a sequence for each sequence of main model: beam search and parallel sampling fork and drop them
+     * while validating, tree speculation commits one of the branches.
+     */
+    void follow_sequences(SequenceGroup::Ptr request, const GeneratedSequences& sequences);
     void _pull_awaiting_requests() override {};
 };
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "openvino/genai/text_streamer.hpp"
 #include "speculative_decoding_impl.hpp"
 #include "paged_attention_transformations.hpp"
+#include "parallel_model_loader.hpp"
 #include "utils.hpp"
 
 
@@ -25,6 +26,45 @@ bool are_tokenizers_equal(Tokenizer& lhs, Tokenizer& rhs) {
            lhs.get_bos_token_id() == rhs.get_bos_token_id() && lhs.get_pad_token_id() == rhs.get_pad_token_id();
 }
 
+// creates a thread executing a model, bound to the given CPUs if any
+std::unique_ptr<ThreadPool> create_model_worker(const std::vector<size_t>& cpus, bool is_worker_required, const std::string& device, ov::AnyMap& properties) {
+    if (cpus.empty() && !is_worker_required) {
+        return nullptr;
+    }
+    auto worker = std::make_unique<ThreadPool>(1);
+    if (!cpus.empty()) {
+        worker->submit([cpus] { utils::set_current_thread_affinity(cpus); }).wait();
+        // inference threads of the model are created by the bound thread and use its CPUs
+        if (device.find("CPU") != std::string::npos && properties.find(ov::inference_num_threads.name()) == properties.end()) {
+            properties[ov::inference_num_threads.name()] = static_cast<int32_t>(cpus.size());
+        }
+    }
+    return worker;
+}
+
+// draft model continues each sequence of main model, which forks and drops sequences while validating:
+// beam search is drafted greedily, parallel sampling by a single sample per sequence
+GenerationConfig get_draft_sampling_params(GenerationConfig sampling_params) {
+    // set the parameters do not stop draft generation without stopping of the same request for main pipeline
+    sampling_params.ignore_eos = true;
+    sampling_params.stop_strings = {};
+    if (sampling_params.is_beam_search()) {
+        sampling_params.num_beams = 1;
+        sampling_params.num_beam_groups = 1;
+        sampling_params.diversity_penalty = 0.0f;
+    }
+    sampling_params.num_return_sequences = 1;
+    return sampling_params;
+}
+
+template <typename Task>
+auto run_on_worker(ThreadPool* worker, Task&& task) {
+    if (worker) {
+        return worker->submit(std::forward<Task>(task)).get();
+    }
+    return task();
+}
+
 ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(const ov::genai::ModelDesc& main_model_desc, 
                                                                              const ov::genai::ModelDesc& draft_model_desc) {
     auto main_model = main_model_desc.model;
@@ -35,6 +75,13 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
 
     auto main_kv_cache_config = utils::apply_paged_attention_transformations(main_model, main_model_desc.scheduler_config.use_cache_eviction);
     auto draft_kv_cache_config = utils::apply_paged_attention_transformations(draft_model, main_model_desc.scheduler_config.use_cache_eviction);
+    if (draft_model_desc.num_early_exit_layers > 0) {
+        // self-speculative decoding: draft model is a copy of the main model sharing its weights. For the same token at the same position
+        // the kept layers produce the same KV cache as the ones of the main model, but the draft model has its own KV cache of these layers,
+        // as the block managers of both pipelines are independent: it costs KV cache memory of the kept layers, not correctness
+        utils::apply_early_exit_transformation(draft_model, draft_model_desc.num_early_exit_layers);
+        draft_kv_cache_config.resize(draft_model_desc.num_early_exit_layers);
+    }
 
     utils::apply_gather_before_matmul_transformation(main_model);
     utils::apply_gather_before_matmul_transformation(draft_model);
@@ -69,8 +116,38 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
         main_scheduler_config_updated.cache_size = main_cache_size;
         draft_scheduler_config.cache_size = draft_cache_size;
     }
+    // draft model still prefills prompts into its own KV cache; prefix caching is forced on for it only to reuse its own cached
+    // prefixes, which it evicts last if main model has them cached too (see PrefixHashRegistry below)
+    draft_scheduler_config.enable_prefix_caching |= main_scheduler_config.enable_prefix_caching;
 
+    ov::AnyMap main_properties = main_model_desc.properties;
     ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+    bool is_adaptive_num_assistant_tokens = utils::pop_or_default(main_properties, ov::genai::adaptive_num_assistant_tokens.name(), false);
+    is_adaptive_num_assistant_tokens |= utils::pop_or_default(draft_properties, ov::genai::adaptive_num_assistant_tokens.name(), false);
+    if (is_adaptive_num_assistant_tokens) {
+        m_draft_length_controller.emplace();
+    }
+    m_is_pipelined = utils::pop_or_default(main_properties, ov::genai::pipelined_speculative_decoding.name(), false);
+    m_is_pipelined |= utils::pop_or_default(draft_properties, ov::genai::pipelined_speculative_decoding.name(), false);
+
+    std::vector<size_t> main_cpus = utils::pop_or_default(main_properties, ov::genai::cpu_affinity.name(), std::vector<size_t>{}),
+                        draft_cpus = utils::pop_or_default(draft_properties, ov::genai::cpu_affinity.name(), std::vector<size_t>{});
+    // draft model inheriting properties of main model doesn't share its CPUs
+    if (draft_model_desc.properties.empty()) {
+        draft_cpus.clear();
+    }
+    const bool is_cpu_device = main_device.find("CPU") != std::string::npos && draft_device.find("CPU") != std::string::npos;
+    if (m_is_pipelined && is_cpu_device && main_cpus.empty() && draft_cpus.empty()) {
+        // overlapped models don't compete for cores and memory bandwidth if they run on different NUMA nodes
+        auto numa_nodes_cpus = utils::get_numa_nodes_cpus();
+        if (numa_nodes_cpus.size() > 1) {
+            main_cpus = numa_nodes_cpus[0];
+            draft_cpus = numa_nodes_cpus[1];
+        }
+    }
+    // main model is executed by its own thread in pipelined mode, so draft model can be executed at the same time
+    m_main_worker = create_model_worker(main_cpus, m_is_pipelined, main_device, main_properties);
+    m_draft_worker = create_model_worker(draft_cpus, false, draft_device, draft_properties);
 
     // main and draft model can have different tokenizers
     // to do: support retokenization: 154103
@@ -83,12 +160,30 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     m_tokenizer = main_model_tokenizer;
 
     // to create `main_pipeline` with enabled validation_mode and `draft_pipeline` with disabled validation mode
-    m_main_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
-        main_model, main_model_tokenizer, main_model_desc.generation_config,
-        main_kv_cache_config, main_scheduler_config_updated, main_device, main_model_desc.properties, true);
-    m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
-        draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
-        draft_kv_cache_config, draft_scheduler_config, draft_device, draft_properties, false);
+    // models are compiled by the threads executing them, so they use CPUs of the threads
+    utils::ParallelModelLoader loader;
+    loader.add("main_model", [&] {
+        m_main_pipeline = run_on_worker(m_main_worker.get(), [&] {
+            return std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
+                main_model, main_model_tokenizer, main_model_desc.generation_config,
+                main_kv_cache_config, main_scheduler_config_updated, main_device, main_properties, true);
+        });
+    });
+    loader.add("draft_model", [&] {
+        m_draft_pipeline = run_on_worker(m_draft_worker.get(), [&] {
+            return std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
+                draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
+                draft_kv_cache_config, draft_scheduler_config, draft_device, draft_properties, false);
+        });
+    });
+    m_load_timeline = loader.wait();
+    if (main_scheduler_config_updated.enable_prefix_caching) {
+        // with the KV cache split in proportion to hidden sizes, both models have about the same number of blocks,
+        // so draft model usually keeps prefixes cached by main model, but it's not guaranteed
+        auto prefix_hash_registry = std::make_shared<PrefixHashRegistry>();
+        m_main_pipeline->set_prefix_hash_registry(prefix_hash_registry, true);
+        m_draft_pipeline->set_prefix_hash_registry(prefix_hash_registry, false);
+    }
 
     m_perf_metrics = PerfMetrics();
     m_perf_metrics.raw_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
@@ -101,10 +196,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
                                                                  ov::genai::GenerationConfig sampling_params) {
     m_sd_metrics.set_generated_len(request_id, sampling_params.max_new_tokens);
     std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
-    auto draft_sampling_params = sampling_params;
-    draft_sampling_params.ignore_eos = true;
-    draft_sampling_params.stop_strings = {};
-    m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids, draft_sampling_params)});
+    m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids, get_draft_sampling_params(sampling_params))});
     return m_main_pipeline->add_request(request_id, input_ids, sampling_params);
 };
 
@@ -114,10 +206,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
                                                                  ov::genai::GenerationConfig sampling_params) {
     m_sd_metrics.set_generated_len(request_id, sampling_params.max_new_tokens);
     std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
-    auto draft_sampling_params = sampling_params;
-    draft_sampling_params.ignore_eos = true;
-    draft_sampling_params.stop_strings = {};
-    m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, prompt, draft_sampling_params)});
+    m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, prompt, get_draft_sampling_params(sampling_params))});
     return m_main_pipeline->add_request(request_id, prompt, sampling_params);
 }
 
@@ -150,34 +239,92 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_draft_pipeline->pull_awaiting_requests(true);
     m_main_pipeline->pull_awaiting_requests();
 
-    // generate candidates by draft model
     ManualTimer draft_timer("speculative_decoding: draft_model: multistep()");
-    draft_timer.start();
-    m_draft_pipeline->multistep();
-    draft_timer.end();
-    m_sd_metrics.draft_duration += draft_timer.get_duration();
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
+    size_t num_draft_iterations = 0;
+    // generate candidates by draft model
+    auto run_draft = [&] {
+        draft_timer.start();
+        num_draft_iterations = m_draft_pipeline->multistep(m_draft_length_controller ? &m_draft_length_controller.value() : nullptr);
+        draft_timer.end();
+    };
+    ManualTimer main_timer("speculative_decoding: main_model: step()");
+    auto run_main = [&] {
+        main_timer.start();
+        m_main_pipeline->step();
+        main_timer.end();
+    };
 
     // to generate num_matches statistic
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
+    GeneratedRequests draft_generated_requests;
     // put candidates to model KV cache
-    auto draft_generated_requests = m_draft_pipeline->get_generated_requests();
-    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
-        auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
-        update_sequence_info.insert({{candidate.first, update_result}});
-    }
+    auto put_candidates = [&] {
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        for (const auto& candidate : draft_generated_requests) {
+            auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
+            update_sequence_info.insert({{candidate.first, update_result}});
+        }
+    };
+
+    // number of tokens generated by draft model while main model validated the candidates, per request
+    std::map<uint64_t, size_t> num_drafted_ahead_tokens;
+    if (m_is_pipelined) {
+        // main model validates candidates of the previous step, while draft model continues them assuming all are accepted
+        put_candidates();
+        std::map<uint64_t, size_t> candidates_len;
+        for (const auto& candidate : draft_generated_requests) {
+            if (!candidate.second.empty()) {
+                candidates_len[candidate.first] = candidate.second.begin()->second.token_ids.size();
+            }
+        }
 
-    ManualTimer main_timer("speculative_decoding: main_model: step()");
-    main_timer.start();
-    m_main_pipeline->step();
-    main_timer.end();
+        auto main_future = m_main_worker->submit(run_main);
+        std::exception_ptr exception;
+        try {
+            run_on_worker(m_draft_worker.get(), run_draft);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        // wait for main model before rethrowing an exception of draft model
+        try {
+            main_future.get();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+
+        for (const auto& drafted_request : m_draft_pipeline->get_generated_requests()) {
+            auto candidates_len_it = candidates_len.find(drafted_request.first);
+            if (candidates_len_it == candidates_len.end() || drafted_request.second.empty()) {
+                continue;
+            }
+            size_t drafted_len = drafted_request.second.begin()->second.token_ids.size();
+            if (drafted_len > candidates_len_it->second) {
+                num_drafted_ahead_tokens[drafted_request.first] = drafted_len - candidates_len_it->second;
+            }
+        }
+    } else {
+        run_on_worker(m_draft_worker.get(), run_draft);
+        put_candidates();
+        run_on_worker(m_main_worker.get(), run_main);
+    }
+    m_sd_metrics.draft_duration += draft_timer.get_duration();
     m_sd_metrics.main_duration += main_timer.get_duration();
+    bool is_draft_model_executed = m_draft_pipeline->get_processed_tokens_per_iteration() > 0;
     m_pipeline_metrics = m_main_pipeline->get_metrics();
+    if (m_draft_length_controller && is_draft_model_executed && num_draft_iterations > 0) {
+        m_draft_length_controller->update_step_durations(draft_timer.get_duration() / num_draft_iterations, main_timer.get_duration());
+    }
 
     auto main_generated_requests = m_main_pipeline->get_generated_requests();
     for (const auto& checked_sequence : main_generated_requests) {
-        auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
-        update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
+        auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true, m_is_pipelined);
+        // tokens drafted ahead are not validated yet, so they are not counted as rejected
+        auto num_drafted_ahead_it = num_drafted_ahead_tokens.find(checked_sequence.first);
+        size_t num_drafted_ahead = num_drafted_ahead_it == num_drafted_ahead_tokens.end() ? 0 : num_drafted_ahead_it->second;
+        update_sequence_info[checked_sequence.first].removed_tokens_cnt =
+            update_result.removed_tokens_cnt > num_drafted_ahead ? update_result.removed_tokens_cnt - num_drafted_ahead : 0;
     }
 
     // finish draft request if the generation was completed
@@ -187,8 +334,15 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
             m_draft_pipeline->finish_request(request_id);
             // remove draft_generation_handle from queue
             m_draft_generations.erase(request_id);
+            if (m_draft_length_controller) {
+                m_draft_length_controller->remove_request(request_id);
+            }
         }
         auto updated_seq_info = update_sequence_info[request_id];
+        if (m_draft_length_controller && updated_seq_info.inserted_tokens_cnt == 0 && m_draft_length_controller->get_num_draft_tokens(request_id) == 0) {
+            // drafting is disabled for the request
+            m_sd_metrics.update_draft_len(request_id, 0);
+        }
         // several prompt phase
         if (updated_seq_info.inserted_tokens_cnt == 0) {
             continue;
@@ -196,6 +350,11 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+        m_sd_metrics.update_draft_len(request_id, updated_seq_info.inserted_tokens_cnt);
+        if (m_draft_length_controller) {
+            m_draft_length_controller->update_acceptance(request_id, updated_seq_info.inserted_tokens_cnt,
+                                                         updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt);
+        }
     }
 
     // update perf metrics
@@ -249,12 +408,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
         main_generations.push_back(m_main_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id]));
 
-        auto draft_sampling_params = sampling_params[request_id];
-        // set the parameters do not stop draft generation without stopping of the same request for main pipeline
-        draft_sampling_params.ignore_eos = true;
-        draft_sampling_params.stop_strings = {};
         std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
-        m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids[request_id], draft_sampling_params)});
+        m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids[request_id], get_draft_sampling_params(sampling_params[request_id]))});
     }
     auto all_requests = get_awaiting_requests();
 
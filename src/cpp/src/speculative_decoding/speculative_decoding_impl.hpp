@@ -7,6 +7,7 @@
 #include "continuous_batching_impl.hpp"
 #include "continuous_batching_for_speculative_decoding_impl.hpp"
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
+#include "threadpool.hpp"
 
 namespace ov::genai {
 
@@ -17,6 +18,8 @@ struct ModelDesc {
     ov::genai::GenerationConfig generation_config;
     std::shared_ptr<ov::Model> model = nullptr;
     ov::genai::Tokenizer tokenizer;
+    // if set, the draft model is the main model exiting after this number of decoder layers
+    size_t num_early_exit_layers = 0;
 
     ModelDesc(const std::shared_ptr<ov::Model>& model,
               const ov::genai::Tokenizer& tokenizer,
@@ -34,6 +37,8 @@ struct ModelDesc {
     ModelDesc() = default;
 };
 
+bool are_tokenizers_equal(Tokenizer& lhs, Tokenizer& rhs);
+
 class ContinuousBatchingPipeline::SpeculativeDecodingImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
 protected:
     std::shared_ptr<ContinuousBatchingForSpeculativeDecodingImpl> m_main_pipeline, m_draft_pipeline;
@@ -45,6 +50,14 @@ protected:
     std::mutex m_draft_generations_mutex;
     std::map<uint64_t, GenerationHandle> m_draft_generations;
 
+    // chooses the number of draft tokens of each request at every step, set if `adaptive_num_assistant_tokens` property is enabled
+    std::optional<AdaptiveDraftLengthController> m_draft_length_controller;
+
+    // set if `pipelined_speculative_decoding` property is enabled: draft model drafts ahead while main model validates
+    bool m_is_pipelined = false;
+    // threads executing main and draft models, bound to CPUs of the models if any; models are executed by the calling thread if not set
+    std::unique_ptr<ThreadPool> m_main_worker, m_draft_worker;
+
     void drop_requests();
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
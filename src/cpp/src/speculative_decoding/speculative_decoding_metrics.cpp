@@ -39,6 +39,40 @@ size_t SpeculativeDecodingMetrics::get_iteration_number(int64_t request_id) {
     return m_acceptance_rate[request_id].size();
 }
 
+float SpeculativeDecodingMetrics::get_avg_acceptance_len(int64_t request_id) {
+    size_t num_accepted_tokens = 0, num_iterations = 0;
+    for (const auto& acceptance_rate : m_acceptance_rate) {
+        if (request_id != -1 && acceptance_rate.first != request_id)
+            continue;
+        num_iterations += acceptance_rate.second.size();
+        if (m_draft_accepted_tokens.count(acceptance_rate.first))
+            num_accepted_tokens += m_draft_accepted_tokens[acceptance_rate.first];
+    }
+    return num_iterations > 0 ? static_cast<float>(num_accepted_tokens) / num_iterations : 0.f;
+}
+
+float SpeculativeDecodingMetrics::get_avg_draft_len(int64_t request_id) {
+    float avg_draft_len = 0.f;
+    if (request_id == -1) {
+        size_t total_iteration_cnt = 0;
+        for (const auto& draft_len : m_draft_len) {
+            avg_draft_len += std::accumulate(draft_len.second.begin(), draft_len.second.end(), size_t(0));
+            total_iteration_cnt += draft_len.second.size();
+        }
+        if (total_iteration_cnt > 0)
+            avg_draft_len /= total_iteration_cnt;
+    } else if (m_draft_len.count(request_id)) {
+        const auto& draft_len = m_draft_len[request_id];
+        avg_draft_len = std::accumulate(draft_len.begin(), draft_len.end(), size_t(0));
+        avg_draft_len /= draft_len.size();
+    }
+    return avg_draft_len;
+}
+
+void SpeculativeDecodingMetrics::update_draft_len(int64_t request_id, size_t draft_len) {
+    m_draft_len[request_id].push_back(draft_len);
+}
+
 float SpeculativeDecodingMetrics::get_draft_duration_percentage() {
     return (draft_duration / total_duration) * 100;
 }
@@ -107,6 +141,15 @@ std::vector<int64_t> SpeculativeDecodingMetrics::get_requests_id() {
     return result;
 }
 
+float SpeculativeDecodingMetrics::get_retrieval_acceptance_rate() {
+    return m_retrieved_tokens > 0 ? static_cast<float>(m_retrieved_accepted_tokens) / m_retrieved_tokens * 100 : 0.f;
+}
+
+void SpeculativeDecodingMetrics::update_retrieval_acceptance(size_t num_retrieved_tokens, size_t num_accepted_tokens) {
+    m_retrieved_tokens += num_retrieved_tokens;
+    m_retrieved_accepted_tokens += num_accepted_tokens;
+}
+
 void SpeculativeDecodingMetrics::print_acceptance_rates() {
     for (const auto& a : m_acceptance_rate) {
         std::cout << "Request_id: " << a.first << " ||| ";
@@ -128,6 +171,12 @@ void SpeculativeDecodingMetrics::print(bool is_printing_per_request) {
     std::cout << "Draft model duration, %: " << get_draft_duration_percentage() << std::endl;
     std::cout << "Main model duration, %: " << get_main_duration_percentage() << std::endl;
     std::cout << "AVG acceptance rate, %: " << get_avg_acceptance_rate(-1) << std::endl;
+    std::cout << "AVG draft length: " << get_avg_draft_len(-1) << std::endl;
+    std::cout << "AVG acceptance length: " << get_avg_acceptance_len(-1) << std::endl;
+    if (m_retrieved_tokens > 0) {
+        std::cout << "Retrieved candidates: " << m_retrieved_tokens << std::endl;
+        std::cout << "Retrieved candidates acceptance rate, %: " << get_retrieval_acceptance_rate() << std::endl;
+    }
     std::cout << "=============================== " << std::endl;
     if (is_printing_per_request) {
         for (const auto& i : get_requests_id()) {
@@ -135,6 +184,8 @@ void SpeculativeDecodingMetrics::print(bool is_printing_per_request) {
             std::cout << "Main model iterations: " << get_iteration_number(i) << std::endl;
             std::cout << "Token per sec: " << float(get_generated_len(i)) / total_duration << std::endl;
             std::cout << "AVG acceptance rate, %: " << get_avg_acceptance_rate(i) << std::endl;
+            std::cout << "AVG draft length: " << get_avg_draft_len(i) << std::endl;
+            std::cout << "AVG acceptance length: " << get_avg_acceptance_len(i) << std::endl;
             std::cout << "Accepted tokens by draft model: " << get_draft_accepted_tokens_counter(i) << std::endl;
             std::cout << "Generated tokens: " << get_generated_len(i) << std::endl;
             std::cout << "Accepted token rate, %: " << get_draft_accepted_tokens_percentage(i) << std::endl;
@@ -149,6 +200,9 @@ void SpeculativeDecodingMetrics::clean_up() {
     m_acceptance_rate.clear();
     m_draft_accepted_tokens.clear();
     m_generated_len.clear();
+    m_draft_len.clear();
+    m_retrieved_tokens = 0;
+    m_retrieved_accepted_tokens = 0;
     draft_duration = 0;
     main_duration = 0;
     total_duration = 0;
@@ -16,6 +16,10 @@ class SpeculativeDecodingMetrics {
 
     std::map<int64_t, size_t> m_draft_accepted_tokens;
     std::map<int64_t, size_t> m_generated_len;
+    // { request_id, number of draft tokens at each step }
+    std::map<int64_t, std::vector<size_t>> m_draft_len;
+    // candidates retrieved from the datastore of prompt lookup decoding and accepted ones, for all requests
+    size_t m_retrieved_tokens = 0, m_retrieved_accepted_tokens = 0;
 
 public:
     float draft_duration = 0, main_duration = 0, total_duration = 0;
@@ -32,6 +36,15 @@ public:
 
     size_t get_iteration_number(int64_t request_id);
 
+    // average number of draft tokens accepted per main model iteration
+    float get_avg_acceptance_len(int64_t request_id);
+
+    float get_avg_draft_len(int64_t request_id);
+    void update_draft_len(int64_t request_id, size_t draft_len);
+
+    float get_retrieval_acceptance_rate();
+    void update_retrieval_acceptance(size_t num_retrieved_tokens, size_t num_accepted_tokens);
+
     float get_draft_duration_percentage();
     float get_main_duration_percentage();
     float get_inference_duration_percentage();
@@ -0,0 +1,124 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "speculative_decoding/stateful_drafter.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+// returns the most probable token of logits row and its probability
+std::pair<int64_t, float> get_greedy_token(const float* logits, size_t vocab_size) {
+    const float* max_logit = std::max_element(logits, logits + vocab_size);
+    float sum_exp = 0.f;
+    for (size_t i = 0; i < vocab_size; ++i) {
+        sum_exp += std::exp(logits[i] - *max_logit);
+    }
+    return {std::distance(logits, max_logit), 1.f / sum_exp};
+}
+
+}  // namespace
+
+StatefulDraftModel::StatefulDraftModel(ModelDesc draft_model_desc, Tokenizer main_model_tokenizer, const std::string& main_model_device) {
+    OPENVINO_ASSERT(draft_model_desc.model != nullptr, "Draft model is not set");
+    OPENVINO_ASSERT(are_tokenizers_equal(main_model_tokenizer, draft_model_desc.tokenizer), "Tokenizers for draft and main models are different!");
+
+    auto model = draft_model_desc.model;
+    utils::apply_slice_before_matmul_transformation(model);
+    m_kv_seq_len_axis = utils::get_kv_axes_pos(model).seq_len;
+    m_has_position_ids = model->inputs().size() == 4;
+
+    const std::string device = draft_model_desc.device.empty() ? main_model_device : draft_model_desc.device;
+    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, draft_model_desc.properties);
+    m_request = compiled_model.create_infer_request();
+    utils::print_compiled_model_properties(compiled_model, "Stateful draft model");
+
+    ov::Tensor beam_idx(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+    m_request.set_tensor("beam_idx", beam_idx);
+}
+
+ov::Tensor StatefulDraftModel::infer(const int64_t* tokens, size_t num_tokens) {
+    const size_t kv_cache_len = m_kv_tokens.size();
+    m_kv_tokens.insert(m_kv_tokens.end(), tokens, tokens + num_tokens);
+
+    ov::Tensor input_ids(ov::element::i64, {1, num_tokens});
+    std::copy_n(tokens, num_tokens, input_ids.data<int64_t>());
+    m_request.set_tensor("input_ids", input_ids);
+
+    ov::Tensor attention_mask(ov::element::i64, {1, m_kv_tokens.size()});
+    std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+    m_request.set_tensor("attention_mask", attention_mask);
+
+    if (m_has_position_ids) {
+        ov::Tensor position_ids(ov::element::i64, {1, num_tokens});
+        std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + num_tokens, static_cast<int64_t>(kv_cache_len));
+        m_request.set_tensor("position_ids", position_ids);
+    }
+
+    m_request.infer();
+    return m_request.get_tensor("logits");
+}
+
+TokenIds StatefulDraftModel::get_candidates(const TokenIds& tokens, const GenerationConfig& config, size_t max_num_candidates) {
+    if (max_num_candidates == 0 || tokens.empty()) {
+        return {};
+    }
+
+    // KV cache keeps the common prefix, the last token is inferred anyway to get logits of the first candidate
+    const size_t common_prefix_len = std::distance(m_kv_tokens.begin(), std::mismatch(m_kv_tokens.begin(), m_kv_tokens.end(), tokens.begin(), tokens.end()).first);
+    const size_t num_kept_tokens = std::min(common_prefix_len, tokens.size() - 1);
+    if (num_kept_tokens == 0) {
+        m_request.reset_state();
+    } else {
+        utils::trim_kv_cache(m_request, m_kv_tokens.size() - num_kept_tokens, m_kv_seq_len_axis, std::nullopt);
+    }
+    m_kv_tokens.resize(num_kept_tokens);
+
+    TokenIds candidates;
+    ov::Tensor logits = infer(tokens.data() + num_kept_tokens, tokens.size() - num_kept_tokens);
+    while (true) {
+        const size_t vocab_size = logits.get_shape().back();
+        const float* last_logits = logits.data<const float>() + logits.get_size() - vocab_size;
+        const auto [token, probability] = get_greedy_token(last_logits, vocab_size);
+        // dynamic strategy: drafting stops on a candidate the draft model isn't confident in
+        if (config.assistant_confidence_threshold > 0.f && probability < config.assistant_confidence_threshold) {
+            break;
+        }
+        candidates.push_back(token);
+        // the last candidate is inferred by the main model only
+        if (candidates.size() == max_num_candidates) {
+            break;
+        }
+        logits = infer(&candidates.back(), 1);
+    }
+    return candidates;
+}
+
+void StatefulPromptLookup::start(const GenerationConfig& config) {
+    m_ngram_index.reset();
+    if (config.is_prompt_lookup()) {
+        m_ngram_index.emplace(config.max_ngram_size);
+    }
+}
+
+TokenIds StatefulPromptLookup::get_candidates(const TokenIds& tokens, const GenerationConfig& config, size_t max_num_candidates) {
+    if (max_num_candidates == 0 || !m_ngram_index.has_value()) {
+        return {};
+    }
+
+    OPENVINO_ASSERT(m_ngram_index->size() <= tokens.size());
+    m_ngram_index->append(tokens.begin() + m_ngram_index->size(), tokens.end());
+    TokenIds candidates = m_ngram_index->find_candidates(max_num_candidates);
+    if (candidates.empty() && m_datastore) {
+        candidates = m_datastore->find_candidates(m_ngram_index->get_last_tokens(config.max_ngram_size), max_num_candidates, config.max_ngram_size);
+    }
+    return candidates;
+}
+
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "openvino/genai/generation_config.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "prompt_lookup/ngram_index.hpp"
+#include "prompt_lookup/retrieval_datastore.hpp"
+#include "sequence_group.hpp"
+#include "speculative_decoding/speculative_decoding_impl.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Source of candidates of assisting generation in the stateful LLM pipeline: the main model validates all candidates
+ * of a step by a single inference, and KV cache of the rejected ones is trimmed.
+ * Candidates are proposed deterministically, so multinomial sampling validates them as drafted with probability 1.
+ */
+class StatefulDrafter {
+public:
+    virtual ~StatefulDrafter() = default;
+
+    // called at the start of each generation
+    virtual void start(const GenerationConfig& config) {}
+
+    /**
+     * @param tokens Tokens validated by the main model: prompt, including chat history, and generated ones.
+     * Tokens of a generation only grow between calls.
+     * @return Up to `max_num_candidates` tokens continuing `tokens`.
+     */
+    virtual TokenIds get_candidates(const TokenIds& tokens, const GenerationConfig& config, size_t max_num_candidates) = 0;
+};
+
+/**
+ * @brief Candidates are generated greedily by a stateful draft model. Its KV cache is synchronized with validated tokens
+ * by their common prefix: rejected candidates are trimmed, while the prefix of the previous generation or chat turn is reused.
+ */
+class StatefulDraftModel : public StatefulDrafter {
+    ov::InferRequest m_request;
+    size_t m_kv_seq_len_axis = 2;
+    bool m_has_position_ids = false;
+    // tokens contained in KV cache of the draft model
+    TokenIds m_kv_tokens;
+
+    // infers tokens following `m_kv_tokens`, returns logits of the last one
+    ov::Tensor infer(const int64_t* tokens, size_t num_tokens);
+
+public:
+    StatefulDraftModel(ModelDesc draft_model_desc, Tokenizer main_model_tokenizer, const std::string& main_model_device);
+
+    TokenIds get_candidates(const TokenIds& tokens, const GenerationConfig& config, size_t max_num_candidates) override;
+};
+
+/**
+ * @brief Candidates are continuations of the last n-gram of a sequence found earlier in the sequence,
+ * or in a datastore of documents if it's set and the sequence doesn't contain the n-gram.
+ */
+class StatefulPromptLookup : public StatefulDrafter {
+    std::optional<NGramIndex> m_ngram_index;
+    std::shared_ptr<const RetrievalDatastore> m_datastore;
+
+public:
+    explicit StatefulPromptLookup(std::shared_ptr<const RetrievalDatastore> datastore = nullptr) :
+        m_datastore(std::move(datastore)) {}
+
+    void start(const GenerationConfig& config) override;
+
+    TokenIds get_candidates(const TokenIds& tokens, const GenerationConfig& config, size_t max_num_candidates) override;
+};
+
+}
@@ -0,0 +1,347 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include "stateful_batching/stateful_batching_impl.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+// copies columns of a variable state along its sequence axis
+ov::Tensor gather_columns(const ov::Tensor& state, size_t seq_len_axis, const std::vector<size_t>& columns) {
+    ov::Shape shape = state.get_shape();
+    const size_t num_outer = std::accumulate(shape.begin(), shape.begin() + seq_len_axis, size_t{1}, std::multiplies<size_t>());
+    const size_t column_byte_size = std::accumulate(shape.begin() + seq_len_axis + 1, shape.end(), state.get_element_type().size(), std::multiplies<size_t>());
+    const size_t seq_len = shape[seq_len_axis];
+
+    shape[seq_len_axis] = columns.size();
+    ov::Tensor gathered(state.get_element_type(), shape);
+    const uint8_t* src = static_cast<const uint8_t*>(state.data());
+    uint8_t* dst = static_cast<uint8_t*>(gathered.data());
+    for (size_t outer = 0; outer < num_outer; ++outer) {
+        for (size_t column : columns) {
+            std::memcpy(dst, src + (outer * seq_len + column) * column_byte_size, column_byte_size);
+            dst += column_byte_size;
+        }
+    }
+    return gathered;
+}
+
+}  // namespace
+
+ContinuousBatchingPipeline::StatefulBatchingImpl::StatefulBatchingImpl(const std::shared_ptr<ov::Model>& model,
+                                                                       const Tokenizer& tokenizer,
+                                                                       const std::string& device,
+                                                                       const ov::AnyMap& properties,
+                                                                       const ov::genai::GenerationConfig& generation_config,
+                                                                       size_t max_batch_size) :
+    m_sampler(tokenizer),
+    m_max_batch_size(max_batch_size) {
+    m_tokenizer = tokenizer;
+    m_generation_config = generation_config;
+    OPENVINO_ASSERT(m_max_batch_size > 0, "Stateful batching requires max batch size greater than 0");
+    OPENVINO_ASSERT(device.find("NPU") == std::string::npos, "Stateful batching is not supported on NPU");
+
+    // only logits of the last token of each row are sampled
+    utils::apply_slice_before_matmul_transformation(model);
+    m_kv_seq_len_axis = utils::get_kv_axes_pos(model).seq_len;
+    m_has_position_ids = model->inputs().size() == 4;
+
+    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, properties);
+    m_request = compiled_model.create_infer_request();
+    utils::print_compiled_model_properties(compiled_model, "Stateful batching LLM model");
+
+    const int64_t pad_token_id = m_tokenizer.get_pad_token_id();
+    m_pad_token_id = pad_token_id >= 0 ? pad_token_id : 0;
+    if (m_generation_config.eos_token_id == -1)
+        m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+    m_sampler.set_seed(m_generation_config.rng_seed);
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::StatefulBatchingImpl::add_request(uint64_t request_id,
+                                                              const ov::Tensor& input_ids,
+                                                              ov::genai::GenerationConfig sampling_params) {
+    if (sampling_params.stop_token_ids.empty())
+        sampling_params.stop_token_ids = m_generation_config.stop_token_ids;
+    if (sampling_params.eos_token_id == -1)
+        sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
+    sampling_params.validate();
+    OPENVINO_ASSERT(!sampling_params.is_beam_search() && sampling_params.num_return_sequences == 1,
+                    "Stateful batching supports only greedy and multinomial decoding with a single sequence per request");
+    OPENVINO_ASSERT(input_ids.get_shape().at(0) == 1, "Use multiple tensors to pass a batch.");
+
+    constexpr size_t block_size = 1;
+    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, block_size);
+    GenerationHandle handle = std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
+
+    std::lock_guard<std::mutex> lock{m_incoming_requests_mutex};
+    m_incoming_requests.push_back(std::move(sequence_group));
+    return handle;
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::StatefulBatchingImpl::add_request(uint64_t request_id,
+                                                              const std::string& prompt,
+                                                              ov::genai::GenerationConfig sampling_params) {
+    static ManualTimer timer("tokenize");
+    timer.start();
+    ov::Tensor input_ids = m_tokenizer.encode(prompt).input_ids;
+    timer.end();
+    return add_request(request_id, input_ids, sampling_params);
+}
+
+void ContinuousBatchingPipeline::StatefulBatchingImpl::_take_incoming_requests() {
+    std::lock_guard<std::mutex> lock{m_incoming_requests_mutex};
+    m_awaiting_requests.insert(m_awaiting_requests.end(), m_incoming_requests.begin(), m_incoming_requests.end());
+    m_incoming_requests.clear();
+}
+
+bool ContinuousBatchingPipeline::StatefulBatchingImpl::has_non_finished_requests() {
+    std::lock_guard<std::mutex> lock{m_incoming_requests_mutex};
+    return !m_incoming_requests.empty() || !m_awaiting_requests.empty() || !m_rows.empty();
+}
+
+std::vector<int32_t> ContinuousBatchingPipeline::StatefulBatchingImpl::_free_non_running_requests() {
+    std::vector<int32_t> kept_rows;
+    size_t num_kept_rows = 0;
+    for (size_t row = 0; row < m_rows.size(); ++row) {
+        const SequenceGroup::Ptr& request = m_rows[row];
+        if (request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
+            // unblocks read() of handles dropped by users
+            if (request->handle_stopped() || request->handle_cancelled())
+                request->push_empty_outputs();
+            m_sampler.clear_request_info(request->get_request_id());
+            continue;
+        }
+        kept_rows.push_back(static_cast<int32_t>(row));
+        if (num_kept_rows != row) {
+            m_rows[num_kept_rows] = request;
+            m_attention_mask[num_kept_rows] = std::move(m_attention_mask[row]);
+            m_num_attended_tokens[num_kept_rows] = m_num_attended_tokens[row];
+        }
+        ++num_kept_rows;
+    }
+    m_rows.resize(num_kept_rows);
+    m_attention_mask.resize(num_kept_rows);
+    m_num_attended_tokens.resize(num_kept_rows);
+    return kept_rows;
+}
+
+size_t compact_kv_cache(ov::InferRequest& request, size_t seq_len_axis, std::vector<std::vector<int64_t>>& attention_mask, size_t kv_cache_len) {
+    std::vector<size_t> attended_columns;
+    for (size_t column = 0; column < kv_cache_len; ++column) {
+        bool is_attended = false;
+        for (size_t row = 0; row < attention_mask.size() && !is_attended; ++row) {
+            is_attended = attention_mask[row][column] != 0;
+        }
+        if (is_attended)
+            attended_columns.push_back(column);
+    }
+    if (attended_columns.size() * 2 > kv_cache_len)
+        return kv_cache_len;
+
+    for (auto& state : request.query_state()) {
+        state.set_state(gather_columns(state.get_state(), seq_len_axis, attended_columns));
+    }
+    for (auto& row_mask : attention_mask) {
+        std::vector<int64_t> compacted_mask;
+        compacted_mask.reserve(attended_columns.size());
+        for (size_t column : attended_columns) {
+            compacted_mask.push_back(row_mask[column]);
+        }
+        row_mask = std::move(compacted_mask);
+    }
+    return attended_columns.size();
+}
+
+void ContinuousBatchingPipeline::StatefulBatchingImpl::_compact_kv_cache() {
+    m_kv_cache_len = compact_kv_cache(m_request, m_kv_seq_len_axis, m_attention_mask, m_kv_cache_len);
+}
+
+void ContinuousBatchingPipeline::StatefulBatchingImpl::step() {
+    static ManualTimer step_timer("step()");
+    step_timer.start();
+
+    _take_incoming_requests();
+    std::vector<int32_t> beam_idxs = _free_non_running_requests();
+    if (m_rows.empty() && m_kv_cache_len > 0) {
+        // nothing left to attend to, admitted requests start from empty KV cache
+        m_request.reset_state();
+        m_kv_cache_len = 0;
+    }
+
+    // admitted requests reuse rows of KV cache dropped by finished ones, their contents are masked out
+    const size_t num_running_rows = m_rows.size();
+    size_t num_step_tokens = 1;
+    while (m_rows.size() < m_max_batch_size && !m_awaiting_requests.empty()) {
+        SequenceGroup::Ptr request = m_awaiting_requests.front();
+        m_awaiting_requests.pop_front();
+        m_rows.push_back(request);
+        m_attention_mask.emplace_back(m_kv_cache_len, 0);
+        m_num_attended_tokens.push_back(0);
+        beam_idxs.push_back(0);
+        num_step_tokens = std::max(num_step_tokens, request->get_prompt_len());
+    }
+    m_batch_size = m_rows.size();
+    if (m_rows.empty()) {
+        step_timer.end();
+        return;
+    }
+
+    // rows are left padded to the longest admitted prompt, so the last token of each row is the one to sample from
+    const size_t batch_size = m_rows.size();
+    ov::Tensor input_ids(ov::element::i64, {batch_size, num_step_tokens});
+    ov::Tensor attention_mask(ov::element::i64, {batch_size, m_kv_cache_len + num_step_tokens});
+    ov::Tensor position_ids(ov::element::i64, {batch_size, num_step_tokens});
+    std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), m_pad_token_id);
+
+    for (size_t row = 0; row < batch_size; ++row) {
+        const SequenceGroup::Ptr& request = m_rows[row];
+        const size_t num_tokens = row < num_running_rows ? 1 : request->get_prompt_len();
+        const size_t num_padding_tokens = num_step_tokens - num_tokens;
+        request->schedule_tokens(num_tokens);
+        request->set_output_seq_len(1);
+
+        int64_t* row_input_ids = input_ids.data<int64_t>() + row * num_step_tokens;
+        int64_t* row_position_ids = position_ids.data<int64_t>() + row * num_step_tokens;
+        const Sequence::Ptr& sequence = request->get_running_sequences().front();
+        const size_t num_processed_tokens = request->get_num_processed_tokens();
+        for (size_t token_id = 0; token_id < num_step_tokens; ++token_id) {
+            const bool is_padding = token_id < num_padding_tokens;
+            if (!is_padding) {
+                const size_t position_id = num_processed_tokens + token_id - num_padding_tokens;
+                row_input_ids[token_id] = position_id < request->get_prompt_len() ?
+                    request->get_prompt_ids()[position_id] :
+                    sequence->get_generated_ids()[position_id - request->get_prompt_len()];
+            }
+            row_position_ids[token_id] = m_num_attended_tokens[row] + (is_padding ? 0 : static_cast<int64_t>(token_id - num_padding_tokens));
+        }
+
+        std::vector<int64_t>& row_mask = m_attention_mask[row];
+        row_mask.insert(row_mask.end(), num_padding_tokens, 0);
+        row_mask.insert(row_mask.end(), num_tokens, 1);
+        std::copy(row_mask.begin(), row_mask.end(), attention_mask.data<int64_t>() + row * row_mask.size());
+        m_num_attended_tokens[row] += num_tokens;
+    }
+    m_kv_cache_len += num_step_tokens;
+
+    m_request.set_tensor("input_ids", input_ids);
+    m_request.set_tensor("attention_mask", attention_mask);
+    if (m_has_position_ids)
+        m_request.set_tensor("position_ids", position_ids);
+    m_request.set_tensor("beam_idx", ov::Tensor(ov::element::i32, {batch_size}, beam_idxs.data()));
+
+    {
+        static ManualTimer timer("forward");
+        timer.start();
+        m_request.infer();
+        timer.end();
+    }
+
+    {
+        static ManualTimer timer("sample");
+        timer.start();
+        m_sampler.sample(m_rows, m_request.get_tensor("logits"));
+        timer.end();
+    }
+
+    m_pipeline_metrics.requests = m_rows.size() + m_awaiting_requests.size();
+    m_pipeline_metrics.scheduled_requests = m_rows.size();
+    _compact_kv_cache();
+
+    step_timer.end();
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::StatefulBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
+                                                           const std::vector<GenerationConfig>& sampling_params,
+                                                           const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
+    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+
+    auto start_time = std::chrono::steady_clock::now();
+    PerfMetrics perf_metrics;
+    auto& raw_perf_counters = perf_metrics.raw_metrics;
+    raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
+
+    const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
+    OPENVINO_ASSERT(!streamer_ptr->has_callback() || input_ids.size() == 1,
+        "Currently streaming is possible only with batch size=1, use handles returned by add_request to stream several requests");
+
+    std::vector<GenerationHandle> generations;
+    std::vector<SequenceGroup::Ptr> all_requests;
+    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
+        generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+    }
+    {
+        std::lock_guard<std::mutex> lock{m_incoming_requests_mutex};
+        all_requests = m_incoming_requests;
+    }
+
+    streamer_ptr->start();
+    while (has_non_finished_requests()) {
+        try {
+            const auto infer_start = std::chrono::steady_clock::now();
+            step();
+            if (m_batch_size > 0) {
+                const auto infer_end = std::chrono::steady_clock::now();
+                const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+                raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+                raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
+                raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+                raw_perf_counters.m_batch_sizes.emplace_back(m_batch_size);
+            }
+        } catch (...) {
+            // the pipeline stays usable: requests are dropped, KV cache is started over
+            m_awaiting_requests.clear();
+            m_rows.clear();
+            m_attention_mask.clear();
+            m_num_attended_tokens.clear();
+            m_request.reset_state();
+            m_kv_cache_len = 0;
+            streamer_ptr->end();
+            std::rethrow_exception(std::current_exception());
+        }
+        stream_tokens(streamer_ptr, generations.at(0));
+    }
+    streamer_ptr->end();
+
+    std::vector<EncodedGenerationResult> results;
+    results.reserve(all_requests.size());
+    for (size_t request_id = 0; request_id < all_requests.size(); ++request_id) {
+        const auto& request = all_requests[request_id];
+        const auto& sequences = request->get_finished_sequences();
+
+        EncodedGenerationResult result;
+        result.m_request_id = request_id;
+        for (const auto& sequence : sequences) {
+            std::vector<int64_t> generation_ids;
+            if (request->get_sampling_parameters().echo)
+                generation_ids = request->get_prompt_ids();
+            const auto& generated_ids = sequence->get_generated_ids();
+            generation_ids.insert(generation_ids.end(), generated_ids.begin(), generated_ids.end());
+            result.m_generation_ids.push_back(std::move(generation_ids));
+            result.m_scores.push_back(sequence->get_cumulative_log_prob());
+        }
+        result.m_status = generations[request_id]->get_status();
+
+        perf_metrics.raw_metrics.generate_durations.clear();
+        perf_metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time));
+        perf_metrics.num_input_tokens = request->get_prompt_len();
+        perf_metrics.evaluate_statistics(start_time);
+
+        result.perf_metrics = perf_metrics;
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "icontinuous_batching.hpp"
+#include "sampler.hpp"
+
+namespace ov::genai {
+
+/**
+ * Removes columns of KV cache of a stateful model attended by none of the rows if they make at least a half of it.
+ * @param seq_len_axis Sequence length axis of the states.
+ * @param attention_mask Attention mask of each row of KV cache, it's compacted along with the states.
+ * @param kv_cache_len Number of columns of KV cache and of the mask of each row.
+ * @return Number of columns of KV cache after compaction.
+ */
+size_t compact_kv_cache(ov::InferRequest& request, size_t seq_len_axis, std::vector<std::vector<int64_t>>& attention_mask, size_t kv_cache_len);
+
+/**
+ * @brief Continuous batching on top of a stateful model, a lightweight alternative to paged attention for CPUs where it doesn't pay off.
+ * Each running request owns a row of the KV cache of the model. Between generation steps, rows of finished requests are dropped by
+ * `beam_idx` gathering the remaining ones, and awaiting requests are admitted into free rows: the step which admits them infers
+ * their prompts, while the running requests infer their next token left padded to the length of the longest admitted prompt.
+ * All rows share the length of KV cache, so a row attends only to its own tokens by the attention mask. Columns of KV cache
+ * attended by no row are removed once they make a half of it.
+ * Only greedy and multinomial decoding with a single sequence per request are supported.
+ */
+class ContinuousBatchingPipeline::StatefulBatchingImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
+protected:
+    ov::InferRequest m_request;
+    Sampler m_sampler;
+    size_t m_max_batch_size;
+    size_t m_kv_seq_len_axis = 2;
+    bool m_has_position_ids = false;
+    int64_t m_pad_token_id = 0;
+
+    // requests added by `add_request`, possibly from other threads
+    std::vector<SequenceGroup::Ptr> m_incoming_requests;
+    std::mutex m_incoming_requests_mutex;
+    // requests waiting for a free row
+    std::deque<SequenceGroup::Ptr> m_awaiting_requests;
+
+    // request of each row of KV cache
+    std::vector<SequenceGroup::Ptr> m_rows;
+    // attention mask of each row, all rows have length of KV cache
+    std::vector<std::vector<int64_t>> m_attention_mask;
+    // number of tokens attended by each row, i.e. position id of its next token
+    std::vector<int64_t> m_num_attended_tokens;
+    size_t m_kv_cache_len = 0;
+    // batch size of the last step
+    size_t m_batch_size = 0;
+
+    void _take_incoming_requests();
+
+    // drops rows of requests which aren't running, returns indices of the remaining rows in KV cache
+    std::vector<int32_t> _free_non_running_requests();
+
+    // removes columns of KV cache attended by none of the rows
+    void _compact_kv_cache();
+
+public:
+    /**
+     * @param max_batch_size Max number of requests generated at once, i.e. rows of KV cache.
+     */
+    StatefulBatchingImpl(const std::shared_ptr<ov::Model>& model,
+                         const Tokenizer& tokenizer,
+                         const std::string& device,
+                         const ov::AnyMap& properties,
+                         const ov::genai::GenerationConfig& generation_config,
+                         size_t max_batch_size);
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const ov::Tensor& input_ids,
+                                 ov::genai::GenerationConfig sampling_params) override;
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const std::string& prompt,
+                                 ov::genai::GenerationConfig sampling_params) override;
+
+    bool has_non_finished_requests() override;
+
+    void step() override;
+
+    std::vector<EncodedGenerationResult>
+    generate(const std::vector<ov::Tensor>& input_ids,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) override;
+};
+
+}
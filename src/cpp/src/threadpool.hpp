@@ -1,3 +1,8 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -3,6 +3,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <jinja2cpp/template.h>
 #include <jinja2cpp/template_env.h>
@@ -264,6 +265,17 @@ public:
         // Saving IR version was added only in 24.5, so if it's missing, then it's older than 24.5
         m_older_than_24_5 = !(ov_tokenizer ? ov_tokenizer: ov_detokenizer)->has_rt_info("openvino_tokenizers_version");
 
+        // Detokenizer is compiled in parallel with tokenizer, since neither of them depends on another
+        std::future<ov::CompiledModel> detokenizer_compilation;
+        if (ov_detokenizer) {
+            ov::pass::Manager manager_detok;
+            manager_detok.register_pass<MakeVocabDecoderSatateful>();
+            manager_detok.run_passes(ov_detokenizer);
+            detokenizer_compilation = std::async(std::launch::async, [&core, &device, &properties, model = ov_detokenizer]() {
+                return core.compile_model(model, device, properties);
+            });
+        }
+
         if (ov_tokenizer) {
             ov::pass::Manager manager;
             manager.register_pass<MakeAddSpecialTokensSatateful>();
@@ -295,10 +307,7 @@ public:
         }
 
         if (ov_detokenizer) {
-            ov::pass::Manager manager_detok;
-            manager_detok.register_pass<MakeVocabDecoderSatateful>();
-            manager_detok.run_passes(ov_detokenizer);
-            ov::CompiledModel detokenizer = core.compile_model(ov_detokenizer, device, properties);
+            ov::CompiledModel detokenizer = detokenizer_compilation.get();
             ov::genai::utils::print_compiled_model_properties(detokenizer, "OV Detokenizer");
 
             m_ireq_queue_detokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
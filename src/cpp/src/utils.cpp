@@ -5,8 +5,16 @@
 
 #include <variant>
 #include <fstream>
+#include <filesystem>
+#include <iomanip>
 #include <memory>
+#include <sstream>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "openvino/core/version.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/gather.hpp"
@@ -15,6 +23,8 @@
 #include "openvino/op/slice.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/pass/hash.hpp"
+#include "openvino/pass/manager.hpp"
 #include "openvino/genai/text_streamer.hpp"
 
 
@@ -43,27 +53,6 @@ std::optional<T> get_option(const ov::AnyMap& config, const std::string& option_
     return std::nullopt;
 }
 
-std::optional<uint32_t> pop_int_and_cast(ov::AnyMap& config, const std::string& key) {
-    auto anyopt = ov::genai::utils::pop_option(config, key);
-    if (anyopt.has_value()) {
-        const auto any = anyopt.value();
-        int64_t value;
-        // NB: Integer value coming from python has int64_t datatype
-        if (any.is<int64_t>()) {
-            value = any.as<int64_t>();
-        } else if (any.is<int>()) {
-            value = any.as<int>();
-        } else {
-            OPENVINO_THROW("Failed to extract " + key + ". Type mismatch: expected types: int or int64_t");
-        }
-        if (value < 0) {
-            OPENVINO_THROW(key + " cannot be negative!");
-        }
-        return std::make_optional(static_cast<uint32_t>(value));
-    }
-    return std::nullopt;
-}
-
 void update_npu_config(ov::AnyMap& config,
                        const std::shared_ptr<ov::Model>& model,
                        const ov::genai::utils::KVAxesPosition& kv_pos,
@@ -84,6 +73,19 @@ void update_npu_config(ov::AnyMap& config,
     rename_key(config, "GENERATE_HINT", "NPUW_LLM_GENERATE_HINT");
 }
 
+// FNV-1a hash, which is stable between runs and platforms unlike std::hash
+uint64_t hash_combine(uint64_t seed, const std::string& value) {
+    constexpr uint64_t fnv_prime = 0x100000001b3ULL;
+    for (unsigned char c : value) {
+        seed ^= c;
+        seed *= fnv_prime;
+    }
+    // separator of values
+    seed ^= 0xff;
+    seed *= fnv_prime;
+    return seed;
+}
+
 } // anonymous
 
 namespace ov {
@@ -336,6 +338,35 @@ ov::Core singleton_core() {
     return core;
 }
 
+std::optional<std::string> get_compiled_model_cache_key(const std::shared_ptr<ov::Model>& model,
+                                                        const std::string& device,
+                                                        const ov::AnyMap& properties) {
+    uint64_t model_hash = 0;
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::Hash>(model_hash);
+    manager.run_passes(model);
+
+    uint64_t key = 0xcbf29ce484222325ULL;
+    key = hash_combine(key, std::to_string(model_hash));
+    key = hash_combine(key, device);
+    // NB: ov::AnyMap is ordered, so the same properties give the same key
+    for (const auto& [name, value] : properties) {
+        if (name == ov::cache_dir.name()) {
+            continue;
+        }
+        try {
+            key = hash_combine(key, name + "=" + value.as<std::string>());
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+    }
+    key = hash_combine(key, ov::get_openvino_version().buildNumber);
+
+    std::stringstream key_str;
+    key_str << std::hex << std::setw(16) << std::setfill('0') << key;
+    return key_str.str();
+}
+
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history) {
     size_t idx = 0;
     auto encoded_history_data = encoded_history.data<int64_t>();
@@ -526,6 +557,27 @@ std::optional<ov::Any> pop_option(ov::AnyMap& config, const std::string& option_
     return std::nullopt;
 }
 
+std::optional<uint32_t> pop_int_and_cast(ov::AnyMap& config, const std::string& key) {
+    auto anyopt = ov::genai::utils::pop_option(config, key);
+    if (anyopt.has_value()) {
+        const auto any = anyopt.value();
+        int64_t value;
+        // NB: Integer value coming from python has int64_t datatype
+        if (any.is<int64_t>()) {
+            value = any.as<int64_t>();
+        } else if (any.is<int>()) {
+            value = any.as<int>();
+        } else {
+            OPENVINO_THROW("Failed to extract " + key + ". Type mismatch: expected types: int or int64_t");
+        }
+        if (value < 0) {
+            OPENVINO_THROW(key + " cannot be negative!");
+        }
+        return std::make_optional(static_cast<uint32_t>(value));
+    }
+    return std::nullopt;
+}
+
 const ModelsMap::mapped_type& get_model_weights_pair(const ModelsMap& models_map, const std::string& key) {
     auto it = models_map.find(key);
     if (it != models_map.end()) {
@@ -547,6 +599,58 @@ std::pair<ov::AnyMap, SchedulerConfig> extract_scheduler_config(const ov::AnyMap
     return {plugin_config, scheduler_config};
 };
 
+std::vector<std::vector<size_t>> get_numa_nodes_cpus() {
+    std::vector<std::vector<size_t>> nodes_cpus;
+#ifdef __linux__
+    // CPU lists have "0-15,32-47" format
+    auto parse_cpu_list = [](const std::string& cpu_list) {
+        std::vector<size_t> cpus;
+        std::stringstream cpu_list_stream(cpu_list);
+        std::string range;
+        while (std::getline(cpu_list_stream, range, ',')) {
+            if (range.empty())
+                continue;
+            size_t dash_pos = range.find('-');
+            size_t first = std::stoul(range.substr(0, dash_pos));
+            size_t last = dash_pos == std::string::npos ? first : std::stoul(range.substr(dash_pos + 1));
+            for (size_t cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        }
+        return cpus;
+    };
+
+    const std::filesystem::path nodes_path = "/sys/devices/system/node";
+    for (size_t node_id = 0; ; ++node_id) {
+        std::ifstream cpu_list_file(nodes_path / ("node" + std::to_string(node_id)) / "cpulist");
+        if (!cpu_list_file.is_open())
+            break;
+        std::string cpu_list;
+        std::getline(cpu_list_file, cpu_list);
+        std::vector<size_t> cpus = parse_cpu_list(cpu_list);
+        // memory-only nodes have no CPUs
+        if (!cpus.empty())
+            nodes_cpus.push_back(std::move(cpus));
+    }
+#endif
+    if (nodes_cpus.empty())
+        nodes_cpus.emplace_back();
+    return nodes_cpus;
+}
+
+bool set_current_thread_affinity(const std::vector<size_t>& cpus) {
+#ifdef __linux__
+    if (cpus.empty())
+        return false;
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu : cpus)
+        CPU_SET(cpu, &cpu_set);
+    return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -72,6 +72,8 @@ const std::string STREAMER_ARG_NAME = "streamer";
 const std::string CONFIG_ARG_NAME = "generation_config";
 const std::string DRAFT_MODEL_ARG_NAME = "draft_model";
 
+const std::string KV_BLOCK_POOL_ARG_NAME = "kv_block_pool";
+
 template<typename Config = ov::genai::GenerationConfig>
 Config from_config_json_if_exists(const std::filesystem::path& models_path, const char config_name[] = "generation_config.json") {
     auto config_file_path = models_path / config_name;
@@ -95,6 +97,15 @@ void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model)
 
 ov::Core singleton_core();
 
+/**
+ * @brief Returns a key identifying the compiled model: hash of the model, device, compilation properties except
+ * `ov::cache_dir` and OpenVINO version. Models are hashed as they are compiled, i.e. after transformations of pipelines.
+ * Returns std::nullopt if some property can't be converted to a string.
+ */
+std::optional<std::string> get_compiled_model_cache_key(const std::shared_ptr<ov::Model>& model,
+                                                        const std::string& device,
+                                                        const ov::AnyMap& properties);
+
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history);
 
 struct KVAxesPosition {
@@ -200,10 +211,24 @@ T pop_or_default(ov::AnyMap& config, const std::string& key, const T& default_va
     return default_value;
 }
 
+// pops a non-negative integer option, which may come as int or int64_t (from python)
+std::optional<uint32_t> pop_int_and_cast(ov::AnyMap& config, const std::string& key);
+
 const ModelsMap::mapped_type& get_model_weights_pair(const ModelsMap& models_map, const std::string& key);
 
 std::pair<ov::AnyMap, SchedulerConfig> extract_scheduler_config(const ov::AnyMap& properties, std::optional<SchedulerConfig> default_config = std::nullopt);
 
+/**
+ * @return CPUs of each NUMA node of the system. If NUMA topology is not available, a single node with empty list of CPUs is returned.
+ */
+std::vector<std::vector<size_t>> get_numa_nodes_cpus();
+
+/**
+ * Binds the calling thread to the given CPUs.
+ * @return Whether the affinity was applied.
+ */
+bool set_current_thread_affinity(const std::vector<size_t>& cpus);
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -16,6 +16,7 @@
 #include "visual_language/continuous_batching_adapter.hpp"
 
 #include "sampler.hpp"
+#include "parallel_model_loader.hpp"
 #include "utils.hpp"
 #include "lm_encoding.hpp"
 
@@ -55,20 +56,26 @@ public:
                 models_dir, "generation_config.json"
             )
         } {
-        m_inputs_embedder = std::make_shared<InputsEmbedder>(models_dir, device, properties);
+        // vision encoder, text embeddings model and tokenizer are loaded by inputs embedder in parallel with language model
+        utils::ParallelModelLoader loader;
+        loader.add("inputs_embedder", [&]() {
+            m_inputs_embedder = std::make_shared<InputsEmbedder>(models_dir, device, properties);
+        });
+        loader.add("language_model", [&]() {
+            auto compiled_language_model = utils::singleton_core().compile_model(
+                models_dir / "openvino_language_model.xml", device, properties
+            );
+            utils::print_compiled_model_properties(compiled_language_model, "VLM language model");
+            auto language_model = compiled_language_model.get_runtime_model();
+            m_kv_cache_seq_length_axis = utils::get_kv_axes_pos(language_model).seq_len;
+
+            m_language = compiled_language_model.create_infer_request();
+        });
+        set_load_timeline(loader.wait());
 
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
-        auto compiled_language_model = utils::singleton_core().compile_model(
-            models_dir / "openvino_language_model.xml", device, properties
-        );
-        utils::print_compiled_model_properties(compiled_language_model, "VLM language model");
-        auto language_model = compiled_language_model.get_runtime_model();
-        m_kv_cache_seq_length_axis = utils::get_kv_axes_pos(language_model).seq_len;
-
-        m_language = compiled_language_model.create_infer_request();
-
         m_language.get_tensor("attention_mask").set_shape({1, 0});
 
         // If eos_token_id was not provided, take value
@@ -90,16 +97,21 @@ public:
         const GenerationConfig& generation_config
     ) :
         m_generation_config{generation_config} {
-        m_inputs_embedder = std::make_shared<InputsEmbedder>(models_map, tokenizer, config_dir_path, device, properties);
+        utils::ParallelModelLoader loader;
+        loader.add("inputs_embedder", [&]() {
+            m_inputs_embedder = std::make_shared<InputsEmbedder>(models_map, tokenizer, config_dir_path, device, properties);
+        });
+        loader.add("language_model", [&]() {
+            auto m_language_pair = utils::get_model_weights_pair(models_map, "language");
+            m_language = utils::singleton_core().compile_model(
+                m_language_pair.first, m_language_pair.second, device, properties
+            ).create_infer_request();
+        });
+        set_load_timeline(loader.wait());
 
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
-        auto m_language_pair = utils::get_model_weights_pair(models_map, "language");
-        m_language = utils::singleton_core().compile_model(
-            m_language_pair.first, m_language_pair.second, device, properties
-        ).create_infer_request();
-
         m_language.get_tensor("attention_mask").set_shape({1, 0});
 
         // If eos_token_id was not provided, take value
@@ -205,6 +217,7 @@ public:
         auto& res_raw_counters = decoded.perf_metrics.raw_metrics;
         decoded.perf_metrics.num_input_tokens = prompt_ids.get_size();
         decoded.perf_metrics.load_time = this->get_load_time();
+        decoded.perf_metrics.load_timeline = this->get_load_timeline();
         res_raw_counters.generate_durations.emplace_back(PerfMetrics::get_microsec(generate_end_time - generate_start_time));
         res_raw_counters.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_end_time - decode_start_time));
         res_raw_counters.tokenization_durations.insert(res_raw_counters.tokenization_durations.end(), raw_counters.tokenization_durations.begin(), raw_counters.tokenization_durations.end());
@@ -16,6 +16,8 @@ namespace ov::genai {
 class ov::genai::VLMPipeline::VLMPipelineBase {
     // Load pipeline time
     float m_load_time_ms = 0;
+    // Intervals of loading sub-models in parallel
+    std::vector<ModelLoadInterval> m_load_timeline;
 public:
 
     virtual ~VLMPipelineBase() = default;
@@ -83,5 +85,13 @@ public:
     float get_load_time() {
         return m_load_time_ms;
     }
+
+    void set_load_timeline(const std::vector<ModelLoadInterval>& load_timeline) {
+        m_load_timeline = load_timeline;
+    }
+
+    const std::vector<ModelLoadInterval>& get_load_timeline() const {
+        return m_load_timeline;
+    }
 };
 }
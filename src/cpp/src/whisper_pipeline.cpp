@@ -9,6 +9,7 @@
 #include <variant>
 
 #include "openvino/genai/text_streamer.hpp"
+#include "parallel_model_loader.hpp"
 #include "utils.hpp"
 #include "whisper/context_tokens.hpp"
 #include "whisper/models/decoder.hpp"
@@ -54,14 +55,17 @@ public:
                                 const ov::AnyMap& properties)
         : WhisperPipelineImplBase{models_path},
           m_sampler(m_tokenizer) {
-        ov::Core core = utils::singleton_core();
-
-        ov::CompiledModel compiled_model =
-            core.compile_model(models_path / "openvino_encoder_model.xml", device, properties);
-        ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
-        m_encoder = init_model(compiled_model);
-
-        m_decoder = WhisperDecoder::from_path(models_path, device, properties);
+        utils::ParallelModelLoader loader;
+        loader.add("encoder", [&]() {
+            ov::CompiledModel compiled_model =
+                utils::singleton_core().compile_model(models_path / "openvino_encoder_model.xml", device, properties);
+            ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
+            m_encoder = init_model(compiled_model);
+        });
+        loader.add("decoder", [&]() {
+            m_decoder = WhisperDecoder::from_path(models_path, device, properties);
+        });
+        m_load_timeline = loader.wait();
 
         // If eos_token_id was not provided, take value
         if (m_generation_config.eos_token_id == -1) {
@@ -123,6 +127,7 @@ public:
 
         auto& metrics = result.perf_metrics;
         metrics.load_time = this->m_load_time_ms;
+        metrics.load_timeline = this->m_load_timeline;
         auto stop_time = std::chrono::steady_clock::now();
         metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
         result.perf_metrics.raw_metrics.tokenization_durations.emplace_back(MicroSeconds(0.0f));
@@ -19,6 +19,7 @@ public:
     WhisperConfig m_model_config;
 
     float m_load_time_ms = 0;
+    std::vector<ModelLoadInterval> m_load_timeline;
 
     WhisperPipelineImplBase(const std::filesystem::path& models_path)
         : m_generation_config(utils::from_config_json_if_exists<WhisperGenerationConfig>(models_path)),
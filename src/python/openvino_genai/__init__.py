@@ -89,5 +89,7 @@ from .py_openvino_genai import (
     GenerationStatus,
     SchedulerConfig,
     CacheEvictionConfig,
-    AggregationMode
+    AggregationMode,
+    KVBlockPool,
+    kv_block_pool
 )
@@ -5,7 +5,7 @@ from __future__ import annotations
 import openvino._pyopenvino
 import os
 import typing
-__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
+__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'KVBlockPool', 'LLMPipeline', 'MeanStdPair', 'ModelLoadInterval', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version', 'kv_block_pool']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -609,6 +609,7 @@ class GenerationConfig:
     max_ngram_size: int
     min_new_tokens: int
     no_repeat_ngram_size: int
+    num_assistant_branches: int
     num_assistant_tokens: int
     num_beam_groups: int
     num_beams: int
@@ -940,6 +941,9 @@ class ImageGenerationPerfMetrics:
         :param get_load_time: Returns the load time in milliseconds.
         :type get_load_time: float
     
+        :param get_load_timeline: Returns intervals of loading models of the pipeline.
+        :type get_load_timeline: list[ModelLoadInterval]
+    
         :param get_generate_duration: Returns the generate duration in milliseconds.
         :type get_generate_duration: float
     
@@ -983,6 +987,8 @@ class ImageGenerationPerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_load_timeline(self) -> list[ModelLoadInterval]:
+        ...
     def get_text_encoder_infer_duration(self) -> dict[str, float]:
         ...
     def get_transformer_infer_duration(self) -> MeanStdPair:
@@ -1085,6 +1091,23 @@ class InpaintingPipeline:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+class KVBlockPool:
+    """
+    
+        Budget of KV cache blocks shared by several ContinuousBatchingPipeline instances with the same KV cache layout.
+        Pipelines take part in the pool via `kv_block_pool` property. Each pipeline can always take blocks up to its quota
+        and borrow blocks not used by other pipelines above it. Borrowers return the blocks on their next step when another
+        pipeline is not able to take blocks within its quota.
+    
+        :param num_kv_blocks: Total number of KV cache blocks which can be used by all pipelines sharing the pool.
+        :type num_kv_blocks: int
+    """
+    def __init__(self, num_kv_blocks: int) -> None:
+        ...
+    def get_num_free_blocks(self) -> int:
+        ...
+    def get_num_kv_blocks(self) -> int:
+        ...
 class LLMPipeline:
     """
     This class is used for generation with LLMs
@@ -1255,6 +1278,14 @@ class LLMPipeline:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def restore_chat_session(self, session_id: str) -> bool:
+        """
+        Finishes the current chat and continues the chat saved by save_chat_session without recomputation of its history. Returns False if there is no such session, the current chat is kept in this case.
+        """
+    def save_chat_session(self, session_id: str) -> None:
+        """
+        Saves the current chat, including KV cache of its history, to continue it later by restore_chat_session. The chat remains active. Supported by the stateful pipeline only.
+        """
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
@@ -1270,6 +1301,32 @@ class MeanStdPair:
     @property
     def std(self) -> float:
         ...
+class ModelLoadInterval:
+    """
+    
+        Loading of a sub-model of a pipeline, i.e. reading and compilation of the model, during construction of the pipeline.
+        Independent sub-models are loaded in parallel, so their intervals overlap.
+    
+        :param model_name: Name of the sub-model.
+        :type model_name: str
+    
+        :param start: Time from the start of the pipeline construction to the start of loading in milliseconds.
+        :type start: float
+    
+        :param duration: Duration of loading in milliseconds.
+        :type duration: float
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def duration(self) -> float:
+        ...
+    @property
+    def model_name(self) -> str:
+        ...
+    @property
+    def start(self) -> float:
+        ...
 class PerfMetrics:
     """
     
@@ -1294,12 +1351,21 @@ class PerfMetrics:
         :param get_load_time: Returns the load time in milliseconds.
         :type get_load_time: float
     
+        :param get_load_timeline: Returns intervals of loading sub-models of the pipeline.
+        :type get_load_timeline: list[ModelLoadInterval]
+    
         :param get_num_generated_tokens: Returns the number of generated tokens.
         :type get_num_generated_tokens: int
     
         :param get_num_input_tokens: Returns the number of tokens in the input prompt.
         :type get_num_input_tokens: int
     
+        :param get_num_reused_history_tokens: Returns the number of chat history tokens taken from KV cache.
+        :type get_num_reused_history_tokens: int
+    
+        :param get_num_recomputed_history_tokens: Returns the number of chat history tokens removed from KV cache to be recomputed.
+        :type get_num_recomputed_history_tokens: int
+    
         :param get_ttft: Returns the mean and standard deviation of TTFT in milliseconds.
         :type get_ttft: MeanStdPair
     
@@ -1337,10 +1403,16 @@ class PerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_load_timeline(self) -> list[ModelLoadInterval]:
+        ...
     def get_num_generated_tokens(self) -> int:
         ...
     def get_num_input_tokens(self) -> int:
         ...
+    def get_num_recomputed_history_tokens(self) -> int:
+        ...
+    def get_num_reused_history_tokens(self) -> int:
+        ...
     def get_throughput(self) -> MeanStdPair:
         ...
     def get_tokenization_duration(self) -> MeanStdPair:
@@ -1373,6 +1445,9 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param num_preemptions: Number of preemptions (requests whose KV cache was released to be recomputed later) during the lifetime of the pipeline
+        :type num_preemptions: int
     """
     def __init__(self) -> None:
         ...
@@ -1386,6 +1461,9 @@ class PipelineMetrics:
     def max_cache_usage(self) -> float:
         ...
     @property
+    def num_preemptions(self) -> int:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
@@ -1609,15 +1687,23 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turend off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished genegartion its cache is released.
+        use_output_length_prediction: Whether to take predicted output lengths of running requests into account when admitting new prompts.
+            Predictions are based on `max_new_tokens` and output length statistics of previously finished requests with the same prompt prefix.
+        enable_chunked_prefill:     Whether to split prompts which do not fit into max_num_batched_tokens into chunks processed by several steps.
+        prompt_only_batches:        Whether batches with prompt chunks must not contain generation tokens.
+            When turned off, each batch is filled with generation tokens first and prompt chunks take the rest of max_num_batched_tokens.
     """
     cache_eviction_config: CacheEvictionConfig
     cache_size: int
     dynamic_split_fuse: bool
+    enable_chunked_prefill: bool
     enable_prefix_caching: bool
     max_num_batched_tokens: int
     max_num_seqs: int
     num_kv_blocks: int
+    prompt_only_batches: bool
     use_cache_eviction: bool
+    use_output_length_prediction: bool
     def __init__(self) -> None:
         ...
 class StopCriteria:
@@ -2541,3 +2627,7 @@ def get_version() -> str:
     """
     OpenVINO GenAI version
     """
+def kv_block_pool(pool: KVBlockPool, quota: int = 0) -> openvino._pyopenvino.OVAny:
+    """
+    Makes ContinuousBatchingPipeline take KV cache blocks from the pool shared with other pipelines, `quota` blocks are guaranteed to the pipeline
+    """
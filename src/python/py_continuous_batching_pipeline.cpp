@@ -25,6 +25,7 @@ using ov::genai::GenerationHandleImpl;
 using ov::genai::GenerationOutput;
 using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
+using ov::genai::KVBlockPool;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
 
@@ -69,6 +70,11 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turend off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished genegartion its cache is released.
+    use_output_length_prediction: Whether to take predicted output lengths of running requests into account when admitting new prompts.
+        Predictions are based on `max_new_tokens` and output length statistics of previously finished requests with the same prompt prefix.
+    enable_chunked_prefill:     Whether to split prompts which do not fit into max_num_batched_tokens into chunks processed by several steps.
+    prompt_only_batches:        Whether batches with prompt chunks must not contain generation tokens.
+        When turned off, each batch is filled with generation tokens first and prompt chunks take the rest of max_num_batched_tokens.
 )";
 
 auto generation_result_docstring = R"(
@@ -110,6 +116,19 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param num_preemptions: Number of preemptions (requests whose KV cache was released to be recomputed later) during the lifetime of the pipeline
+    :type num_preemptions: int
+)";
+
+auto kv_block_pool_docstring = R"(
+    Budget of KV cache blocks shared by several ContinuousBatchingPipeline instances with the same KV cache layout.
+    Pipelines take part in the pool via `kv_block_pool` property. Each pipeline can always take blocks up to its quota
+    and borrow blocks not used by other pipelines above it. Borrowers return the blocks on their next step when another
+    pipeline is not able to take blocks within its quota.
+
+    :param num_kv_blocks: Total number of KV cache blocks which can be used by all pipelines sharing the pool.
+    :type num_kv_blocks: int
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -244,6 +263,9 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("use_output_length_prediction", &SchedulerConfig::use_output_length_prediction)
+        .def_readwrite("enable_chunked_prefill", &SchedulerConfig::enable_chunked_prefill)
+        .def_readwrite("prompt_only_batches", &SchedulerConfig::prompt_only_batches)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config);
 
@@ -253,7 +275,20 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("num_preemptions", &PipelineMetrics::num_preemptions);
+
+    py::class_<KVBlockPool, std::shared_ptr<KVBlockPool>>(m, "KVBlockPool", kv_block_pool_docstring)
+        .def(py::init<size_t>(), py::arg("num_kv_blocks"))
+        .def("get_num_kv_blocks", &KVBlockPool::get_num_kv_blocks)
+        .def("get_num_free_blocks", &KVBlockPool::get_num_free_blocks);
+
+    m.def("kv_block_pool", [](const std::shared_ptr<KVBlockPool>& pool, size_t quota) {
+            return ov::genai::kv_block_pool(pool, quota).second;
+        },
+        py::arg("pool"),
+        py::arg("quota") = 0,
+        "Makes ContinuousBatchingPipeline take KV cache blocks from the pool shared with other pipelines, `quota` blocks are guaranteed to the pipeline");
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config, const std::map<std::string, py::object>& tokenizer_plugin_config) {
@@ -101,6 +101,9 @@ auto image_generation_perf_metrics_docstring = R"(
     :param get_load_time: Returns the load time in milliseconds.
     :type get_load_time: float
 
+    :param get_load_timeline: Returns intervals of loading models of the pipeline.
+    :type get_load_timeline: list[ModelLoadInterval]
+
     :param get_generate_duration: Returns the generate duration in milliseconds.
     :type get_generate_duration: float
 
@@ -333,6 +336,7 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_vae_encoder_infer_duration", &ImageGenerationPerfMetrics::get_vae_encoder_infer_duration)
         .def("get_vae_decoder_infer_duration", &ImageGenerationPerfMetrics::get_vae_decoder_infer_duration)
         .def("get_load_time", &ImageGenerationPerfMetrics::get_load_time)
+        .def("get_load_timeline", &ImageGenerationPerfMetrics::get_load_timeline)
         .def("get_generate_duration", &ImageGenerationPerfMetrics::get_generate_duration)
         .def("get_first_and_other_iter_duration",
              [](ImageGenerationPerfMetrics& self) -> py::tuple {
@@ -232,6 +232,12 @@ void init_llm_pipeline(py::module_& m) {
         .def("get_tokenizer", &LLMPipeline::get_tokenizer)
         .def("start_chat", &LLMPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &LLMPipeline::finish_chat)
+        .def("save_chat_session", &LLMPipeline::save_chat_session, py::arg("session_id"),
+            "Saves the current chat, including KV cache of its history, to continue it later by restore_chat_session. "
+            "The chat remains active. Supported by the stateful pipeline only.")
+        .def("restore_chat_session", &LLMPipeline::restore_chat_session, py::arg("session_id"),
+            "Finishes the current chat and continues the chat saved by save_chat_session without recomputation of its history. "
+            "Returns False if there is no such session, the current chat is kept in this case.")
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
 
@@ -13,6 +13,7 @@
 namespace py = pybind11;
 
 using ov::genai::MeanStdPair;
+using ov::genai::ModelLoadInterval;
 using ov::genai::PerfMetrics;
 using ov::genai::RawPerfMetrics;
 
@@ -73,12 +74,21 @@ auto perf_metrics_docstring = R"(
     :param get_load_time: Returns the load time in milliseconds.
     :type get_load_time: float
 
+    :param get_load_timeline: Returns intervals of loading sub-models of the pipeline.
+    :type get_load_timeline: list[ModelLoadInterval]
+
     :param get_num_generated_tokens: Returns the number of generated tokens.
     :type get_num_generated_tokens: int
 
     :param get_num_input_tokens: Returns the number of tokens in the input prompt.
     :type get_num_input_tokens: int
 
+    :param get_num_reused_history_tokens: Returns the number of chat history tokens taken from KV cache.
+    :type get_num_reused_history_tokens: int
+
+    :param get_num_recomputed_history_tokens: Returns the number of chat history tokens removed from KV cache to be recomputed.
+    :type get_num_recomputed_history_tokens: int
+
     :param get_ttft: Returns the mean and standard deviation of TTFT in milliseconds.
     :type get_ttft: MeanStdPair
 
@@ -101,6 +111,20 @@ auto perf_metrics_docstring = R"(
     :type raw_metrics: RawPerfMetrics
 )";
 
+auto model_load_interval_docstring = R"(
+    Loading of a sub-model of a pipeline, i.e. reading and compilation of the model, during construction of the pipeline.
+    Independent sub-models are loaded in parallel, so their intervals overlap.
+
+    :param model_name: Name of the sub-model.
+    :type model_name: str
+
+    :param start: Time from the start of the pipeline construction to the start of loading in milliseconds.
+    :type start: float
+
+    :param duration: Duration of loading in milliseconds.
+    :type duration: float
+)";
+
 template <typename T, typename U>
 std::vector<double> timestamp_to_ms(const T& instance, U T::*member) {
     // Converts c++ duration to double so that it can be used in Python.
@@ -156,11 +180,20 @@ void init_perf_metrics(py::module_& m) {
             return py::make_iterator(&self.mean, &self.std + 1);
         }, py::keep_alive<0, 1>());  // Keep object alive while the iterator is used;
 
+    py::class_<ModelLoadInterval>(m, "ModelLoadInterval", model_load_interval_docstring)
+        .def(py::init<>())
+        .def_readonly("model_name", &ModelLoadInterval::model_name)
+        .def_readonly("start", &ModelLoadInterval::start)
+        .def_readonly("duration", &ModelLoadInterval::duration);
+
     py::class_<PerfMetrics>(m, "PerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_load_time", &PerfMetrics::get_load_time)
+        .def("get_load_timeline", &PerfMetrics::get_load_timeline)
         .def("get_num_generated_tokens", &PerfMetrics::get_num_generated_tokens)
         .def("get_num_input_tokens", &PerfMetrics::get_num_input_tokens)
+        .def("get_num_reused_history_tokens", &PerfMetrics::get_num_reused_history_tokens)
+        .def("get_num_recomputed_history_tokens", &PerfMetrics::get_num_recomputed_history_tokens)
         .def("get_ttft", &PerfMetrics::get_ttft)
         .def("get_tpot", &PerfMetrics::get_tpot)
         .def("get_ipot", &PerfMetrics::get_ipot)
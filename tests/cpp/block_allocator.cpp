@@ -268,3 +268,42 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectlyWithPrefixCaching) {
         allocator.free(prefix_hash_map[allocated_block.first]);
     }
 }
+
+TEST(TestPrefixHashRegistry, FollowerKeepsBlocksCachedByLeader) {
+    auto prefix_hash_registry = std::make_shared<ov::genai::PrefixHashRegistry>();
+    ov::genai::BlockAllocator leader(2, true), follower(2, true);
+    leader.set_prefix_hash_registry(prefix_hash_registry, true);
+    follower.set_prefix_hash_registry(prefix_hash_registry, false);
+    std::map<uint64_t, ov::genai::BlocksPerLayer> leader_cached_blocks, follower_cached_blocks;
+
+    auto leader_block_1 = leader.allocate_block(1, leader_cached_blocks);
+    auto leader_block_2 = leader.allocate_block(2, leader_cached_blocks);
+    EXPECT_TRUE(prefix_hash_registry->contains(1));
+    EXPECT_TRUE(prefix_hash_registry->contains(2));
+
+    auto follower_block_1 = follower.allocate_block(1, follower_cached_blocks);
+    auto follower_block_3 = follower.allocate_block(3, follower_cached_blocks);
+    // follower doesn't report its hashes
+    EXPECT_FALSE(prefix_hash_registry->contains(3));
+    // the block cached by the leader is the least recently used one, but the other one is overwritten
+    follower_block_1[0]->set_timestamp(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    follower.free(follower_block_1);
+    follower.free(follower_block_3);
+    auto follower_block_4 = follower.allocate_block(4, follower_cached_blocks);
+    EXPECT_EQ(follower_block_4[0]->get_index(), follower_block_3[0]->get_index());
+    auto restored_follower_block_1 = follower.get_cached_block(1, follower_cached_blocks);
+    ASSERT_FALSE(restored_follower_block_1.empty());
+
+    // the leader reports overwritten blocks
+    leader_block_1[0]->set_timestamp(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    leader.free(leader_block_1);
+    leader.free(leader_block_2);
+    auto leader_block_5 = leader.allocate_block(5, leader_cached_blocks);
+    EXPECT_EQ(leader_block_5[0]->get_index(), leader_block_1[0]->get_index());
+    EXPECT_FALSE(prefix_hash_registry->contains(1));
+    EXPECT_TRUE(prefix_hash_registry->contains(5));
+
+    leader.free(leader_block_5);
+    follower.free(follower_block_4);
+    follower.free(restored_follower_block_1);
+}
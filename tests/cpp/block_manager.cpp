@@ -89,6 +89,42 @@ TEST(TestBlockManager, required_blocks_count) {
     }
 }
 
+TEST(TestBlockManager, copy_on_write_when_several_tokens_are_appended) {
+    ov::genai::BlockManager bm = ov::genai::BlockManager(16, false, 4);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4};
+    ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+        0,
+        ov::Tensor(ov::element::i64, {
+        tokens.size()}, tokens.data()),
+        ov::genai::greedy(),
+        4);
+    sequence_group->schedule_tokens(5);
+    bm.append_slots(sequence_group);
+    sequence_group->finish_iteration();
+
+    // a branch of tree speculation is forked from a sequence with incomplete last block
+    auto sequence_to_fork = sequence_group->get_running_sequences()[0];
+    const auto forked_sequence = sequence_group->fork_sequence(sequence_to_fork, 7);
+    EXPECT_EQ(forked_sequence->get_grouped_id(), 7);
+    bm.fork_sequence(sequence_to_fork->get_id(), forked_sequence->get_id());
+
+    // several tokens of each branch fill the shared block and need a new block
+    sequence_group->schedule_tokens(4);
+    // a new block for each sequence and a copy of the shared block
+    EXPECT_EQ(bm.required_blocks_count(sequence_group), 3);
+    auto copy_blocks_map = bm.append_slots(sequence_group);
+    EXPECT_EQ(copy_blocks_map.size(), 1);
+    EXPECT_EQ(bm.num_free_blocks(), 11);
+    EXPECT_NE(bm.get_block_table(sequence_to_fork->get_id(), 0)[1]->get_index(),
+              bm.get_block_table(forked_sequence->get_id(), 0)[1]->get_index());
+    EXPECT_EQ(bm.get_block_table(sequence_to_fork->get_id(), 0)[0]->get_index(),
+              bm.get_block_table(forked_sequence->get_id(), 0)[0]->get_index());
+
+    for (auto& sequence : sequence_group->get_sequences()) {
+        bm.free_sequence(sequence->get_id());
+    }
+}
 
 TEST(TestBlockManager, CanFreeBlocksFromSequence) {
     const size_t BLOCK_SIZE = 2;
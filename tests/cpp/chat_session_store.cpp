@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "chat_session_store.hpp"
+
+using ov::genai::ChatSession;
+using ov::genai::ChatSessionStore;
+using ov::genai::KVStateSnapshot;
+
+TEST(TestKVStateSnapshot, restores_copied_and_compressed_state) {
+    // [batch, num_kv_heads, seq_len, head_size]
+    std::vector<float> values(1 * 2 * 3 * 4);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = (static_cast<float>(i % 7) - 3.f) * 0.25f;
+    }
+    ov::Tensor state(ov::element::f32, {1, 2, 3, 4}, values.data());
+
+    KVStateSnapshot copy("past_key_values.0.key", state, false);
+    EXPECT_FALSE(copy.is_compressed());
+    values[0] = 100.f;
+    EXPECT_EQ(copy.restore().data<float>()[0], -0.75f);
+
+    values[0] = -0.75f;
+    KVStateSnapshot compressed("past_key_values.0.key", state, true);
+    EXPECT_TRUE(compressed.is_compressed());
+    EXPECT_LT(compressed.get_byte_size(), copy.get_byte_size());
+    ov::Tensor restored = compressed.restore();
+    ASSERT_EQ(restored.get_element_type(), ov::element::f32);
+    ASSERT_EQ(restored.get_shape(), state.get_shape());
+    for (size_t i = 0; i < values.size(); ++i) {
+        // error doesn't exceed a half of quantization step of the row
+        EXPECT_NEAR(restored.data<float>()[i], values[i], 1.5f / 255.f);
+    }
+}
+
+TEST(TestChatSessionStore, evicts_least_recently_saved_session) {
+    ChatSessionStore store(2);
+    ChatSession session;
+    session.history.push_back({{"role", "user"}, {"content", "first"}});
+    store.put("first", session);
+    store.put("second", ChatSession{});
+    // saving again makes the session the most recent one
+    store.put("first", session);
+    store.put("third", ChatSession{});
+
+    EXPECT_EQ(store.size(), size_t(2));
+    EXPECT_FALSE(store.contains("second"));
+    EXPECT_FALSE(store.take("second").has_value());
+
+    auto restored = store.take("first");
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->history.size(), size_t(1));
+    // restored session is continued by the pipeline, so it's removed from the store
+    EXPECT_FALSE(store.contains("first"));
+    EXPECT_TRUE(store.contains("third"));
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "llm_pipeline_static.hpp"
+
+using namespace ov::genai::static_llm;
+
+TEST(SplitPromptByBuckets, selects_smallest_fitting_bucket) {
+    const std::vector<uint32_t> buckets = {128, 512, 1024};
+
+    auto chunks = split_prompt_by_buckets(50, buckets);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0].input_len, 128u);
+    EXPECT_EQ(chunks[0].num_tokens, 50u);
+
+    chunks = split_prompt_by_buckets(512, buckets);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0].input_len, 512u);
+    EXPECT_EQ(chunks[0].num_tokens, 512u);
+}
+
+TEST(SplitPromptByBuckets, chunks_long_prompt_by_smallest_bucket) {
+    const std::vector<uint32_t> buckets = {128, 512};
+
+    // only the first chunk is padded
+    auto chunks = split_prompt_by_buckets(600, buckets);
+    ASSERT_EQ(chunks.size(), 5u);
+    EXPECT_EQ(chunks[0].input_len, 128u);
+    EXPECT_EQ(chunks[0].num_tokens, 88u);
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        EXPECT_EQ(chunks[i].input_len, 128u);
+        EXPECT_EQ(chunks[i].num_tokens, 128u);
+    }
+
+    chunks = split_prompt_by_buckets(768, buckets);
+    ASSERT_EQ(chunks.size(), 6u);
+    EXPECT_EQ(chunks[0].num_tokens, 128u);
+}
+
+TEST(SplitPromptByBuckets, chunks_prompt_longer_than_largest_bucket) {
+    // default buckets for MAX_PROMPT_LEN of 1024, a longer prompt still fits into KV cache of MIN_RESPONSE_LEN more tokens
+    const std::vector<uint32_t> buckets = {128, 512, 1024};
+
+    auto chunks = split_prompt_by_buckets(1100, buckets);
+    ASSERT_EQ(chunks.size(), 9u);
+    EXPECT_EQ(chunks[0].num_tokens, 76u);
+    for (const auto& chunk : chunks) {
+        EXPECT_EQ(chunk.input_len, 128u);
+    }
+}
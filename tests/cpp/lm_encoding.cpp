@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <tuple>
+#include "openvino/op/convert.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "lm_encoding.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// request of a model taking inputs of generation steps, so that they can be read back from the request after being set
+ov::InferRequest create_step_inputs_request() {
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    for (const auto& [name, type, rank] : std::vector<std::tuple<std::string, ov::element::Type, size_t>>{
+            {"input_ids", ov::element::i64, 2}, {"attention_mask", ov::element::i64, 2}, {"position_ids", ov::element::i64, 2}, {"beam_idx", ov::element::i32, 1}}) {
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(type, ov::PartialShape::dynamic(rank));
+        parameter->output(0).set_names({name});
+        parameters.push_back(parameter);
+        // outputs of the model don't have the names of inputs
+        results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v0::Convert>(parameter, ov::element::f32)));
+    }
+    auto model = std::make_shared<ov::Model>(results, parameters);
+    return utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+template <typename T>
+std::vector<T> get_data(ov::InferRequest& request, const std::string& name) {
+    ov::Tensor tensor = request.get_tensor(name);
+    return std::vector<T>(tensor.data<const T>(), tensor.data<const T>() + tensor.get_size());
+}
+
+}  // namespace
+
+TEST(AlignKVCacheAndHistory, trims_only_divergent_tail) {
+    KVCacheState kv_cache_state;
+    kv_cache_state.get_state() = {1, 2, 3, 4, 5, 6};
+    KVCacheTrimManager trim_manager;
+
+    // the template re-rendered the previous answer starting from the 4th token
+    std::vector<int64_t> new_history = {1, 2, 3, 7, 8, 9, 10};
+    ov::Tensor new_chat_tokens(ov::element::i64, {1, new_history.size()}, new_history.data());
+    align_kv_cache_and_history(trim_manager, new_chat_tokens, kv_cache_state);
+
+    EXPECT_EQ(trim_manager.num_tokens_to_trim, 3u);
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2, 3}));
+
+    TokenizedInputs encoded_input = get_chat_encoded_input(new_chat_tokens, kv_cache_state);
+    const int64_t* input_ids = encoded_input.input_ids.data<int64_t>();
+    EXPECT_EQ(std::vector<int64_t>(input_ids, input_ids + encoded_input.input_ids.get_size()), std::vector<int64_t>({7, 8, 9, 10}));
+}
+
+TEST(AlignKVCacheAndHistory, keeps_kv_cache_consistent_with_beam_search_tail) {
+    KVCacheState kv_cache_state;
+    kv_cache_state.get_state() = {1, 2, 3, 4};
+    // KV cache also contains 2 tokens of the longest beam, which aren't in the state
+    KVCacheTrimManager trim_manager;
+    trim_manager.num_tokens_to_trim = 2;
+
+    std::vector<int64_t> new_history = {1, 2, 5, 6};
+    ov::Tensor new_chat_tokens(ov::element::i64, {1, new_history.size()}, new_history.data());
+    align_kv_cache_and_history(trim_manager, new_chat_tokens, kv_cache_state);
+
+    EXPECT_EQ(trim_manager.num_tokens_to_trim, 4u);
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2}));
+}
+
+TEST(AlignKVCacheAndHistory, infers_at_least_one_token) {
+    KVCacheState kv_cache_state;
+    kv_cache_state.get_state() = {1, 2, 3, 4};
+    KVCacheTrimManager trim_manager;
+
+    // the new history is a prefix of the cached tokens
+    std::vector<int64_t> new_history = {1, 2, 3};
+    ov::Tensor new_chat_tokens(ov::element::i64, {1, new_history.size()}, new_history.data());
+    align_kv_cache_and_history(trim_manager, new_chat_tokens, kv_cache_state);
+
+    EXPECT_EQ(trim_manager.num_tokens_to_trim, 2u);
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2}));
+}
+
+TEST(AlignKVCacheAndHistory, skips_tokens_evicted_by_sliding_window) {
+    KVCacheState kv_cache_state;
+    kv_cache_state.get_state() = {1, 2, 3, 4, 5, 6, 7};
+    // tokens 3 and 4 following 2 sink tokens are evicted
+    kv_cache_state.evict(2, 2);
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2, 5, 6, 7}));
+    KVCacheTrimManager trim_manager;
+
+    std::vector<int64_t> new_history = {1, 2, 3, 4, 5, 6, 8, 9};
+    ov::Tensor new_chat_tokens(ov::element::i64, {1, new_history.size()}, new_history.data());
+    align_kv_cache_and_history(trim_manager, new_chat_tokens, kv_cache_state);
+
+    EXPECT_EQ(trim_manager.num_tokens_to_trim, 1u);
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2, 5, 6}));
+    EXPECT_EQ(kv_cache_state.get_evicted_tokens(), std::vector<int64_t>({3, 4}));
+
+    TokenizedInputs encoded_input = get_chat_encoded_input(new_chat_tokens, kv_cache_state);
+    const int64_t* input_ids = encoded_input.input_ids.data<int64_t>();
+    EXPECT_EQ(std::vector<int64_t>(input_ids, input_ids + encoded_input.input_ids.get_size()), std::vector<int64_t>({8, 9}));
+
+    // the history diverged within the evicted tokens, so only the sink tokens are kept
+    std::vector<int64_t> other_history = {1, 2, 10, 11};
+    ov::Tensor other_chat_tokens(ov::element::i64, {1, other_history.size()}, other_history.data());
+    align_kv_cache_and_history(trim_manager, other_chat_tokens, kv_cache_state);
+
+    EXPECT_EQ(kv_cache_state.get_state(), std::vector<int64_t>({1, 2}));
+    EXPECT_TRUE(kv_cache_state.get_evicted_tokens().empty());
+}
+
+TEST(GenerationStepInputs, reorders_mask_and_position_ids_by_next_beams) {
+    ov::InferRequest request = create_step_inputs_request();
+    // the first prompt is left padded
+    std::vector<int64_t> mask = {0, 1, 1,
+                                 1, 1, 1};
+    ov::Tensor attention_mask(ov::element::i64, {2, 3}, mask.data());
+    // capacity of the mask is less than the generation requires, so it's reallocated as well
+    GenerationStepInputs step_inputs(attention_mask, ov::Tensor(ov::element::i64, {2, 3}), std::nullopt, 3, 4);
+
+    step_inputs.get_next_beams() = {0, 1};
+    step_inputs.update(request);
+    step_inputs.set_to(request, false);
+    EXPECT_EQ(get_data<int64_t>(request, "attention_mask"), std::vector<int64_t>({0, 1, 1, 1,
+                                                                                  1, 1, 1, 1}));
+    EXPECT_EQ(get_data<int64_t>(request, "position_ids"), std::vector<int64_t>({2, 3}));
+    EXPECT_EQ(get_data<int32_t>(request, "beam_idx"), std::vector<int32_t>({0, 1}));
+
+    // beams of the second sequence are forked, the first sequence moves to the last row
+    step_inputs.get_next_beams() = {1, 1, 0};
+    step_inputs.update(request);
+    step_inputs.set_to(request, false);
+    EXPECT_EQ(request.get_tensor("attention_mask").get_shape(), ov::Shape({3, 5}));
+    EXPECT_EQ(get_data<int64_t>(request, "attention_mask"), std::vector<int64_t>({1, 1, 1, 1, 1,
+                                                                                  1, 1, 1, 1, 1,
+                                                                                  0, 1, 1, 1, 1}));
+    EXPECT_EQ(get_data<int64_t>(request, "position_ids"), std::vector<int64_t>({4, 4, 3}));
+    EXPECT_EQ(get_data<int32_t>(request, "beam_idx"), std::vector<int32_t>({1, 1, 0}));
+
+    // only the first sequence continues
+    step_inputs.get_next_beams() = {2};
+    step_inputs.update(request);
+    step_inputs.set_to(request, false);
+    EXPECT_EQ(get_data<int64_t>(request, "attention_mask"), std::vector<int64_t>({0, 1, 1, 1, 1, 1}));
+    EXPECT_EQ(get_data<int64_t>(request, "position_ids"), std::vector<int64_t>({4}));
+    EXPECT_EQ(get_data<int32_t>(request, "beam_idx"), std::vector<int32_t>({2}));
+    EXPECT_EQ(step_inputs.get_kv_cache_len(), 6u);
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/genai/llm_pipeline.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "model_registry.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// model with weights of hidden_size * vocab_size floats, i.e. 64 MB by default
+std::filesystem::path save_model_with_weights(const std::filesystem::path& model_dir, size_t hidden_size = 1024, size_t vocab_size = 16384) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, static_cast<int64_t>(hidden_size)});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{hidden_size, vocab_size}, std::vector<float>(hidden_size * vocab_size, 0.5f));
+    auto logits = std::make_shared<ov::op::v0::MatMul>(input, weights);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{logits}, ov::ParameterVector{input});
+
+    std::filesystem::create_directories(model_dir);
+    const std::filesystem::path model_path = model_dir / "openvino_model.xml";
+    ov::save_model(model, model_path.string(), false);
+    return model_path;
+}
+
+const void* get_weights_data(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            return constant->get_data_ptr();
+        }
+    }
+    return nullptr;
+}
+
+// resident memory of the process, 0 if unknown
+size_t get_rss_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            std::istringstream fields(line.substr(6));
+            size_t rss_kb = 0;
+            fields >> rss_kb;
+            return rss_kb;
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+TEST(ModelRegistry, shares_read_model_until_last_clone_released) {
+    const std::filesystem::path model_dir = std::filesystem::temp_directory_path() / "genai_model_registry_read_test";
+    const auto model_path = save_model_with_weights(model_dir, 16, 32);
+    const ov::AnyMap properties = {ov::genai::share_models(true)};
+
+    utils::ModelRegistry& registry = utils::ModelRegistry::get();
+    const size_t num_models = registry.get_num_models();
+    {
+        auto model = utils::read_model(model_path, properties);
+        auto other_model = utils::read_model(model_path, properties);
+
+        // pipelines transform their own clones of the model, which share weights
+        EXPECT_NE(model, other_model);
+        EXPECT_EQ(get_weights_data(model), get_weights_data(other_model));
+        EXPECT_EQ(registry.get_num_models(), num_models + 1);
+
+        // the model isn't shared without the property
+        EXPECT_NE(get_weights_data(utils::read_model(model_path, {})), get_weights_data(model));
+    }
+    EXPECT_EQ(registry.get_num_models(), num_models);
+
+    std::filesystem::remove_all(model_dir);
+}
+
+TEST(ModelRegistry, instances_over_one_model_keep_memory_of_one_copy) {
+    if (get_rss_kb() == 0) {
+        GTEST_SKIP() << "Resident memory of the process is unknown";
+    }
+
+    const std::filesystem::path model_dir = std::filesystem::temp_directory_path() / "genai_model_registry_memory_test";
+    const auto model_path = save_model_with_weights(model_dir);
+    const size_t rss_before_kb = get_rss_kb();
+    const ov::AnyMap properties = {ov::genai::share_models(true)};
+
+    utils::ModelRegistry& registry = utils::ModelRegistry::get();
+    const size_t num_compiled_models = registry.get_num_compiled_models();
+
+    // the same as a pipeline does: read, compile and infer the model, keeping the compiled model and the infer request
+    constexpr size_t num_instances = 4;
+    std::vector<std::shared_ptr<ov::CompiledModel>> compiled_models;
+    std::vector<ov::InferRequest> infer_requests;
+    size_t one_copy_kb = 0;
+    for (size_t i = 0; i < num_instances; ++i) {
+        auto model = utils::read_model(model_path, properties);
+        compiled_models.push_back(utils::ModelRegistry::get().compile_model(model, "CPU", {}));
+        infer_requests.push_back(compiled_models.back()->create_infer_request());
+        infer_requests.back().set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{1, 1024}));
+        infer_requests.back().infer();
+        if (i == 0) {
+            one_copy_kb = get_rss_kb() - rss_before_kb;
+        }
+    }
+
+    EXPECT_EQ(compiled_models.front(), compiled_models.back());
+    EXPECT_EQ(registry.get_num_compiled_models(), num_compiled_models + 1);
+    // each next instance adds only its infer request
+    EXPECT_LT(get_rss_kb() - rss_before_kb, one_copy_kb * 3 / 2);
+
+    infer_requests.clear();
+    compiled_models.clear();
+    EXPECT_EQ(registry.get_num_compiled_models(), num_compiled_models);
+
+    std::filesystem::remove_all(model_dir);
+}
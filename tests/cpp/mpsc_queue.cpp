@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "mpsc_queue.hpp"
+
+TEST(TestMPSCQueue, pops_in_push_order) {
+    MPSCQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    queue.push(1);
+    queue.push(2);
+    EXPECT_FALSE(queue.empty());
+
+    int value = 0;
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TestMPSCQueue, releases_popped_and_remaining_elements) {
+    auto element = std::make_shared<int>(0);
+    {
+        MPSCQueue<std::shared_ptr<int>> queue;
+        queue.push(element);
+        queue.push(element);
+        std::shared_ptr<int> value;
+        EXPECT_TRUE(queue.try_pop(value));
+        value.reset();
+        EXPECT_EQ(element.use_count(), 2);
+    }
+    EXPECT_EQ(element.use_count(), 1);
+}
+
+TEST(TestMPSCQueue, concurrent_producers) {
+    const size_t num_producers = 8, num_elements_per_producer = 10000;
+    MPSCQueue<std::pair<size_t, size_t>> queue;
+
+    std::vector<std::thread> producers;
+    for (size_t producer_id = 0; producer_id < num_producers; ++producer_id) {
+        producers.emplace_back([&queue, producer_id, num_elements_per_producer] {
+            for (size_t i = 0; i < num_elements_per_producer; ++i)
+                queue.push({producer_id, i});
+        });
+    }
+
+    // elements of each producer are popped in the order they were pushed
+    std::vector<size_t> next_element(num_producers, 0);
+    size_t num_popped = 0;
+    std::pair<size_t, size_t> value;
+    while (num_popped < num_producers * num_elements_per_producer) {
+        if (!queue.try_pop(value))
+            continue;
+        EXPECT_EQ(value.second, next_element[value.first]);
+        next_element[value.first] = value.second + 1;
+        ++num_popped;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop(value));
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "prompt_lookup/ngram_index.hpp"
+
+using ov::genai::NGramIndex;
+
+TEST(TestNGramIndex, returns_tokens_following_earliest_occurrence_of_longest_ngram) {
+    NGramIndex index(3);
+    std::vector<int64_t> tokens = {1, 2, 3, 4, 5, 9, 3, 6, 7, 2, 3};
+    index.append(tokens.begin(), tokens.end());
+    // the trigram {7, 2, 3} occurs only at the end, so the bigram {2, 3} is matched
+    EXPECT_EQ(index.find_candidates(2), std::vector<int64_t>({4, 5}));
+    EXPECT_EQ(index.find_candidates(100), std::vector<int64_t>({4, 5, 9, 3, 6, 7, 2, 3}));
+
+    index.append(4);
+    EXPECT_EQ(index.find_candidates(2), std::vector<int64_t>({5, 9}));
+}
+
+TEST(TestNGramIndex, returns_nothing_without_earlier_occurrence) {
+    NGramIndex index(2);
+    EXPECT_TRUE(index.find_candidates(3).empty());
+
+    std::vector<int64_t> tokens = {1, 2, 3};
+    index.append(tokens.begin(), tokens.end());
+    EXPECT_TRUE(index.find_candidates(3).empty());
+    EXPECT_TRUE(index.find_candidates(0).empty());
+}
+
+TEST(TestNGramIndex, matches_overlapping_occurrence) {
+    NGramIndex index(2);
+    std::vector<int64_t> tokens = {5, 5, 5};
+    index.append(tokens.begin(), tokens.end());
+    // {5, 5} ending at position 1 is followed by a single token before the end of the sequence
+    EXPECT_EQ(index.find_candidates(3), std::vector<int64_t>({5}));
+}
+
+TEST(TestNGramIndex, compares_indexed_tokens_with_sequence) {
+    NGramIndex index(2);
+    std::vector<int64_t> tokens = {1, 2, 3, 4, 5};
+    index.append(tokens.begin(), tokens.end());
+
+    // generated tokens following the prompt {1, 2}
+    std::vector<int64_t> generated = {3, 4, 5, 6};
+    EXPECT_TRUE(index.has_tokens_at(2, generated.begin()));
+    // a token replaced in the middle is detected, even if the last indexed token is the same
+    generated = {3, 7, 5, 6};
+    EXPECT_FALSE(index.has_tokens_at(2, generated.begin()));
+    // nothing is compared past the indexed tokens
+    EXPECT_TRUE(index.has_tokens_at(5, generated.begin()));
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "paged_attention_transformations.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t num_tokens = 2, hidden_size = 4, vocab_size = 3;
+
+std::shared_ptr<ov::op::v0::Constant> create_weights(const ov::Shape& shape, size_t seed) {
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(std::sin(seed * 7 + i + 1));
+    }
+    return ov::op::v0::Constant::create(ov::element::f32, shape, values);
+}
+
+std::shared_ptr<ov::op::v0::Parameter> create_parameter(const std::string& name, const ov::Shape& shape) {
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    parameter->set_friendly_name(name);
+    parameter->output(0).set_names({name});
+    return parameter;
+}
+
+// decoder with pre-norm layers where multiplications stand for norms, attention and MLP: attention of a layer is the consumer
+// of its `key_cache.<layer>` input like PagedAttention after `apply_paged_attention_transformations`; weights depend on the layer only,
+// so the first layers of a deeper decoder are the same as layers of a shallow one
+std::shared_ptr<ov::Model> create_decoder(size_t num_layers, bool has_residual_connections = true) {
+    auto inputs_embeds = create_parameter("inputs_embeds", {num_tokens, hidden_size});
+    ov::ParameterVector parameters{inputs_embeds};
+    ov::Output<ov::Node> hidden_states = inputs_embeds;
+    for (size_t layer = 0; layer < num_layers; ++layer) {
+        auto key_cache = create_parameter("key_cache." + std::to_string(layer), {hidden_size});
+        auto value_cache = create_parameter("value_cache." + std::to_string(layer), {hidden_size});
+        parameters.insert(parameters.end(), {key_cache, value_cache});
+
+        auto input_norm = std::make_shared<ov::op::v1::Multiply>(hidden_states, create_weights({hidden_size}, layer * 2));
+        auto attention = std::make_shared<ov::op::v1::Multiply>(input_norm, key_cache);
+        ov::Output<ov::Node> attention_output = std::make_shared<ov::op::v1::Multiply>(attention, value_cache);
+        if (has_residual_connections) {
+            attention_output = std::make_shared<ov::op::v1::Add>(attention_output, hidden_states);
+        }
+        ov::Output<ov::Node> mlp_output = std::make_shared<ov::op::v1::Multiply>(attention_output, create_weights({hidden_size}, layer * 2 + 1));
+        if (has_residual_connections) {
+            mlp_output = std::make_shared<ov::op::v1::Add>(mlp_output, attention_output);
+        }
+        hidden_states = mlp_output;
+    }
+    auto final_norm = std::make_shared<ov::op::v1::Multiply>(hidden_states, create_weights({hidden_size}, 100));
+    auto logits = std::make_shared<ov::op::v0::MatMul>(final_norm, create_weights({hidden_size, vocab_size}, 101));
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(logits)}, parameters);
+}
+
+std::vector<float> infer_logits(const std::shared_ptr<ov::Model>& model) {
+    ov::InferRequest request = utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+    for (const auto& input : model->inputs()) {
+        ov::Tensor tensor(ov::element::f32, input.get_shape());
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            tensor.data<float>()[i] = static_cast<float>(std::cos(input.get_any_name().size() + i));
+        }
+        request.set_tensor(input.get_any_name(), tensor);
+    }
+    request.infer();
+    ov::Tensor logits = request.get_output_tensor();
+    return std::vector<float>(logits.data<const float>(), logits.data<const float>() + logits.get_size());
+}
+
+}  // namespace
+
+TEST(TestEarlyExitTransformation, passes_residual_stream_of_first_layers_to_final_norm) {
+    const size_t num_layers = 4, num_exit_layers = 2;
+    std::shared_ptr<ov::Model> model = create_decoder(num_layers);
+    utils::apply_early_exit_transformation(model, num_exit_layers);
+
+    // KV cache inputs of the removed layers are removed
+    ASSERT_EQ(model->get_parameters().size(), 1 + 2 * num_exit_layers);
+    for (const auto& parameter : model->get_parameters()) {
+        EXPECT_NE(parameter->get_friendly_name(), "key_cache." + std::to_string(num_exit_layers));
+    }
+
+    // logits are the ones of the decoder consisting of the first layers only
+    std::vector<float> logits = infer_logits(model), expected_logits = infer_logits(create_decoder(num_exit_layers));
+    ASSERT_EQ(logits.size(), num_tokens * vocab_size);
+    for (size_t i = 0; i < logits.size(); ++i) {
+        EXPECT_NEAR(logits[i], expected_logits[i], 1e-5);
+    }
+}
+
+TEST(TestEarlyExitTransformation, rejects_invalid_number_of_layers) {
+    EXPECT_THROW(utils::apply_early_exit_transformation(create_decoder(4), 0), ov::Exception);
+    EXPECT_THROW(utils::apply_early_exit_transformation(create_decoder(4), 4), ov::Exception);
+}
+
+TEST(TestEarlyExitTransformation, rejects_unsupported_topology) {
+    // no residual connections to exit from
+    EXPECT_THROW(utils::apply_early_exit_transformation(create_decoder(4, false), 2), ov::Exception);
+
+    // no paged attention
+    auto inputs_embeds = create_parameter("inputs_embeds", {num_tokens, hidden_size});
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(inputs_embeds)}, ov::ParameterVector{inputs_embeds});
+    EXPECT_THROW(utils::apply_early_exit_transformation(model, 1), ov::Exception);
+}
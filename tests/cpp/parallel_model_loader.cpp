@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "openvino/core/except.hpp"
+#include "parallel_model_loader.hpp"
+
+using namespace ov::genai;
+
+TEST(ParallelModelLoader, loads_models_concurrently_up_to_the_bound) {
+    constexpr size_t max_parallel_loads = 2;
+    utils::ParallelModelLoader loader(max_parallel_loads);
+
+    std::atomic<size_t> num_running_loads{0}, max_running_loads{0};
+    for (const std::string model_name : {"text_encoder", "unet", "vae", "vae_encoder"}) {
+        loader.add(model_name, [&]() {
+            size_t num_running = ++num_running_loads;
+            size_t max_running = max_running_loads;
+            while (num_running > max_running && !max_running_loads.compare_exchange_weak(max_running, num_running));
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            --num_running_loads;
+        });
+    }
+    std::vector<ModelLoadInterval> timeline = loader.wait();
+
+    EXPECT_EQ(max_running_loads, max_parallel_loads);
+    ASSERT_EQ(timeline.size(), 4u);
+    for (size_t i = 0; i < timeline.size(); ++i) {
+        EXPECT_GE(timeline[i].duration, 50.f);
+        if (i > 0) {
+            EXPECT_LE(timeline[i - 1].start, timeline[i].start);
+        }
+    }
+    // the last loads wait for the first ones
+    EXPECT_GE(timeline.back().start, 50.f);
+}
+
+TEST(ParallelModelLoader, rethrows_error_after_all_loads_finished) {
+    utils::ParallelModelLoader loader;
+    std::atomic<bool> is_other_model_loaded{false};
+    loader.add("broken_model", []() {
+        OPENVINO_THROW("Failed to load");
+    });
+    loader.add("model", [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        is_other_model_loaded = true;
+    });
+
+    EXPECT_THROW(loader.wait(), ov::Exception);
+    EXPECT_TRUE(is_other_model_loaded);
+}
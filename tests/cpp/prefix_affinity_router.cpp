@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include "data_parallel/prefix_affinity_router.hpp"
+
+static ov::Tensor make_prompt(size_t length, int64_t first_token) {
+    ov::Tensor input_ids(ov::element::i64, {1, length});
+    std::iota(input_ids.data<int64_t>(), input_ids.data<int64_t>() + length, first_token);
+    return input_ids;
+}
+
+TEST(TestPrefixAffinityRouter, routes_to_least_loaded_replica_without_prefix_hit) {
+    ov::genai::PrefixAffinityRouter router(3, 4);
+    EXPECT_EQ(router.route(make_prompt(8, 0), {2, 0, 1}), 1);
+    EXPECT_EQ(router.route(make_prompt(8, 100), {0, 1, 1}), 0);
+}
+
+TEST(TestPrefixAffinityRouter, routes_to_replica_with_prefix_hit) {
+    ov::genai::PrefixAffinityRouter router(2, 4);
+    EXPECT_EQ(router.route(make_prompt(12, 0), {1, 0}), 1);
+    // shares two leading blocks with the first prompt
+    ov::Tensor prompt = make_prompt(12, 0);
+    prompt.data<int64_t>()[9] = 1000;
+    EXPECT_EQ(router.route(prompt, {0, 2}), 1);
+    // prompt shorter than a block can't have a prefix hit
+    EXPECT_EQ(router.route(make_prompt(3, 0), {0, 2}), 0);
+}
+
+TEST(TestPrefixAffinityRouter, prefers_longest_prefix_hit) {
+    ov::genai::PrefixAffinityRouter router(2, 4);
+    EXPECT_EQ(router.route(make_prompt(4, 0), {0, 1}), 0);
+    ov::Tensor prompt = make_prompt(12, 0);
+    EXPECT_EQ(router.route(prompt, {1, 0}), 0);
+    // replica 0 is overloaded, so two leading blocks move to replica 1
+    EXPECT_EQ(router.route(make_prompt(8, 0), {5, 0}), 1);
+    prompt.data<int64_t>()[11] = 1000;
+    EXPECT_EQ(router.route(prompt, {0, 1}), 1);
+}
+
+TEST(TestPrefixAffinityRouter, ignores_prefix_hit_on_overloaded_replica) {
+    ov::genai::PrefixAffinityRouter router(2, 4, 1024, 2);
+    EXPECT_EQ(router.route(make_prompt(8, 0), {0, 1}), 0);
+    EXPECT_EQ(router.route(make_prompt(8, 0), {2, 0}), 0);
+    EXPECT_EQ(router.route(make_prompt(8, 0), {3, 0}), 1);
+}
+
+TEST(TestPrefixAffinityRouter, evicts_least_recently_routed_blocks) {
+    ov::genai::PrefixAffinityRouter router(2, 4, 2);
+    EXPECT_EQ(router.route(make_prompt(8, 0), {0, 1}), 0);
+    EXPECT_EQ(router.route(make_prompt(8, 100), {1, 0}), 1);
+    // blocks of the first prompt are evicted
+    EXPECT_EQ(router.route(make_prompt(8, 0), {1, 0}), 1);
+}
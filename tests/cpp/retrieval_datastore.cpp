@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <vector>
+#include "prompt_lookup/retrieval_datastore.hpp"
+
+using ov::genai::RetrievalDatastore;
+
+class RetrievalDatastoreTest : public ::testing::Test {
+protected:
+    std::filesystem::path m_path = std::filesystem::temp_directory_path() / "test_prompt_lookup_datastore.bin";
+
+    void write_datastore(const std::vector<std::vector<int32_t>>& documents) {
+        std::vector<int32_t> tokens;
+        for (const auto& document : documents) {
+            tokens.insert(tokens.end(), document.begin(), document.end());
+            tokens.push_back(RetrievalDatastore::DOCUMENT_SEPARATOR);
+        }
+        std::vector<uint32_t> suffix_array(tokens.size());
+        std::iota(suffix_array.begin(), suffix_array.end(), 0);
+        std::sort(suffix_array.begin(), suffix_array.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return std::lexicographical_compare(tokens.begin() + lhs, tokens.end(), tokens.begin() + rhs, tokens.end());
+        });
+
+        std::ofstream file(m_path, std::ios::binary);
+        const uint64_t num_tokens = tokens.size();
+        file.write(RetrievalDatastore::MAGIC, sizeof(RetrievalDatastore::MAGIC));
+        file.write(reinterpret_cast<const char*>(&num_tokens), sizeof(num_tokens));
+        file.write(reinterpret_cast<const char*>(tokens.data()), tokens.size() * sizeof(int32_t));
+        file.write(reinterpret_cast<const char*>(suffix_array.data()), suffix_array.size() * sizeof(uint32_t));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_path);
+    }
+};
+
+TEST_F(RetrievalDatastoreTest, returns_most_frequent_continuation_of_longest_ngram) {
+    write_datastore({{1, 2, 3, 4, 5}, {7, 2, 3, 4, 6}, {9, 2, 3, 4, 6}, {8, 3, 9, 9}});
+    RetrievalDatastore datastore(m_path);
+    EXPECT_EQ(datastore.size(), size_t(23));
+
+    // {2, 3} is followed by 4 in three documents, then by 6 in two of them
+    EXPECT_EQ(datastore.find_candidates({0, 2, 3}, 5, 3), std::vector<int64_t>({4, 6}));
+    EXPECT_EQ(datastore.find_candidates({0, 2, 3}, 1, 3), std::vector<int64_t>({4}));
+    // {1, 3} doesn't occur, so the shorter n-gram {3} is looked up
+    EXPECT_EQ(datastore.find_candidates({1, 3}, 1, 2), std::vector<int64_t>({4}));
+    // continuation must be followed by at least 2 occurrences
+    EXPECT_EQ(datastore.find_candidates({2, 3}, 5, 2, 2), std::vector<int64_t>({4, 6}));
+    EXPECT_EQ(datastore.find_candidates({8, 3}, 5, 2, 2), std::vector<int64_t>({4, 6}));
+}
+
+TEST_F(RetrievalDatastoreTest, stops_at_document_end) {
+    write_datastore({{1, 2, 3}, {4, 5}});
+    RetrievalDatastore datastore(m_path);
+    EXPECT_EQ(datastore.find_candidates({2}, 5, 1), std::vector<int64_t>({3}));
+    EXPECT_TRUE(datastore.find_candidates({3}, 5, 1).empty());
+    EXPECT_TRUE(datastore.find_candidates({6}, 5, 1).empty());
+}
+
+TEST_F(RetrievalDatastoreTest, throws_on_invalid_file) {
+    std::ofstream(m_path, std::ios::binary) << "not a datastore file";
+    EXPECT_ANY_THROW(RetrievalDatastore datastore(m_path));
+}
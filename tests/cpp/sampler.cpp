@@ -300,3 +300,51 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerValidationMode, gen_phase_to_cut_by_max_new_tokens) {
+    auto sampling_config = ov::genai::greedy();
+    sampling_config.max_new_tokens = 3;
+    sampling_config.logprobs = 1;
+    // create sequence group with prompt [0, 1, 2, 3, 4]
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+
+    // to emulate processed prompt and add next token [ 0 ]
+    sequence_groups.front()->get_sequences().front()->append_token(0, 1.f);
+    sequence_groups.front()->update_processed_tokens_num(5);
+
+    // append candidates [ 1, 2, 3 ]
+    size_t num_validated_tokens = 3;
+    for (size_t i = 1; i <= num_validated_tokens; ++i) {
+        sequence_groups.front()->get_sequences().front()->append_token(i, 1.f);
+    }
+
+    // all candidates are accepted, but generated sequence [0, 1, 2, 3, 4] is cut by max_new_tokens -> [0, 1, 2]
+    sequence_groups.front()->set_num_validated_tokens(num_validated_tokens);
+    const auto num_scheduled_tokens = sequence_groups.front()->get_num_available_tokens_for_batching();
+    sequence_groups.front()->schedule_tokens(num_scheduled_tokens);
+
+    std::vector<float> logits = {
+        0, 1.f, 0, 0, 0,
+        0, 0, 1.f, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+    };
+    ov::Tensor gen_input_ids(ov::element::f32, ov::Shape{4, 1, 5}, logits.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, gen_input_ids, true);
+
+    const auto& sequence = sequence_groups.front()->get_sequences().front();
+    TokenIds expected{0, 1, 2};
+    ASSERT_EQ(sequence->get_generated_ids(), expected);
+    // log probs of accepted candidates are replaced by the ones of the main model
+    const float expected_log_prob = -std::log(1.f + 4 * std::exp(-1.f));
+    ASSERT_EQ(sequence->get_generated_log_probs().size(), 3);
+    ASSERT_FLOAT_EQ(sequence->get_generated_log_probs()[1], expected_log_prob);
+    ASSERT_FLOAT_EQ(sequence->get_generated_log_probs()[2], expected_log_prob);
+    ASSERT_TRUE(sequence->has_finished());
+}
@@ -3,6 +3,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "openvino/runtime/core.hpp"
 #include "openvino/op/concat.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
@@ -1011,3 +1012,432 @@ TEST(TestScheduler, FullyPreemptsCacheEvictedSequences) {
         }
     }
 }
+
+TEST(TestScheduler, output_length_prediction_limits_admission) {
+    std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).max_num_batched_tokens = 32;
+    configs.at(0).num_kv_blocks = 6;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(0).max_num_seqs = 5;
+    configs.at(1).max_num_batched_tokens = 32;
+    configs.at(1).num_kv_blocks = 6;
+    configs.at(1).dynamic_split_fuse = true;
+    configs.at(1).max_num_seqs = 5;
+    for (auto scheduler_config: configs) {
+        for (bool use_output_length_prediction : {false, true}) {
+            scheduler_config.use_output_length_prediction = use_output_length_prediction;
+
+            // without history, each request is predicted to generate as many tokens as it has in prompt,
+            // so each request is expected to occupy 4 blocks in total
+            ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+            generation_config.max_new_tokens = 8;
+
+            std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+            std::vector<SequenceGroup::Ptr> requests;
+            for (size_t request_id = 0; request_id < 3; ++request_id) {
+                requests.push_back(std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                   generation_config, 4));
+            }
+
+            Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+            auto out = scheduler.schedule(requests);
+
+            if (use_output_length_prediction) {
+                // 2 prompt blocks + 2 blocks reserved for output of each admitted request, the third one has to wait
+                std::vector<uint64_t> ref_ids = {0, 1};
+                EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+                EXPECT_EQ(out.m_total_num_scheduled_tokens, tokens.size() * 2);
+            } else {
+                std::vector<uint64_t> ref_ids = {0, 1, 2};
+                EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+                EXPECT_EQ(out.m_total_num_scheduled_tokens, tokens.size() * 3);
+            }
+
+            for (auto& req : requests) {
+                for (auto& seq : req->get_sequences()) {
+                    if (scheduler.has_block_table(seq->get_id())) {
+                        scheduler.free_sequence(seq->get_id());
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, output_length_predictor_uses_prefix_history) {
+    HistoricalOutputLengthPredictor predictor(/* prefix_len = */ 4);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<uint64_t> other_tokens = {8,9,10,11,12,13,14,15};
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 100;
+
+    auto finished = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4);
+    // no history: output is assumed to be as long as prompt
+    EXPECT_EQ(predictor.predict(finished), tokens.size());
+
+    for (size_t i = 0; i < 20; ++i) {
+        (*finished)[0]->append_token(16, 0.9);
+    }
+    predictor.register_finished(finished);
+
+    // the same prefix uses its own history, other prefixes fall back to global one
+    auto same_prefix = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4);
+    EXPECT_EQ(predictor.predict(same_prefix), 20);
+    auto other_prefix = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {other_tokens.size()}, other_tokens.data()), generation_config, 4);
+    EXPECT_EQ(predictor.predict(other_prefix), 20);
+
+    // predictions never exceed max_new_tokens
+    generation_config.max_new_tokens = 10;
+    auto limited = std::make_shared<SequenceGroup>(3, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4);
+    EXPECT_EQ(predictor.predict(limited), 10);
+}
+
+SchedulerConfig get_chunked_prefill_scheduler_config(bool prompt_only_batches) {
+    auto scheduler_config = SchedulerConfig();
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 10;
+    scheduler_config.dynamic_split_fuse = false;
+    scheduler_config.max_num_seqs = 2;
+    scheduler_config.enable_chunked_prefill = true;
+    scheduler_config.prompt_only_batches = prompt_only_batches;
+    return scheduler_config;
+}
+
+// emulates sampler and model runner: appends a token to sequences which finished their prompts and completes the iteration
+void finish_chunked_prefill_iteration(std::vector<SequenceGroup::Ptr>& requests) {
+    for (auto& req : requests) {
+        if (req->requires_sampling()) {
+            req->get_running_sequences()[0]->append_token(16, 0.9);
+        }
+        req->finish_iteration();
+    }
+}
+
+TEST(TestScheduler, chunked_prefill_splits_long_prompt) {
+    for (bool prompt_only_batches : {true, false}) {
+        auto scheduler_config = get_chunked_prefill_scheduler_config(prompt_only_batches);
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19};
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                            ov::genai::greedy(), 4);
+        auto idx0 = (*sequence_group)[0]->get_id();
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+        // prompt of 20 tokens is longer than max_num_batched_tokens, so it's processed by chunks of 8, 8 and 4 tokens
+        std::vector<size_t> ref_chunks = {8, 8, 4};
+        std::vector<size_t> ref_num_blocks = {2, 4, 5};
+        for (size_t chunk_id = 0; chunk_id < ref_chunks.size(); ++chunk_id) {
+            auto out = scheduler.schedule(requests);
+            std::vector<uint64_t> ref_ids = {0};
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+            EXPECT_EQ(out.m_total_num_scheduled_tokens, ref_chunks[chunk_id]);
+            EXPECT_EQ(out.m_block_tables[idx0][0].size(), ref_num_blocks[chunk_id]);
+            EXPECT_TRUE(out.is_prompt);
+            EXPECT_EQ(sequence_group->requires_sampling(), chunk_id == ref_chunks.size() - 1);
+            finish_chunked_prefill_iteration(requests);
+        }
+
+        // generation phase
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, 1);
+        EXPECT_EQ(out.m_block_tables[idx0][0].size(), 6);
+        EXPECT_FALSE(out.is_prompt);
+        finish_chunked_prefill_iteration(requests);
+
+        for (auto& req : requests) {
+            for (auto& seq : req->get_sequences()) {
+                scheduler.free_sequence(seq->get_id());
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, chunked_prefill_interleaves_long_prompt_with_generation) {
+    auto scheduler_config = get_chunked_prefill_scheduler_config(/* prompt_only_batches = */ true);
+    std::vector<uint64_t> short_tokens = {0,1,2,3};
+    std::vector<uint64_t> long_tokens = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {short_tokens.size()}, short_tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {long_tokens.size()}, long_tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // the short prompt and the first chunk of the long prompt
+    auto out1 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids1 = {0, 1};
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids1);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 8);
+    EXPECT_TRUE(out1.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    // the long prompt is not finished yet, but the short one gets a generation step before the next chunk
+    auto out2 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids2 = {0};
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids2);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 1);
+    EXPECT_FALSE(out2.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    // the next chunk of the long prompt
+    auto out3 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids3 = {1};
+    EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, ref_ids3);
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, 8);
+    EXPECT_TRUE(out3.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    auto out4 = scheduler.schedule(requests);
+    EXPECT_EQ(out4.m_scheduled_sequence_groups_ids, ref_ids2);
+    EXPECT_FALSE(out4.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    // the last chunk of the long prompt
+    auto out5 = scheduler.schedule(requests);
+    EXPECT_EQ(out5.m_scheduled_sequence_groups_ids, ref_ids3);
+    EXPECT_EQ(out5.m_total_num_scheduled_tokens, 8);
+    EXPECT_TRUE(out5.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    // both sequence groups are in generation phase now
+    auto out6 = scheduler.schedule(requests);
+    EXPECT_EQ(out6.m_scheduled_sequence_groups_ids, ref_ids1);
+    EXPECT_EQ(out6.m_total_num_scheduled_tokens, 2);
+    EXPECT_FALSE(out6.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, chunked_prefill_mixes_long_prompt_with_generation) {
+    auto scheduler_config = get_chunked_prefill_scheduler_config(/* prompt_only_batches = */ false);
+    std::vector<uint64_t> short_tokens = {0,1,2,3};
+    std::vector<uint64_t> long_tokens = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {short_tokens.size()}, short_tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {long_tokens.size()}, long_tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    auto out1 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids = {0, 1};
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 8);
+    EXPECT_TRUE(out1.is_prompt);
+    finish_chunked_prefill_iteration(requests);
+
+    // generation token of the short prompt goes first, the chunk of the long prompt takes the rest of the batch
+    // 20 tokens of the long prompt are processed as 4 + 7 + 7 + 2
+    std::vector<size_t> ref_chunks = {7, 7, 2};
+    for (size_t chunk : ref_chunks) {
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, chunk + 1);
+        EXPECT_FALSE(out.is_prompt);
+        finish_chunked_prefill_iteration(requests);
+    }
+    EXPECT_EQ(sequence_group2->get_num_processed_tokens(), long_tokens.size());
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestKVBlockPool, quotas_and_borrowing) {
+    KVBlockPool pool(8);
+    size_t pipeline1 = pool.register_pipeline(4, 4, 1024);
+    size_t pipeline2 = pool.register_pipeline(4, 4, 1024);
+
+    // incompatible KV cache layout and quotas exceeding the pool are rejected
+    EXPECT_THROW(pool.register_pipeline(0, 4, 2048), ov::Exception);
+    EXPECT_THROW(pool.register_pipeline(1, 4, 1024), ov::Exception);
+
+    // the first pipeline borrows 2 blocks from the quota of the idle second one
+    EXPECT_EQ(pool.acquire(pipeline1, 6), 6);
+    EXPECT_FALSE(pool.is_starving(pipeline1));
+
+    // the second pipeline gets only what is left and waits for the rest of its quota
+    EXPECT_EQ(pool.acquire(pipeline2, 4), 2);
+    EXPECT_TRUE(pool.is_starving(pipeline2));
+
+    // returned blocks are reserved for the starving pipeline, the borrower can't take them back
+    pool.release(pipeline1, 2);
+    EXPECT_EQ(pool.get_num_free_blocks(), 2);
+    EXPECT_EQ(pool.acquire(pipeline1, 2), 0);
+    EXPECT_EQ(pool.acquire(pipeline2, 2), 2);
+    EXPECT_FALSE(pool.is_starving(pipeline2));
+    EXPECT_EQ(pool.get_num_free_blocks(), 0);
+
+    // unregistered pipelines return all their blocks
+    pool.unregister_pipeline(pipeline1);
+    EXPECT_EQ(pool.get_num_free_blocks(), 4);
+    EXPECT_EQ(pool.get_num_held_blocks(pipeline2), 4);
+    pool.release(pipeline2, 4);
+    EXPECT_EQ(pool.get_num_free_blocks(), 8);
+}
+
+TEST(TestKVBlockPool, borrowed_blocks_are_returned_to_starving_pipeline) {
+    KVBlockPool pool(8);
+    size_t pipeline1 = pool.register_pipeline(4, 4, 1024);
+    size_t pipeline2 = pool.register_pipeline(4, 4, 1024);
+
+    // nobody waits for blocks borrowed by the first pipeline
+    EXPECT_EQ(pool.acquire(pipeline1, 8), 8);
+    EXPECT_EQ(pool.get_num_blocks_to_return(pipeline1), 0);
+    EXPECT_FALSE(pool.wait_for_blocks(pipeline2, std::chrono::milliseconds(1)));
+
+    // the second pipeline starves within its quota, so the borrower has to return it, but not the own quota
+    EXPECT_EQ(pool.acquire(pipeline2, 3), 0);
+    EXPECT_TRUE(pool.is_starving(pipeline2));
+    EXPECT_EQ(pool.get_num_blocks_to_return(pipeline1), 4);
+    EXPECT_EQ(pool.get_num_blocks_to_return(pipeline2), 0);
+
+    // the starving pipeline is woken up by the returned blocks
+    std::thread borrower([&pool, pipeline1] { pool.release(pipeline1, 8); });
+    EXPECT_TRUE(pool.wait_for_blocks(pipeline2, std::chrono::seconds(10)));
+    borrower.join();
+    EXPECT_EQ(pool.get_num_blocks_to_return(pipeline1), 0);
+    EXPECT_EQ(pool.acquire(pipeline2, 3), 3);
+    EXPECT_FALSE(pool.is_starving(pipeline2));
+    pool.release(pipeline2, 3);
+}
+
+TEST(TestScheduler, borrower_returns_kv_blocks_to_starving_scheduler) {
+    auto pool = std::make_shared<KVBlockPool>(8);
+
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    // cached prefixes of the borrower are returned too
+    SchedulerConfig borrower_config = scheduler_config;
+    borrower_config.enable_prefix_caching = true;
+    Scheduler scheduler1 = Scheduler(4, init_cache_manager(borrower_config), borrower_config);
+    scheduler1.set_kv_block_pool(pool, 4);
+    Scheduler scheduler2 = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    scheduler2.set_kv_block_pool(pool, 4);
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 8;
+    std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7}, tokens2 = {8,9,10,11,12,13,14,15};
+    std::vector<SequenceGroup::Ptr> requests1, requests2;
+    requests1.push_back(std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()), generation_config, 4));
+    requests1.push_back(std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()), generation_config, 4));
+    requests2.push_back(std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()), generation_config, 4));
+
+    // the first scheduler borrows the whole pool and processes prompts
+    auto out1 = scheduler1.schedule(requests1);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens1.size() + tokens2.size());
+    EXPECT_EQ(pool->get_num_free_blocks(), 0);
+    for (auto& req : requests1) {
+        req->finish_iteration();
+    }
+    EXPECT_FALSE(scheduler1.must_return_kv_blocks());
+
+    // the second scheduler starves within its quota, while the first one keeps running
+    auto out2 = scheduler2.schedule(requests2);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 0);
+    EXPECT_TRUE(scheduler2.is_waiting_for_kv_blocks());
+    EXPECT_TRUE(scheduler1.must_return_kv_blocks());
+
+    // the borrower preempts its requests and returns all blocks
+    scheduler1.return_kv_blocks(requests1);
+    EXPECT_EQ(pool->get_num_free_blocks(), 8);
+    for (auto& req : requests1) {
+        EXPECT_TRUE(req->is_waiting());
+        EXPECT_EQ(req->get_num_processed_tokens(), 0);
+        EXPECT_FALSE(scheduler1.has_block_table(req->get_sequences()[0]->get_id()));
+    }
+
+    auto out3 = scheduler2.schedule(requests2);
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, tokens1.size());
+    EXPECT_FALSE(scheduler2.is_waiting_for_kv_blocks());
+
+    // the borrower recomputes its requests in the blocks left by the second scheduler
+    auto out4 = scheduler1.schedule(requests1);
+    EXPECT_GT(out4.m_total_num_scheduled_tokens, 0);
+    EXPECT_EQ(pool->get_num_free_blocks(), 0);
+    EXPECT_FALSE(scheduler1.must_return_kv_blocks());
+
+    for (auto& req : requests1) {
+        for (auto& seq : req->get_sequences()) {
+            if (scheduler1.has_block_table(seq->get_id()))
+                scheduler1.free_sequence(seq->get_id());
+        }
+    }
+    for (auto& req : requests2) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler2.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, two_schedulers_share_kv_block_pool) {
+    auto pool = std::make_shared<KVBlockPool>(8);
+
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    Scheduler scheduler1 = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    scheduler1.set_kv_block_pool(pool, 4);
+    Scheduler scheduler2 = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    scheduler2.set_kv_block_pool(pool, 4);
+
+    // each request is expected to take 4 blocks: 2 for the prompt and 2 for the predicted output
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 8;
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<SequenceGroup::Ptr> requests1, requests2;
+    for (size_t request_id = 0; request_id < 2; ++request_id) {
+        requests1.push_back(std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+    }
+    requests2.push_back(std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+
+    // the first scheduler borrows the whole pool while the second one is idle
+    auto out1 = scheduler1.schedule(requests1);
+    std::vector<uint64_t> ref_ids1 = {0, 1};
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids1);
+    EXPECT_EQ(pool->get_num_free_blocks(), 0);
+
+    // the second scheduler waits for blocks instead of running out of memory
+    auto out2 = scheduler2.schedule(requests2);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 0);
+    EXPECT_TRUE(scheduler2.is_waiting_for_kv_blocks());
+
+    // the first scheduler finishes its requests and returns the memory to the pool
+    for (auto& req : requests1) {
+        req->finish_iteration();
+        for (auto& seq : req->get_sequences()) {
+            scheduler1.free_sequence(seq->get_id());
+        }
+    }
+    scheduler1.release_kv_blocks();
+    EXPECT_EQ(pool->get_num_free_blocks(), 8);
+
+    auto out3 = scheduler2.schedule(requests2);
+    std::vector<uint64_t> ref_ids2 = {0};
+    EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, ref_ids2);
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, tokens.size());
+    EXPECT_FALSE(scheduler2.is_waiting_for_kv_blocks());
+    EXPECT_EQ(pool->get_num_free_blocks(), 4);
+
+    for (auto& req : requests2) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler2.free_sequence(seq->get_id());
+        }
+    }
+}
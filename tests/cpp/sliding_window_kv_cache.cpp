@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "sliding_window_kv_cache.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t num_heads = 2, head_size = 4;
+
+// stateful model appending its inputs to KV cache of a single layer named like the one of optimum-intel models
+ov::InferRequest create_kv_cache_request() {
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    for (const std::string name : {"key", "value"}) {
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{
+            ov::PartialShape{1, num_heads, -1, head_size}, ov::element::f32, "past_key_values.0." + name + "present.0." + name});
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, num_heads, -1, head_size});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto present = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, input}, 2);
+        parameters.push_back(input);
+        results.push_back(std::make_shared<ov::op::v0::Result>(present));
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(present, variable));
+    }
+    auto model = std::make_shared<ov::Model>(results, sinks, parameters);
+    return utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+ov::VariableState get_state(ov::InferRequest& request, const std::string& suffix) {
+    for (auto& state : request.query_state()) {
+        if (state.get_name().size() >= suffix.size() && state.get_name().compare(state.get_name().size() - suffix.size(), suffix.size(), suffix) == 0)
+            return state;
+    }
+    OPENVINO_THROW("State ", suffix, " isn't found");
+}
+
+// keys are unit vectors rotated by RoPE to their positions, values are their positions
+void fill_kv_cache(ov::InferRequest& request, size_t num_tokens, const std::vector<double>& inv_freqs) {
+    ov::Tensor keys(ov::element::f32, {1, num_heads, num_tokens, head_size}), values(ov::element::f32, keys.get_shape());
+    for (size_t head = 0; head < num_heads; ++head) {
+        for (size_t position = 0; position < num_tokens; ++position) {
+            float* key = keys.data<float>() + (head * num_tokens + position) * head_size;
+            for (size_t i = 0; i < inv_freqs.size(); ++i) {
+                key[i] = static_cast<float>(std::cos(position * inv_freqs[i]));
+                key[i + inv_freqs.size()] = static_cast<float>(std::sin(position * inv_freqs[i]));
+            }
+            std::fill_n(values.data<float>() + (head * num_tokens + position) * head_size, head_size, static_cast<float>(position));
+        }
+    }
+    get_state(request, "key").set_state(keys);
+    get_state(request, "value").set_state(values);
+}
+
+}  // namespace
+
+TEST(SlidingWindowKVCache, evicts_window_and_moves_keys_to_new_positions) {
+    ov::InferRequest request = create_kv_cache_request();
+    const RopeConfig rope_config;
+    const std::vector<double> inv_freqs = rope_config.get_inv_freqs(head_size);
+    fill_kv_cache(request, 8, inv_freqs);
+
+    SlidingWindowKVCache kv_cache(2, 6, 2, rope_config);
+    kv_cache.evict(request, 3);
+
+    ov::Tensor keys = get_state(request, "key").get_state(), values = get_state(request, "value").get_state();
+    ASSERT_EQ(keys.get_shape(), ov::Shape({1, num_heads, 5, head_size}));
+    ASSERT_EQ(values.get_shape(), ov::Shape({1, num_heads, 5, head_size}));
+    const std::vector<float> kept_positions = {0, 1, 5, 6, 7};
+    for (size_t head = 0; head < num_heads; ++head) {
+        for (size_t position = 0; position < kept_positions.size(); ++position) {
+            EXPECT_EQ(values.data<float>()[(head * kept_positions.size() + position) * head_size], kept_positions[position]);
+            // keys are the ones of the new positions as if the evicted tokens were never in the sequence
+            const float* key = keys.data<float>() + (head * kept_positions.size() + position) * head_size;
+            for (size_t i = 0; i < inv_freqs.size(); ++i) {
+                EXPECT_NEAR(key[i], std::cos(position * inv_freqs[i]), 1e-5);
+                EXPECT_NEAR(key[i + inv_freqs.size()], std::sin(position * inv_freqs[i]), 1e-5);
+            }
+        }
+    }
+}
+
+TEST(SlidingWindowKVCache, evicts_by_steps_only_when_full) {
+    // 4 sink tokens and a window of 16 tokens evicted by 2 tokens at least
+    SlidingWindowKVCache kv_cache(4, 16, 2);
+    EXPECT_EQ(kv_cache.get_num_tokens_to_evict(10, 10), 0u);
+    EXPECT_EQ(kv_cache.get_num_tokens_to_evict(20, 1), 2u);
+    EXPECT_EQ(kv_cache.get_num_tokens_to_evict(20, 8), 8u);
+    // only the window is evicted
+    EXPECT_EQ(kv_cache.get_num_tokens_to_evict(5, 16), 1u);
+    EXPECT_THROW(kv_cache.get_num_tokens_to_evict(10, 17), ov::Exception);
+}
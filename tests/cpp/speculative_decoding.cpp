@@ -11,6 +11,7 @@ protected:
     public:
         PipelineTestInstance() {
             m_sampler = std::make_shared<ov::genai::Sampler>();
+            m_scheduler = std::make_shared<ov::genai::Scheduler>(32, nullptr);
         };
 
         ov::genai::GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids) {
@@ -21,10 +22,7 @@ protected:
                                                                                 sampling_params, 
                                                                                 32);
 
-            {
-                std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-                m_awaiting_requests.push_back(sequence_group);
-            }
+            m_awaiting_requests.push_back(sequence_group);
             pull_awaiting_requests();
             return std::make_shared<ov::genai::GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
         };
@@ -204,19 +202,21 @@ TEST_F(CBForSDTest, update_empty_sequence_by_not_empty__two_sequence) {
         { 1, ov::genai::GeneratedSequence(tokens_1, log_probs_1) }
     };
     
+    // draft model follows both sequences of main model, which are updated up to the shortest one
     auto before = m_pipeline.get_generated_requests();
     auto update_result = m_pipeline.update_request(0, candidate, true);
     ASSERT_EQ(update_result.removed_tokens_cnt, 0);
-    ASSERT_EQ(update_result.inserted_tokens_cnt, 3);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 2);
 
     auto after = m_pipeline.get_generated_requests();
     ASSERT_NE(after.at(0).at(0).token_ids, before.at(0).at(0).token_ids);
     ASSERT_NE(after.at(0).at(0).log_probs, before.at(0).at(0).log_probs);
-    ASSERT_EQ(after.at(0).at(0).token_ids, tokens_0);
-    ASSERT_EQ(after.at(0).at(0).log_probs, log_probs_0);
+    ASSERT_EQ(after.at(0).at(0).token_ids, tokens_1);
+    ASSERT_EQ(after.at(0).at(0).log_probs, log_probs_1);
+    ASSERT_EQ(after.at(0).at(1).token_ids, tokens_1);
+    ASSERT_EQ(after.at(0).at(1).log_probs, log_probs_1);
 
-    ASSERT_EQ(after.at(0).size(), 1);
-    ASSERT_EQ(after.at(0).size(), 1);
+    ASSERT_EQ(after.at(0).size(), 2);
 }
 
 TEST_F(CBForSDTest, init_sequence_by_not_empty__two_sequence) {
@@ -426,3 +426,197 @@ TEST_F(CBForSDTest, add_tokens__two_sequence) {
     ASSERT_EQ(after.at(0).at(1).log_probs, log_probs);
 }
 
+TEST_F(CBForSDTest, follow_forked_sequence__two_sequence) {
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    m_pipeline.add_request(0, input_tensor);
+
+    std::vector<int64_t> tokens = { 0, 1, 2, 3 };
+    std::vector<float> log_probs = { 0.1f, 0.2f, 0.3f, 0.4f };
+    ov::genai::GeneratedSequences candidate{{ 0, ov::genai::GeneratedSequence(tokens, log_probs) }};
+
+    auto update_result = m_pipeline.update_request(0, candidate, true);
+    ASSERT_EQ(update_result.removed_tokens_cnt, 0);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 4);
+
+    // main model (e.g. beam search) forked the sequence after validation of the first tokens
+    std::vector<int64_t> tokens_0 = { 0, 1, 4 }, tokens_1 = { 0, 1, 2 };
+    std::vector<float> log_probs_0 = { 0.1f, 0.2f, 0.5f }, log_probs_1 = { 0.1f, 0.2f, 0.3f };
+    ov::genai::GeneratedSequences candidate_1{
+        { 0, ov::genai::GeneratedSequence(tokens_0, log_probs_0) },
+        { 1, ov::genai::GeneratedSequence(tokens_1, log_probs_1) },
+    };
+
+    update_result = m_pipeline.update_request(0, candidate_1, true);
+    ASSERT_EQ(update_result.removed_tokens_cnt, 2);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 1);
+
+    auto after = m_pipeline.get_generated_requests();
+    ASSERT_EQ(after.at(0).size(), 2);
+    ASSERT_EQ(after.at(0).at(0).token_ids, tokens_0);
+    ASSERT_EQ(after.at(0).at(0).log_probs, log_probs_0);
+    ASSERT_EQ(after.at(0).at(1).token_ids, tokens_1);
+    ASSERT_EQ(after.at(0).at(1).log_probs, log_probs_1);
+}
+
+TEST_F(CBForSDTest, follow_dropped_sequence__two_sequence) {
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    m_pipeline.add_request(0, input_tensor);
+
+    std::vector<int64_t> tokens_0 = { 0, 1, 2 }, tokens_1 = { 0, 1, 3 };
+    std::vector<float> log_probs_0 = { 0.1f, 0.2f, 0.3f }, log_probs_1 = { 0.1f, 0.2f, 0.4f };
+    ov::genai::GeneratedSequences candidate{
+        { 0, ov::genai::GeneratedSequence(tokens_0, log_probs_0) },
+        { 1, ov::genai::GeneratedSequence(tokens_1, log_probs_1) },
+    };
+
+    auto update_result = m_pipeline.init_request_by_candidate(0, candidate);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 3);
+
+    // main model dropped sequence 0 and continued sequence 1
+    std::vector<int64_t> new_tokens = { 0, 1, 3, 4 };
+    std::vector<float> new_log_probs = { 0.1f, 0.2f, 0.4f, 0.5f };
+    ov::genai::GeneratedSequences candidate_1{{ 1, ov::genai::GeneratedSequence(new_tokens, new_log_probs) }};
+
+    update_result = m_pipeline.update_request(0, candidate_1, true);
+    ASSERT_EQ(update_result.removed_tokens_cnt, 0);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 1);
+
+    auto after = m_pipeline.get_generated_requests();
+    ASSERT_EQ(after.at(0).size(), 1);
+    ASSERT_EQ(after.at(0).at(1).token_ids, new_tokens);
+    ASSERT_EQ(after.at(0).at(1).log_probs, new_log_probs);
+}
+
+TEST_F(CBForSDTest, keep_drafted_ahead_tokens__one_sequence) {
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    m_pipeline.add_request(0, input_tensor);
+
+    // draft tokens 0, 1, 2 are validated by main model, while 3, 4 are drafted ahead
+    std::vector<int64_t> tokens = { 0, 1, 2, 3, 4 };
+    std::vector<float> log_probs = { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f };
+    ov::genai::GeneratedSequences candidate{{ 0, ov::genai::GeneratedSequence(tokens, log_probs) }};
+    auto update_result = m_pipeline.update_request(0, candidate, true);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 5);
+
+    // main model accepts all validated tokens and generates the first token drafted ahead
+    std::vector<int64_t> validated_tokens = { 0, 1, 2, 3 };
+    std::vector<float> validated_log_probs = { 0.1f, 0.2f, 0.3f, 0.4f };
+    ov::genai::GeneratedSequences candidate_1{{ 0, ov::genai::GeneratedSequence(validated_tokens, validated_log_probs) }};
+    update_result = m_pipeline.update_request(0, candidate_1, true, true);
+    ASSERT_EQ(update_result.removed_tokens_cnt, 0);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 0);
+
+    auto after = m_pipeline.get_generated_requests();
+    ASSERT_EQ(after.at(0).at(0).token_ids, tokens);
+    ASSERT_EQ(after.at(0).at(0).log_probs, log_probs);
+}
+
+TEST_F(CBForSDTest, discard_drafted_ahead_tokens_on_rejection__one_sequence) {
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    m_pipeline.add_request(0, input_tensor);
+
+    std::vector<int64_t> tokens = { 0, 1, 2, 3, 4 };
+    std::vector<float> log_probs = { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f };
+    ov::genai::GeneratedSequences candidate{{ 0, ov::genai::GeneratedSequence(tokens, log_probs) }};
+    auto update_result = m_pipeline.update_request(0, candidate, true);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 5);
+
+    // main model rejects draft token 2 in the middle of the validated ones, so the tokens drafted ahead are discarded too
+    std::vector<int64_t> validated_tokens = { 0, 1, 7 };
+    std::vector<float> validated_log_probs = { 0.1f, 0.2f, 0.7f };
+    ov::genai::GeneratedSequences candidate_1{{ 0, ov::genai::GeneratedSequence(validated_tokens, validated_log_probs) }};
+    update_result = m_pipeline.update_request(0, candidate_1, true, true);
+    ASSERT_EQ(update_result.removed_tokens_cnt, 3);
+    ASSERT_EQ(update_result.inserted_tokens_cnt, 1);
+
+    auto after = m_pipeline.get_generated_requests();
+    ASSERT_EQ(after.at(0).at(0).token_ids, validated_tokens);
+    ASSERT_EQ(after.at(0).at(0).log_probs, validated_log_probs);
+}
+
+TEST(SpeculativeDecodingBeamSearchTest, validates_candidates_of_each_beam) {
+    ov::genai::GenerationConfig sampling_config;
+    sampling_config.num_beams = 2;
+    sampling_config.num_return_sequences = 2;
+    sampling_config.num_assistant_tokens = 2;
+    sampling_config.max_new_tokens = 10;
+
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(0, input_tensor, sampling_config, 32);
+    ov::genai::Sampler sampler;
+
+    // prompt phase: beams are started by tokens 1 and 2
+    sequence_group->schedule_tokens(input_vector.size());
+    sequence_group->set_output_seq_len(1);
+    std::vector<float> prompt_logits = { 0, 10.f, 9.f, 0, 0 };
+    sampler.sample({sequence_group}, ov::Tensor(ov::element::f32, ov::Shape{1, 1, 5}, prompt_logits.data()), true);
+    ASSERT_EQ(sequence_group->num_running_seqs(), 2);
+
+    // candidates [3, 4] of both beams: beam [1] accepts both, beam [2] accepts 3 and continues by 0 instead of 4
+    const size_t num_candidates = 2;
+    auto running_sequences = sequence_group->get_running_sequences();
+    std::vector<float> logits;
+    for (const auto& sequence : running_sequences) {
+        sequence->append_token(3, 0.f);
+        sequence->append_token(4, 0.f);
+        const int64_t second_token = sequence->get_generated_ids().front() == 1 ? 4 : 0;
+        for (int64_t token : { int64_t(3), second_token, int64_t(0) }) {
+            for (int64_t i = 0; i < 5; ++i) {
+                logits.push_back(i == token ? 10.f : 0.f);
+            }
+        }
+    }
+    sequence_group->set_num_validated_tokens(num_candidates);
+    const auto num_scheduled_tokens = sequence_group->get_num_available_tokens_for_batching();
+    ASSERT_EQ(num_scheduled_tokens, num_candidates + 1);
+    sequence_group->schedule_tokens(num_scheduled_tokens);
+    sampler.sample({sequence_group}, ov::Tensor(ov::element::f32, ov::Shape{running_sequences.size(), num_scheduled_tokens, 5}, logits.data()), true);
+
+    ASSERT_EQ(sequence_group->num_running_seqs(), 2);
+    for (const auto& sequence : sequence_group->get_running_sequences()) {
+        const ov::genai::TokenIds expected = sequence->get_generated_ids().front() == 1 ? ov::genai::TokenIds{1, 3, 4} : ov::genai::TokenIds{2, 3, 0};
+        ASSERT_EQ(sequence->get_generated_ids(), expected);
+    }
+    // the last generated token is processed at the next step
+    ASSERT_EQ(sequence_group->get_num_processed_tokens(), input_vector.size() + 2);
+}
+
+TEST(AdaptiveDraftLengthControllerTest, uses_max_draft_length_before_durations_are_measured) {
+    ov::genai::AdaptiveDraftLengthController controller;
+    EXPECT_EQ(controller.choose_num_draft_tokens(0, 5), 5);
+    EXPECT_EQ(controller.get_num_draft_tokens(0), 5);
+}
+
+TEST(AdaptiveDraftLengthControllerTest, drafts_more_tokens_for_higher_acceptance) {
+    ov::genai::AdaptiveDraftLengthController controller;
+    controller.update_step_durations(0.1f, 1.f);
+    for (size_t i = 0; i < 10; ++i) {
+        // request 0 accepts all draft tokens, request 1 rejects the second one
+        controller.update_acceptance(0, 5, 5);
+        controller.update_acceptance(1, 5, 1);
+    }
+    size_t num_draft_tokens_0 = controller.choose_num_draft_tokens(0, 5);
+    size_t num_draft_tokens_1 = controller.choose_num_draft_tokens(1, 5);
+    EXPECT_EQ(num_draft_tokens_0, 5);
+    EXPECT_GT(num_draft_tokens_1, 0);
+    EXPECT_LT(num_draft_tokens_1, num_draft_tokens_0);
+}
+
+TEST(AdaptiveDraftLengthControllerTest, disables_drafting_when_it_does_not_pay_off) {
+    const size_t probe_interval = 4;
+    ov::genai::AdaptiveDraftLengthController controller(0.8f, probe_interval);
+    // draft model is as expensive as the main one
+    controller.update_step_durations(1.f, 1.f);
+    for (size_t i = 0; i < 10; ++i)
+        controller.update_acceptance(0, 3, 0);
+    for (size_t step = 1; step < probe_interval; ++step)
+        EXPECT_EQ(controller.choose_num_draft_tokens(0, 3), 0);
+    // a single token is drafted periodically to track acceptance
+    EXPECT_EQ(controller.choose_num_draft_tokens(0, 3), 1);
+    EXPECT_EQ(controller.choose_num_draft_tokens(0, 3), 0);
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "stateful_batching/stateful_batching_impl.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t batch_size = 2, num_heads = 2, head_size = 3;
+
+// stateful model appending its inputs to KV cache of a single layer
+ov::InferRequest create_kv_cache_request() {
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    for (const std::string name : {"key", "value"}) {
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{
+            ov::PartialShape{-1, num_heads, -1, head_size}, ov::element::f32, "past_key_values.0." + name + "present.0." + name});
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, num_heads, -1, head_size});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto present = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, input}, 2);
+        parameters.push_back(input);
+        results.push_back(std::make_shared<ov::op::v0::Result>(present));
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(present, variable));
+    }
+    auto model = std::make_shared<ov::Model>(results, sinks, parameters);
+    return utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+// each element of KV cache is the id of its column
+void fill_kv_cache(ov::InferRequest& request, size_t kv_cache_len) {
+    for (auto& state : request.query_state()) {
+        ov::Tensor tensor(ov::element::f32, {batch_size, num_heads, kv_cache_len, head_size});
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            tensor.data<float>()[i] = static_cast<float>(i / head_size % kv_cache_len);
+        }
+        state.set_state(tensor);
+    }
+}
+
+}  // namespace
+
+TEST(StatefulBatching, compacts_columns_of_kv_cache_attended_by_no_row) {
+    ov::InferRequest request = create_kv_cache_request();
+    fill_kv_cache(request, 6);
+    // columns 1, 2 and 4 aren't attended, e.g. they were of a finished request or padding of admitted prompts
+    std::vector<std::vector<int64_t>> attention_mask = {{1, 0, 0, 0, 0, 1},
+                                                        {0, 0, 0, 1, 0, 1}};
+
+    EXPECT_EQ(compact_kv_cache(request, 2, attention_mask, 6), 3u);
+    EXPECT_EQ(attention_mask, std::vector<std::vector<int64_t>>({{1, 0, 1},
+                                                                 {0, 1, 1}}));
+    const std::vector<float> kept_columns = {0, 3, 5};
+    for (auto& state : request.query_state()) {
+        ov::Tensor tensor = state.get_state();
+        ASSERT_EQ(tensor.get_shape(), ov::Shape({batch_size, num_heads, kept_columns.size(), head_size}));
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            EXPECT_EQ(tensor.data<float>()[i], kept_columns[i / head_size % kept_columns.size()]);
+        }
+    }
+}
+
+TEST(StatefulBatching, keeps_kv_cache_mostly_attended) {
+    ov::InferRequest request = create_kv_cache_request();
+    fill_kv_cache(request, 6);
+    // 4 of 6 columns are attended
+    const std::vector<std::vector<int64_t>> initial_attention_mask = {{1, 0, 0, 1, 0, 1},
+                                                                      {0, 0, 0, 1, 1, 1}};
+    std::vector<std::vector<int64_t>> attention_mask = initial_attention_mask;
+
+    EXPECT_EQ(compact_kv_cache(request, 2, attention_mask, 6), 6u);
+    EXPECT_EQ(attention_mask, initial_attention_mask);
+    for (auto& state : request.query_state()) {
+        EXPECT_EQ(state.get_state().get_shape(), ov::Shape({batch_size, num_heads, 6, head_size}));
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "speculative_decoding/stateful_drafter.hpp"
+
+TEST(TestStatefulPromptLookup, indexes_validated_tokens_of_each_generation) {
+    ov::genai::GenerationConfig config;
+    config.max_ngram_size = 2;
+    config.num_assistant_tokens = 3;
+    ov::genai::StatefulPromptLookup prompt_lookup;
+
+    prompt_lookup.start(config);
+    std::vector<int64_t> tokens = {1, 2, 3, 4, 2};
+    EXPECT_EQ(prompt_lookup.get_candidates(tokens, config, 3), std::vector<int64_t>({3, 4, 2}));
+    // validated tokens grow, only the new ones are indexed
+    tokens.push_back(3);
+    EXPECT_EQ(prompt_lookup.get_candidates(tokens, config, 1), std::vector<int64_t>({4}));
+    EXPECT_TRUE(prompt_lookup.get_candidates(tokens, config, 0).empty());
+
+    // a new generation doesn't see tokens of the previous one
+    prompt_lookup.start(config);
+    EXPECT_TRUE(prompt_lookup.get_candidates({7, 3}, config, 3).empty());
+
+    // nothing is proposed if prompt lookup isn't enabled by the generation config
+    ov::genai::GenerationConfig greedy_config;
+    prompt_lookup.start(greedy_config);
+    EXPECT_TRUE(prompt_lookup.get_candidates(tokens, greedy_config, 3).empty());
+}
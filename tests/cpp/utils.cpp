@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include "utils.hpp"
+#include "helper.hpp"
 
 
 using namespace ov::genai::utils;
@@ -18,4 +19,19 @@ TEST(TestIsContainer, test_is_container) {
     EXPECT_EQ(is_container<std::vector<float>>, true);
     EXPECT_EQ(is_container<map_type>, true);
     EXPECT_EQ(is_container<std::set<int64_t>>, true);
-}
\ No newline at end of file
+}
+
+TEST(TestCompiledModelCacheKey, key_depends_on_model_device_and_properties) {
+    ov::Core core = singleton_core();
+    const auto model = get_dummy_model(core, 2);
+    const auto key = get_compiled_model_cache_key(model, "CPU", {ov::hint::inference_precision(ov::element::f32)});
+    ASSERT_TRUE(key.has_value());
+
+    // the same model built again has the same key, and cache directory isn't a part of the key
+    EXPECT_EQ(get_compiled_model_cache_key(get_dummy_model(core, 2), "CPU",
+                                           {ov::hint::inference_precision(ov::element::f32), ov::cache_dir("some_dir")}), key);
+
+    EXPECT_NE(get_compiled_model_cache_key(get_dummy_model(core, 3), "CPU", {ov::hint::inference_precision(ov::element::f32)}), key);
+    EXPECT_NE(get_compiled_model_cache_key(model, "GPU", {ov::hint::inference_precision(ov::element::f32)}), key);
+    EXPECT_NE(get_compiled_model_cache_key(model, "CPU", {ov::hint::inference_precision(ov::element::bf16)}), key);
+}
@@ -9,7 +9,8 @@ from pathlib import Path
 from shutil import rmtree
 from typing import Dict
 
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig,  draft_model
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig,  draft_model, \
+    GenerationStatus, KVBlockPool, kv_block_pool
 
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
 
@@ -234,6 +235,87 @@ def test_preemption(tmp_path, params):
                          scheduler_config=scheduler_params,
                          generation_config=generation_config)
 
+@pytest.mark.precommit
+def test_kv_block_pool_returns_borrowed_blocks_to_starving_pipeline(tmp_path):
+    model_id = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    generation_config = get_greedy()
+    prompts, _ = get_test_dataset()
+    borrower_prompts = prompts * 3
+    owner_prompt = prompts[0]
+
+    ref_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING, scheduler_config=dict_to_scheduler_config())
+    tokenizer = ref_pipe.get_tokenizer()
+    borrower_input_ids = [tokenizer.encode(prompt).input_ids for prompt in borrower_prompts]
+    owner_input_ids = tokenizer.encode(owner_prompt).input_ids
+    ref_results = ref_pipe.generate(borrower_input_ids + [owner_input_ids], [generation_config] * (len(borrower_prompts) + 1))
+    del ref_pipe
+
+    # both pipelines are guaranteed a half of the pool, KV cache size is defined by the pool only
+    pool = KVBlockPool(8)
+    borrower = ContinuousBatchingPipeline(models_path, SchedulerConfig(), "CPU", {**get_default_llm_properties(), "kv_block_pool": kv_block_pool(pool, 4)})
+    owner = ContinuousBatchingPipeline(models_path, SchedulerConfig(), "CPU", {**get_default_llm_properties(), "kv_block_pool": kv_block_pool(pool, 4)})
+
+    # the borrower takes the whole pool while the owner is idle
+    borrower_handles = [borrower.add_request(request_id, input_ids, generation_config) for request_id, input_ids in enumerate(borrower_input_ids)]
+    borrower.step()
+    assert pool.get_num_free_blocks() == 0
+
+    # the owner waits for its quota instead of running out of memory, and the borrower returns blocks on its next step
+    owner_handle = owner.add_request(len(borrower_prompts), owner_input_ids, generation_config)
+    while owner.has_non_finished_requests() or borrower.has_non_finished_requests():
+        if owner.has_non_finished_requests():
+            owner.step()
+        if borrower.has_non_finished_requests():
+            borrower.step()
+
+    assert borrower.get_metrics().num_preemptions > 0
+    for handle, ref_result in zip(borrower_handles + [owner_handle], ref_results):
+        assert handle.get_status() == GenerationStatus.FINISHED
+        assert [output.generated_ids for output in handle.read_all()] == ref_result.m_generation_ids
+
+    # idle pipelines without prefix caching return all blocks
+    assert pool.get_num_free_blocks() == pool.get_num_kv_blocks()
+
+
+@pytest.mark.precommit
+def test_stateful_batching_vs_paged_attention(tmp_path):
+    model_id = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    # prompts of different lengths finish after different numbers of tokens
+    prompts, _ = get_test_dataset()
+    generation_configs = []
+    for max_new_tokens in [30, 5, 20, 10]:
+        generation_config = get_greedy()
+        generation_config.max_new_tokens = max_new_tokens
+        generation_configs.append(generation_config)
+
+    ref_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING, scheduler_config=dict_to_scheduler_config())
+    tokenizer = ref_pipe.get_tokenizer()
+    input_ids = [tokenizer.encode(prompt).input_ids for prompt in prompts]
+    ref_results = ref_pipe.generate(input_ids, generation_configs)
+    del ref_pipe
+
+    # awaiting requests join the batch in rows of finished ones
+    ov_pipe = ContinuousBatchingPipeline(models_path, SchedulerConfig(), "CPU", {**get_default_llm_properties(), "stateful_batch_size": 2})
+    results = ov_pipe.generate(input_ids, generation_configs)
+    for result, ref_result in zip(results, ref_results):
+        assert result.m_generation_ids == ref_result.m_generation_ids
+
+    # requests are added while others are generated
+    handles = [ov_pipe.add_request(0, input_ids[0], generation_configs[0])]
+    for _ in range(3):
+        ov_pipe.step()
+    handles += [ov_pipe.add_request(request_id, input_ids[request_id], generation_configs[request_id]) for request_id in range(1, len(prompts))]
+    while ov_pipe.has_non_finished_requests():
+        ov_pipe.step()
+    for handle, ref_result in zip(handles, ref_results):
+        assert handle.get_status() == GenerationStatus.FINISHED
+        assert [output.generated_ids for output in handle.read_all()] == ref_result.m_generation_ids
+
+
 multinomial_params = RandomSamplingTestStruct(
     generation_config=[
         get_multinomial_temperature(),
@@ -441,3 +523,26 @@ def test_pipelines_generate_with_streaming_empty_output(tmp_path, pipeline_type)
     rmtree(models_path)
 
     assert it_cnt == 0
+
+# drafts of the main model itself are accepted, while drafts of its first decoder layers are rejected in the middle of sequences,
+# so tokens drafted ahead are discarded
+@pytest.mark.parametrize("draft", ["draft_model", "self_speculative_draft_layers"])
+@pytest.mark.precommit
+def test_pipelined_speculative_decoding_vs_speculative_decoding(tmp_path, draft):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+    draft_properties = {"draft_model": draft_model(models_path)} if draft == "draft_model" else {"self_speculative_draft_layers": 2}
+
+    prompts, _ = get_test_dataset()
+    generation_config = get_greedy()
+    generation_config.num_assistant_tokens = 5
+
+    ref_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.PAGED_ATTENTION, scheduler_config=dict_to_scheduler_config())
+    ref_texts = ref_pipe.generate(prompts, get_greedy()).texts
+    del ref_pipe
+
+    for is_pipelined in [False, True]:
+        pipe = LLMPipeline(models_path, "CPU", get_default_llm_properties(), scheduler_config=dict_to_scheduler_config(),
+                           pipelined_speculative_decoding=is_pipelined, **draft_properties)
+        assert pipe.generate(prompts, generation_config).texts == ref_texts
+        del pipe
@@ -16,7 +16,7 @@ import openvino_genai as ov_genai
 from utils.constants import get_default_llm_properties
 from utils.hugging_face import generation_config_to_hf, download_and_convert_model
 from utils.tokenizers import delete_rt_info, model_tmp_path
-from utils.ov_genai_pipelines import create_ov_pipeline, generate_and_compare
+from utils.ov_genai_pipelines import create_ov_pipeline, generate_and_compare, PipelineType
 from data.models import get_models_list, get_chat_models_list
 
 #
@@ -110,6 +110,74 @@ def test_empty_encoded_inputs_throw():
     with pytest.raises(RuntimeError):
         ov_pipe.generate(ov.Tensor(np.array([[]], dtype=np.int64)), max_new_tokens=2)
 
+@pytest.mark.parametrize("pipeline_type", [PipelineType.STATEFUL, PipelineType.PAGED_ATTENTION])
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_share_models(pipeline_type):
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    prompt = 'Why is the Sun yellow?'
+    ref = create_ov_pipeline(models_path, pipeline_type).generate(prompt, max_new_tokens=10)
+
+    ov_config = get_default_llm_properties() | {"share_models": True}
+    ov_pipes = [create_ov_pipeline(models_path, pipeline_type, ov_config=ov_config) for _ in range(3)]
+    for ov_pipe in ov_pipes:
+        assert ov_pipe.generate(prompt, max_new_tokens=10) == ref
+
+    # the shared models outlive the destroyed pipeline
+    del ov_pipes[0]
+    assert ov_pipes[-1].generate(prompt, max_new_tokens=10) == ref
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_kv_cache_sliding_window():
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    prompt = 'Why is the Sun yellow?'
+    ref = create_ov_pipeline(models_path, PipelineType.STATEFUL).generate(prompt, max_new_tokens=10)
+
+    # the window selects the stateful pipeline, nothing is evicted from the window which contains the whole sequence
+    ov_config = get_default_llm_properties() | {"kv_cache_window_size": 128, "kv_cache_sink_tokens": 4}
+    assert create_ov_pipeline(models_path, ov_config=ov_config).generate(prompt, max_new_tokens=10) == ref
+
+    # generation and chat continue beyond the window
+    ov_config = get_default_llm_properties() | {"kv_cache_window_size": 16, "kv_cache_sink_tokens": 4}
+    ov_pipe = create_ov_pipeline(models_path, ov_config=ov_config)
+    result = ov_pipe.generate([prompt], max_new_tokens=64, ignore_eos=True)
+    assert result.perf_metrics.get_num_generated_tokens() == 64
+
+    ov_pipe.start_chat()
+    for question in ['1+1=', 'What is the previous answer?', 'Why is the Sun yellow?']:
+        ov_pipe.generate(question, max_new_tokens=32, ignore_eos=True)
+    ov_pipe.finish_chat()
+
+@pytest.mark.parametrize("assisting", ["prompt_lookup", "draft_model"])
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_stateful_assisting_generation(assisting):
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    generation_config = ov_genai.GenerationConfig(max_new_tokens=20)
+    assisting_generation_config = ov_genai.GenerationConfig(max_new_tokens=20, num_assistant_tokens=5)
+    if assisting == "prompt_lookup":
+        assisting_generation_config.max_ngram_size = 3
+    ov_config = get_default_llm_properties() | {assisting: True if assisting == "prompt_lookup" else ov_genai.draft_model(models_path)}
+
+    ref_pipe = create_ov_pipeline(models_path, PipelineType.STATEFUL)
+    ov_pipe = create_ov_pipeline(models_path, PipelineType.STATEFUL, ov_config=ov_config)
+
+    # candidates validated by the main model don't change greedy output
+    prompt = 'Why is the Sun yellow? Why is the Sun yellow?'
+    assert ov_pipe.generate(prompt, assisting_generation_config) == ref_pipe.generate(prompt, generation_config)
+
+    # KV cache of the main and draft models is reused between chat turns
+    ref_pipe.start_chat()
+    ov_pipe.start_chat()
+    for question in questions:
+        assert ov_pipe.generate(question, assisting_generation_config) == ref_pipe.generate(question, generation_config)
+    ref_pipe.finish_chat()
+    ov_pipe.finish_chat()
+
 #
 # Chat scenario
 #
@@ -222,6 +290,39 @@ def test_chat_scenario_several_start(model_id):
     ov_pipe.generate(questions[0], generation_config=ov_generation_config)
     ov_pipe.finish_chat()
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_chat_sessions():
+    _, _, models_path = download_and_convert_model(get_chat_models_list()[0])
+    ov_generation_config = ov_genai.GenerationConfig(max_new_tokens=20)
+
+    ref_pipe = create_ov_pipeline(models_path, PipelineType.STATEFUL)
+    ref_pipe.start_chat()
+    ref_answers = [ref_pipe.generate(question, ov_generation_config) for question in questions[:2]]
+    ref_pipe.finish_chat()
+
+    ov_pipe = create_ov_pipeline(models_path, PipelineType.STATEFUL)
+    assert not ov_pipe.restore_chat_session("first")
+
+    ov_pipe.start_chat()
+    answers = [ov_pipe.generate(questions[0], ov_generation_config)]
+    ov_pipe.save_chat_session("first")
+
+    # another chat in between
+    ov_pipe.start_chat()
+    ov_pipe.generate(questions[2], ov_generation_config)
+    ov_pipe.save_chat_session("second")
+
+    # the restored chat continues as if it was never interrupted
+    assert ov_pipe.restore_chat_session("first")
+    answers.append(ov_pipe.generate(questions[1], ov_generation_config))
+    assert answers == ref_answers
+
+    # a restored session is taken from the cache
+    assert not ov_pipe.restore_chat_session("first")
+    assert ov_pipe.restore_chat_session("second")
+    ov_pipe.finish_chat()
+
 #
 # Streaming with callback
 #
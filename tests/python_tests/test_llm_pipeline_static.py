@@ -261,6 +261,61 @@ def test_terminate_by_sampler(config, model_id):
     assert len(encoded_results.tokens[0]) == num_iters
 
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+@pytest.mark.parametrize("prompt_len_buckets", ["1024", "16,64"])
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_bucketed_pipeline_on_cpu(prompt_len_buckets, model_id):
+    # the long prompt doesn't fit into the largest of small buckets, so it's inferred by chunks of the smallest one
+    prompts = [
+        'What is OpenVINO?',
+        'OpenVINO is an open-source toolkit for optimizing and deploying deep learning models. ' * 10 + 'What is OpenVINO?'
+    ]
+    _, _, model_path = download_and_convert_model(model_id)
+    generation_config = get_greedy()
+
+    stateful_pipe = LLMPipeline(model_path, "CPU", **get_default_llm_properties())
+    bucketed_config = get_default_llm_properties() | { 'STATIC_PIPELINE': 'BUCKETED', 'PROMPT_LEN_BUCKETS': prompt_len_buckets }
+    bucketed_pipe = LLMPipeline(model_path, "CPU", **bucketed_config)
+
+    for prompt in prompts:
+        ref_out = stateful_pipe.generate(prompt, generation_config)
+        actual_out = bucketed_pipe.generate(prompt, generation_config)
+        assert ref_out == actual_out
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_bucketed_pipeline_prompt_longer_than_max_prompt_len(model_id):
+    # the only default bucket is MAX_PROMPT_LEN, the prompt exceeds it and is inferred by its chunks into KV cache
+    # of MAX_PROMPT_LEN + MIN_RESPONSE_LEN tokens
+    prompt = 'OpenVINO is an open-source toolkit for optimizing and deploying deep learning models. ' * 10 + 'What is OpenVINO?'
+    _, _, model_path = download_and_convert_model(model_id)
+    generation_config = get_greedy()
+
+    bucketed_config = get_default_llm_properties() | { 'STATIC_PIPELINE': 'BUCKETED', 'MAX_PROMPT_LEN': 64, 'MIN_RESPONSE_LEN': 256 }
+    bucketed_pipe = LLMPipeline(model_path, "CPU", **bucketed_config)
+    assert len(bucketed_pipe.get_tokenizer().encode(prompt).input_ids.data[0]) > 64
+
+    stateful_pipe = LLMPipeline(model_path, "CPU", **get_default_llm_properties())
+    assert stateful_pipe.generate(prompt, generation_config) == bucketed_pipe.generate(prompt, generation_config)
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_bucketed_pipeline_cache_dir(model_id, tmp_path):
+    _, _, model_path = download_and_convert_model(model_id)
+    generation_config = get_greedy()
+    bucketed_config = get_default_llm_properties() | { 'STATIC_PIPELINE': 'BUCKETED', 'PROMPT_LEN_BUCKETS': '16,64', 'CACHE_DIR': str(tmp_path) }
+
+    ref_out = LLMPipeline(model_path, "CPU", **bucketed_config).generate('What is OpenVINO?', generation_config)
+    assert any(tmp_path.iterdir())
+    # models are imported from the cache of the core
+    assert LLMPipeline(model_path, "CPU", **bucketed_config).generate('What is OpenVINO?', generation_config) == ref_out
+
+
 # FIXME: Known problem, output differs from stateful pipeline starting from 3rd prompt!
 @pytest.mark.skip(reason="JIRA-144780: Output differs from stateful pipeline")
 @pytest.mark.parametrize("config", pipeline_configs)
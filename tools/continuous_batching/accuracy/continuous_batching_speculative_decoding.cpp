@@ -1,11 +1,49 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
+#include <fstream>
+#include <regex>
+#include <string>
+
 #include <openvino/openvino.hpp>
 #include <cxxopts.hpp>
 
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
+// peak resident memory of the process, 0 if it's unknown
+size_t get_peak_memory_mb() {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoul(line.substr(line.find_first_of("0123456789"))) / 1024;
+        }
+    }
+    return 0;
+}
+
+// numbers of KV cache values per token of the first `num_layers` decoder layers and of all layers of the stateful model:
+// self-speculative draft model keeps its own KV cache of the layers shared with the main model
+std::pair<size_t, size_t> get_kv_cache_values_per_token(const std::string& models_path, size_t num_layers) {
+    auto model = ov::Core().read_model(models_path + "/openvino_model.xml");
+    const std::regex layer_regex("past_key_values\\.(\\d+)\\.");
+    size_t num_layers_values = 0, num_values = 0;
+    for (const auto& variable : model->get_variables()) {
+        // batch and sequence dimensions are dynamic, the rest are heads and head size
+        size_t num_variable_values = 1;
+        for (const auto& dim : variable->get_info().data_shape) {
+            num_variable_values *= dim.is_static() ? dim.get_length() : 1;
+        }
+        std::smatch match;
+        const std::string& variable_id = variable->get_info().variable_id;
+        if (std::regex_search(variable_id, match, layer_regex) && std::stoul(match[1].str()) < num_layers) {
+            num_layers_values += num_variable_values;
+        }
+        num_values += num_variable_values;
+    }
+    return {num_layers_values, num_values};
+}
+
 void print_cb_generation_result(const ov::genai::GenerationResult& generation_result) {
     for (size_t output_id = 0; output_id < generation_result.m_generation_ids.size(); ++output_id) {
         std::cout << "Answer " << output_id << " (" << generation_result.m_scores[output_id] << ") : " << generation_result.m_generation_ids[output_id] << std::endl;
@@ -55,6 +93,9 @@ int main(int argc, char* argv[]) try {
     ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
     ("a,draft_model", "Path to assisting model base directory", cxxopts::value<std::string>()->default_value("."))
     ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("adaptive_num_assistant_tokens", "Whether to choose the number of draft tokens of each request at every step. Run with and without it to compare throughput", cxxopts::value<bool>()->default_value("false"))
+    ("self_speculative_draft_layers", "If > 0, drafts are generated by this number of first decoder layers of the main model instead of the draft model. Run with and without it to compare memory and throughput", cxxopts::value<size_t>()->default_value("0"))
+    ("num_assistant_branches", "Number of draft branches verified by main model for greedy requests with static draft length. If > 1, the run is compared with linear drafting", cxxopts::value<size_t>()->default_value("1"))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -76,6 +117,9 @@ int main(int argc, char* argv[]) try {
     const std::string models_path = result["model"].as<std::string>();
     const std::string draft_models_path = result["draft_model"].as<std::string>();
     const std::string device = result["device"].as<std::string>();
+    const bool adaptive_num_assistant_tokens = result["adaptive_num_assistant_tokens"].as<bool>();
+    const size_t num_assistant_branches = result["num_assistant_branches"].as<size_t>();
+    const size_t self_speculative_draft_layers = result["self_speculative_draft_layers"].as<size_t>();
 
     std::vector<std::string> prompt_examples = {
         "What is OpenVINO?",
@@ -90,6 +134,13 @@ int main(int argc, char* argv[]) try {
     for (size_t i = default_config_size; i < num_prompts; ++i) {
         generation_config.push_back(generation_config[i % default_config_size]);
     }
+    // linear drafting configs are kept to compare with tree speculation
+    auto linear_generation_config = generation_config;
+    for (auto& config : generation_config) {
+        if (config.is_greedy_decoding() && config.num_assistant_tokens > 0) {
+            config.num_assistant_branches = num_assistant_branches;
+        }
+    }
 
     std::vector<std::string> prompts(num_prompts);
     for (size_t i = 0; i < num_prompts; ++i) {
@@ -106,8 +157,65 @@ int main(int argc, char* argv[]) try {
     // vLLM specific params
     scheduler_config.max_num_seqs = 2;
     
-    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, {ov::genai::draft_model(draft_models_path, device)});
-    std::vector<ov::genai::GenerationResult> generation_results = pipe.generate(prompts, generation_config);
+    ov::AnyMap properties;
+    if (self_speculative_draft_layers > 0) {
+        properties.insert(ov::genai::self_speculative_draft_layers(self_speculative_draft_layers));
+    } else {
+        properties.insert(ov::genai::draft_model(draft_models_path, device));
+    }
+    if (adaptive_num_assistant_tokens) {
+        properties.insert(ov::genai::adaptive_num_assistant_tokens(true));
+    }
+    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, properties);
+    ov::genai::Tokenizer tokenizer = pipe.get_tokenizer();
+
+    // throughput is measured in tokens, not in decoded strings
+    auto measure = [&](const std::vector<ov::genai::GenerationConfig>& configs, const std::string& drafting, std::vector<ov::genai::GenerationResult>& results) {
+        auto generate_start = std::chrono::steady_clock::now();
+        results = pipe.generate(prompts, configs);
+        auto generate_end = std::chrono::steady_clock::now();
+
+        size_t num_generated_tokens = 0;
+        for (const auto& generation_result : results) {
+            for (const auto& generation : generation_result.m_generation_ids) {
+                num_generated_tokens += tokenizer.encode(generation, ov::genai::add_special_tokens(false)).input_ids.get_size();
+            }
+        }
+        // each step of speculative decoding is a single main model inference
+        size_t num_steps = results.empty() ? 0 : results.front().perf_metrics.raw_metrics.m_token_infer_durations.size();
+        float generate_duration = std::chrono::duration<float>(generate_end - generate_start).count();
+        std::cout << "Drafting: " << drafting << ", draft length: " << (adaptive_num_assistant_tokens ? "adaptive" : "static") << std::endl;
+        std::cout << "Draft model: " << (self_speculative_draft_layers > 0 ? "first " + std::to_string(self_speculative_draft_layers) + " layers of main model" : draft_models_path) << std::endl;
+        std::cout << "Generation time, s: " << generate_duration << std::endl;
+        std::cout << "Throughput, tokens/s: " << num_generated_tokens / generate_duration << std::endl;
+        if (num_steps > 0) {
+            std::cout << "Generated tokens per main model step: " << static_cast<float>(num_generated_tokens) / num_steps << std::endl;
+        }
+        // weights of both models and KV cache are included, so runs with draft model and self-speculative decoding are comparable
+        if (size_t peak_memory_mb = get_peak_memory_mb()) {
+            std::cout << "Peak memory, MB: " << peak_memory_mb << std::endl;
+        }
+        // KV cache of the shared layers is the same in both models, but it's kept twice as their block managers are independent
+        if (self_speculative_draft_layers > 0) {
+            auto [num_draft_values, num_main_values] = get_kv_cache_values_per_token(models_path, self_speculative_draft_layers);
+            std::cout << "Extra KV cache of draft model, % of main model KV cache: " << 100.f * num_draft_values / num_main_values << std::endl;
+            try {
+                ov::element::Type kv_cache_precision = ov::Core().get_property(device, ov::hint::kv_cache_precision);
+                std::cout << "Extra KV cache of draft model, KB per token: " << num_draft_values * kv_cache_precision.bitwidth() / 8.f / 1024 << std::endl;
+            } catch (const ov::Exception&) {
+                // the device doesn't report KV cache precision
+            }
+        }
+    };
+
+    std::vector<ov::genai::GenerationResult> generation_results;
+    if (num_assistant_branches > 1) {
+        std::vector<ov::genai::GenerationResult> linear_generation_results;
+        measure(linear_generation_config, "linear", linear_generation_results);
+        std::cout << std::endl;
+    }
+    measure(generation_config, num_assistant_branches > 1 ? "tree of " + std::to_string(num_assistant_branches) + " branches" : "linear", generation_results);
+    std::cout << std::endl;
 
     for (size_t request_id = 0; request_id < generation_results.size(); ++request_id) {
         const ov::genai::GenerationResult & generation_result = generation_results[request_id];
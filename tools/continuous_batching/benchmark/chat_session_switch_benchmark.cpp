@@ -0,0 +1,124 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+// Cost of switching between chats of several users served by one stateful pipeline: time to first token of a turn
+// of a chat restored from a saved session vs of the same turn, which recomputes the whole chat history.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("chat_session_switch_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("n,num_sessions", "Number of concurrent chat sessions", cxxopts::value<size_t>()->default_value("4"))
+    ("num_turns", "Number of turns of each chat", cxxopts::value<size_t>()->default_value("4"))
+    ("system_prompt_repeats", "Number of repeats of the system prompt text, defines length of chat history", cxxopts::value<size_t>()->default_value("20"))
+    ("max_new_tokens", "Max number of generated tokens per turn", cxxopts::value<size_t>()->default_value("32"))
+    ("compress", "Quantize KV cache of saved sessions", cxxopts::value<bool>()->default_value("false"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t num_sessions = result["num_sessions"].as<size_t>();
+    const size_t num_turns = result["num_turns"].as<size_t>();
+
+    std::string system_prompt;
+    for (size_t i = 0; i < result["system_prompt_repeats"].as<size_t>(); ++i) {
+        system_prompt += "You are a helpful assistant answering questions about OpenVINO, an open-source toolkit for optimizing "
+                         "and deploying deep learning models on CPUs, GPUs and NPUs. ";
+    }
+    const std::vector<std::string> questions = {
+        "What is OpenVINO?",
+        "How to convert a model?",
+        "Which devices are supported?",
+        "What is model compression?",
+    };
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+
+    ov::genai::LLMPipeline pipe(models_path, device, ov::AnyMap{{"ATTENTION_BACKEND", "SDPA"},
+                                                               ov::genai::chat_sessions_cache_size(num_sessions),
+                                                               ov::genai::compress_chat_sessions(result["compress"].as<bool>())});
+    ov::genai::Tokenizer tokenizer = pipe.get_tokenizer();
+
+    // turns of all sessions are interleaved: each turn switches to another session
+    std::vector<ov::genai::ChatHistory> histories(num_sessions, ov::genai::ChatHistory{{{"role", "system"}, {"content", system_prompt}}});
+    double restored_ttft_ms = 0, recomputed_ttft_ms = 0, switch_ms = 0;
+    size_t num_measured_turns = 0;
+    for (size_t turn = 0; turn < num_turns; ++turn) {
+        for (size_t session_id = 0; session_id < num_sessions; ++session_id) {
+            const std::string& question = questions[(turn + session_id) % questions.size()];
+
+            // the same turn recomputing the chat history
+            histories[session_id].push_back({{"role", "user"}, {"content", question}});
+            ov::genai::GenerationConfig recomputed_config = generation_config;
+            recomputed_config.apply_chat_template = false;
+            std::string templated_history = tokenizer.apply_chat_template(histories[session_id], true);
+            ov::genai::DecodedResults recomputed = pipe.generate(templated_history, recomputed_config);
+
+            auto switch_start = std::chrono::steady_clock::now();
+            if (!pipe.restore_chat_session(std::to_string(session_id))) {
+                pipe.start_chat(system_prompt);
+            }
+            auto switch_end = std::chrono::steady_clock::now();
+            ov::genai::DecodedResults restored = pipe.generate(question, generation_config);
+            auto save_start = std::chrono::steady_clock::now();
+            pipe.save_chat_session(std::to_string(session_id));
+            auto save_end = std::chrono::steady_clock::now();
+            pipe.finish_chat();
+            histories[session_id].push_back({{"role", "assistant"}, {"content", restored.texts[0]}});
+
+            // the first turn of a session prefills its system prompt in both cases
+            if (turn > 0) {
+                restored_ttft_ms += restored.perf_metrics.get_ttft().mean;
+                recomputed_ttft_ms += recomputed.perf_metrics.get_ttft().mean;
+                switch_ms += std::chrono::duration<double, std::milli>((switch_end - switch_start) + (save_end - save_start)).count();
+                ++num_measured_turns;
+            }
+        }
+    }
+
+    if (num_measured_turns == 0) {
+        std::cout << "Set num_turns > 1 to measure switching between sessions" << std::endl;
+        return EXIT_SUCCESS;
+    }
+    std::cout << "Restored session TTFT, ms: " << restored_ttft_ms / num_measured_turns << std::endl;
+    std::cout << "Session save and restore, ms: " << switch_ms / num_measured_turns << std::endl;
+    std::cout << "Recomputed history TTFT, ms: " << recomputed_ttft_ms / num_measured_turns << std::endl;
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <ostream>
 #include <random>
+#include <sstream>
 #include <stdexcept>
 #include <thread>
 #include <mutex>
@@ -38,6 +39,8 @@ struct Dataset {
     std::vector<std::string> m_prompts;
     std::vector<ov::genai::GenerationConfig> m_sampling_params;
     std::vector<size_t> m_input_lens, m_output_lens;
+    // request arrival times relative to the start of the benchmark (used when replaying a recorded trace)
+    std::vector<std::chrono::milliseconds> m_arrival_times;
 
     size_t m_total_input_len = 0;
     size_t m_total_output_len = 0;
@@ -47,6 +50,7 @@ struct Dataset {
         m_sampling_params.reserve(size);
         m_input_lens.reserve(size);
         m_output_lens.reserve(size);
+        m_arrival_times.reserve(size);
     }
 
     void push_data(std::string prompt, ov::genai::GenerationConfig sampling_params) {
@@ -139,6 +143,46 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
     return sampled_dataset;
 }
 
+// Loads a recorded trace of requests: JSON array of objects with the following fields:
+// - "prompt": request prompt
+// - "max_new_tokens": max_new_tokens requested by the client (optional)
+// - "output_len": number of tokens generated for the request (optional, used if max_new_tokens is not set)
+// - "arrival_time_ms": arrival time of the request relative to the first one (optional)
+Dataset trace_dataset(const std::string& models_path, const std::string& trace_path, const size_t num_prompts) {
+    std::ifstream json_file(trace_path.c_str());
+    OPENVINO_ASSERT(json_file.is_open(), "Cannot open trace file");
+
+    nlohmann::json json_trace = nlohmann::json::parse(json_file);
+    Dataset dataset;
+    dataset.reserve(std::min(num_prompts, json_trace.size()));
+
+    ov::genai::Tokenizer tokenizer(models_path);
+
+    for (auto json_data_iterator = json_trace.begin(); json_data_iterator != json_trace.end() && dataset.size() < num_prompts; ++json_data_iterator) {
+        auto & json_data = *json_data_iterator;
+        std::string prompt = json_data["prompt"];
+        size_t input_len = tokenizer.encode(prompt).input_ids.get_size();
+        size_t output_len = json_data.value("output_len", 0);
+
+        ov::genai::GenerationConfig greedy_search = ov::genai::greedy();
+        if (json_data.contains("max_new_tokens")) {
+            // generation length is driven by the model as in the recorded run
+            greedy_search.max_new_tokens = json_data["max_new_tokens"].get<size_t>();
+        } else {
+            OPENVINO_ASSERT(output_len > 0, "Either 'max_new_tokens' or 'output_len' must be set for each request in trace");
+            greedy_search.max_new_tokens = output_len;
+            greedy_search.ignore_eos = true;
+        }
+
+        dataset.push_data(prompt, greedy_search);
+        dataset.push_lens(input_len, output_len);
+        dataset.m_arrival_times.push_back(std::chrono::milliseconds(json_data.value("arrival_time_ms", 0)));
+    }
+
+    OPENVINO_ASSERT(!dataset.empty(), "Trace does not contain any requests");
+    return dataset;
+}
+
 class GenerationInfo {
 
     struct SequenceInfo {
@@ -281,7 +325,7 @@ public:
         return num_finished;
     }
 
-    void print_statistics() {
+    void print_statistics(const ov::genai::PipelineMetrics& pipeline_metrics) {
         std::chrono::seconds total_duration = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time);
         std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
         std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
@@ -305,6 +349,8 @@ public:
         std::cout << "Output throughput: " << total_output_len / total_duration.count() << " tokens / s" << std::endl;
         std::cout << "Mean TTFT: " << mean_ttft.count() << " ms" << std::endl;
         std::cout << "Mean TPOT: " << mean_tpot.count() << " ms" << std::endl; 
+        std::cout << "Number of preemptions: " << pipeline_metrics.num_preemptions << std::endl;
+        std::cout << "Max KV cache usage: " << pipeline_metrics.max_cache_usage << " %" << std::endl;
     }
 };
 
@@ -332,11 +378,15 @@ void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* data
     */
 
     std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
-    generation_info_collector->set_start_time(std::chrono::steady_clock::now());
+    const auto start_time = std::chrono::steady_clock::now();
+    const bool is_trace_replay = !dataset->m_arrival_times.empty();
+    generation_info_collector->set_start_time(start_time);
     for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+        if (is_trace_replay)
+            std::this_thread::sleep_until(start_time + dataset->m_arrival_times[request_id]);
         std::cout << "Traffic thread adding request to the queue..." << std::endl;
         generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
-        if (numeric_request_rate > 0)
+        if (numeric_request_rate > 0 && !is_trace_replay)
             std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
     }
     std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
@@ -354,17 +404,33 @@ void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset
     std::cout << "All requests processed, LLM Engine loop escaped. Exiting thread." << std::endl;
 }
 
-void statisticsReporter(GenerationInfoCollector* generations_info_collector, int num_prompts) {
+void statisticsReporter(ov::genai::ContinuousBatchingPipeline* pipe, GenerationInfoCollector* generations_info_collector, int num_prompts) {
     int num_finished = 0;
     while (num_finished < num_prompts) {
         num_finished = generations_info_collector->run();
     }
     std::cout << "Benchmark finished, summarizing statistics..." << std::endl;
-    generations_info_collector->print_statistics();
+    generations_info_collector->print_statistics(pipe->get_metrics());
 
     std::cout << "Exiting statistics reporter thread." << std::endl;
 }
 
+// parses a list of CPUs like "0-27,56-83"
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list) {
+    std::vector<size_t> cpus;
+    std::stringstream cpu_list_stream(cpu_list);
+    std::string range;
+    while (std::getline(cpu_list_stream, range, ',')) {
+        size_t dash_pos = range.find('-');
+        size_t first = std::stoul(range.substr(0, dash_pos));
+        size_t last = dash_pos == std::string::npos ? first : std::stoul(range.substr(dash_pos + 1));
+        for (size_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
 bool parse_plugin_config_json(nlohmann::json& node, ov::AnyMap& device_config_map) {
     if (!node.is_object()) {
         std::cout << "Error: nlohmann json object is not an object." << std::endl;
@@ -445,6 +511,15 @@ int main(int argc, char* argv[]) try {
     ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
     ("device_config", "Plugin configuration JSON. Example: '{\"MODEL_DISTRIBUTION_POLICY\":\"TENSOR_PARALLEL\",\"PERF_COUNT\":true}' Default: {\"PERF_COUNT\":true}", cxxopts::value<std::string>()->default_value("{\"PERF_COUNT\":true}"))
     ("use_cache_eviction", "Whether to use cache eviction", cxxopts::value<bool>()->default_value("false"))
+    ("trace", "Path to recorded trace .json file to replay instead of the dataset. Requests are sent at their recorded arrival times", cxxopts::value<std::string>()->default_value(""))
+    ("use_output_length_prediction", "Whether to admit new prompts based on predicted output lengths of running requests", cxxopts::value<bool>()->default_value("false"))
+    ("enable_chunked_prefill", "Whether to split long prompts into chunks in vLLM scheduling", cxxopts::value<bool>()->default_value("false"))
+    ("prompt_only_batches", "Whether batches with prompt chunks must not contain generation tokens in vLLM scheduling", cxxopts::value<bool>()->default_value("true"))
+    ("data_parallel_replicas", "Number of data-parallel pipeline replicas, 0 means one replica per NUMA node. Each replica allocates its own KV cache of cache_size. Run with 1 (default) to compare throughput against a single instance", cxxopts::value<size_t>()->default_value("1"))
+    ("pipelined_speculative_decoding", "Whether draft model drafts next tokens while main model validates the current ones", cxxopts::value<bool>()->default_value("false"))
+    ("main_cpus", "CPUs executing main model of speculative decoding, e.g. 0-27,56-83. Default: all CPUs, or the first NUMA node in pipelined mode", cxxopts::value<std::string>()->default_value(""))
+    ("draft_cpus", "CPUs executing draft model of speculative decoding, e.g. 28-55,84-111. Default: all CPUs, or the second NUMA node in pipelined mode", cxxopts::value<std::string>()->default_value(""))
+    ("stateful_batch_size", "Max number of requests generated at once by a stateful model instead of paged attention. Run with 0 (default) to compare throughput against paged attention", cxxopts::value<size_t>()->default_value("0"))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -474,11 +549,22 @@ int main(int argc, char* argv[]) try {
     const std::string device_config = result["device_config"].as<std::string>();
     const size_t cache_size = result["cache_size"].as<size_t>();
     const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
+    const std::string trace_path = result["trace"].as<std::string>();
+    const bool use_output_length_prediction = result["use_output_length_prediction"].as<bool>();
+    const bool enable_chunked_prefill = result["enable_chunked_prefill"].as<bool>();
+    const bool prompt_only_batches = result["prompt_only_batches"].as<bool>();
+    const size_t data_parallel_replicas = result["data_parallel_replicas"].as<size_t>();
+    const size_t stateful_batch_size = result["stateful_batch_size"].as<size_t>();
+    const bool pipelined_speculative_decoding = result["pipelined_speculative_decoding"].as<bool>();
+    const std::string main_cpus = result["main_cpus"].as<std::string>();
+    const std::string draft_cpus = result["draft_cpus"].as<std::string>();
 
     bool is_speculative_decoding_enabled = !draft_model_path.empty();
 
     // Create requests for generation
-    Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len);
+    Dataset dataset = trace_path.empty() ? filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len) :
+                                           trace_dataset(models_path, trace_path, num_prompts);
+    const size_t num_requests = dataset.size();
 
     // Perform the first inference
     ov::genai::SchedulerConfig scheduler_config;
@@ -486,6 +572,9 @@ int main(int argc, char* argv[]) try {
     scheduler_config.cache_size = cache_size,
     scheduler_config.dynamic_split_fuse = dynamic_split_fuse,
     scheduler_config.max_num_seqs = 256; // not used if dynamic_split_fuse=True
+    scheduler_config.use_output_length_prediction = use_output_length_prediction;
+    scheduler_config.enable_chunked_prefill = enable_chunked_prefill;
+    scheduler_config.prompt_only_batches = prompt_only_batches;
     if (use_cache_eviction) {
         scheduler_config.use_cache_eviction = true;
         scheduler_config.cache_eviction_config = ov::genai::CacheEvictionConfig(32, 32, 128, ov::genai::AggregationMode::NORM_SUM);
@@ -496,22 +585,50 @@ int main(int argc, char* argv[]) try {
     std::cout << "\tScheduling type: " << (scheduler_config.dynamic_split_fuse ? "dynamic split-fuse" : "vLLM") << std::endl;
     if (!scheduler_config.dynamic_split_fuse) {
         std::cout << "\tMax number of batched sequences: " << scheduler_config.max_num_seqs << std::endl;
+        std::cout << "\tChunked prefill: " << (scheduler_config.enable_chunked_prefill ? (scheduler_config.prompt_only_batches ? "prompt-only batches" : "mixed batches") : "disabled") << std::endl;
     }
     std::cout << "Dataset parameters: " << std::endl;
-    std::cout << "\tNum prompts: " << num_prompts << std::endl;
+    std::cout << "\tNum prompts: " << num_requests << std::endl;
+    if (!trace_path.empty()) {
+        std::cout << "\tReplayed trace: " << trace_path << std::endl;
+    }
     std::cout << "\tMax input length: " << max_input_len << std::endl;
     std::cout << "\tMax output length: " << max_output_len << std::endl;
     std::cout << "\tTarget device: " << device << std::endl;
     std::cout << "\tPlugin configuration JSON: " << device_config << std::endl;
-
-    ov::AnyMap device_config_map = {};
+    std::cout << "\tData-parallel replicas: " << (data_parallel_replicas == 0 ? "one per NUMA node" : std::to_string(data_parallel_replicas)) << std::endl;
+    std::cout << "\tStateful batch size: " << (stateful_batch_size == 0 ? "disabled, paged attention" : std::to_string(stateful_batch_size)) << std::endl;
     if (is_speculative_decoding_enabled) {
-        device_config_map.insert({ ov::genai::draft_model(draft_model_path) });
+        std::cout << "\tPipelined speculative decoding: " << (pipelined_speculative_decoding ? "enabled" : "disabled") << std::endl;
+        std::cout << "\tMain model CPUs: " << (main_cpus.empty() ? "default" : main_cpus) << std::endl;
+        std::cout << "\tDraft model CPUs: " << (draft_cpus.empty() ? "default" : draft_cpus) << std::endl;
     }
+
+    ov::AnyMap device_config_map = {};
     if (!parse_plugin_config_string(device_config, device_config_map)) {
         std::cout << "ERROR: Wrong json parameter in device_config." << std::endl;
         return EXIT_FAILURE;
     }
+    if (is_speculative_decoding_enabled) {
+        // draft model gets the same plugin configuration as main model, but its own CPUs
+        ov::AnyMap draft_model_config_map = device_config_map;
+        if (!draft_cpus.empty()) {
+            draft_model_config_map.insert({ ov::genai::cpu_affinity(parse_cpu_list(draft_cpus)) });
+        }
+        device_config_map.insert({ ov::genai::draft_model(draft_model_path, device, draft_model_config_map) });
+        if (!main_cpus.empty()) {
+            device_config_map.insert({ ov::genai::cpu_affinity(parse_cpu_list(main_cpus)) });
+        }
+        if (pipelined_speculative_decoding) {
+            device_config_map.insert({ ov::genai::pipelined_speculative_decoding(true) });
+        }
+    }
+    if (data_parallel_replicas != 1) {
+        device_config_map.insert({ ov::genai::data_parallel_replicas(data_parallel_replicas) });
+    }
+    if (stateful_batch_size > 0) {
+        device_config_map.insert({ ov::genai::stateful_batch_size(stateful_batch_size) });
+    }
     
     // Benchmarking
     std::cout << "Loading models, creating pipelines, preparing environment..." << std::endl;
@@ -522,14 +639,14 @@ int main(int argc, char* argv[]) try {
     GenerationInfoCollector generation_info_collector;
 
     std::atomic<bool> finishGenerationThread{false};
-    if (request_rate == "inf") {
+    if (request_rate == "inf" && trace_path.empty()) {
         std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
         trafficSimulatorThread.join();
     }
     
     std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
-    std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
-    if (request_rate != "inf") {
+    std::thread statisticsReporterThread(statisticsReporter, &pipe, &generation_info_collector, num_requests);
+    if (request_rate != "inf" || !trace_path.empty()) {
         std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
         trafficSimulatorThread.join();
     }
@@ -0,0 +1,136 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+
+// Stress test of request ingestion: many producer threads call add_request concurrently (like workers of an HTTP front-end)
+// while a single engine thread executes steps. Reports latency of add_request calls and the request ingestion rate.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("continuous_batching_ingestion_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("num_producers", "Number of threads adding requests concurrently", cxxopts::value<size_t>()->default_value("32"))
+    ("num_requests_per_producer", "Number of requests added by each producer thread", cxxopts::value<size_t>()->default_value("256"))
+    ("max_new_tokens", "Max number of generated tokens per request", cxxopts::value<size_t>()->default_value("1"))
+    ("prompt", "Prompt shared by all requests, so prefix caching has hits", cxxopts::value<std::string>()->default_value("What is OpenVINO? Describe its main components in detail."))
+    ("enable_prefix_caching", "Whether to enable prefix caching", cxxopts::value<bool>()->default_value("true"))
+    ("cache_size", "Size of memory used for KV cache in GB", cxxopts::value<size_t>()->default_value("4"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t num_producers = result["num_producers"].as<size_t>();
+    const size_t num_requests_per_producer = result["num_requests_per_producer"].as<size_t>();
+    const size_t max_new_tokens = result["max_new_tokens"].as<size_t>();
+    const std::string prompt = result["prompt"].as<std::string>();
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.enable_prefix_caching = result["enable_prefix_caching"].as<bool>();
+
+    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device);
+    ov::genai::Tokenizer tokenizer = pipe.get_tokenizer();
+    // prompts are tokenized in advance to measure ingestion only
+    ov::Tensor input_ids = tokenizer.encode(prompt).input_ids;
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = max_new_tokens;
+
+    const size_t num_requests = num_producers * num_requests_per_producer;
+    std::vector<std::vector<double>> add_request_latencies_us(num_producers);
+    std::vector<std::vector<ov::genai::GenerationHandle>> handles(num_producers);
+    std::atomic<bool> start{false}, producers_finished{false};
+
+    std::thread engine_thread([&] {
+        while (!producers_finished || pipe.has_non_finished_requests()) {
+            if (pipe.has_non_finished_requests())
+                pipe.step();
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> producer_threads;
+    for (size_t producer_id = 0; producer_id < num_producers; ++producer_id) {
+        producer_threads.emplace_back([&, producer_id] {
+            while (!start)
+                std::this_thread::yield();
+            for (size_t i = 0; i < num_requests_per_producer; ++i) {
+                size_t request_id = producer_id * num_requests_per_producer + i;
+                auto add_start = std::chrono::steady_clock::now();
+                handles[producer_id].push_back(pipe.add_request(request_id, input_ids, generation_config));
+                auto add_end = std::chrono::steady_clock::now();
+                add_request_latencies_us[producer_id].push_back(std::chrono::duration<double, std::micro>(add_end - add_start).count());
+            }
+        });
+    }
+
+    auto ingestion_start = std::chrono::steady_clock::now();
+    start = true;
+    for (auto& producer_thread : producer_threads)
+        producer_thread.join();
+    auto ingestion_end = std::chrono::steady_clock::now();
+    producers_finished = true;
+    engine_thread.join();
+    auto processing_end = std::chrono::steady_clock::now();
+
+    std::vector<double> latencies_us;
+    for (const auto& producer_latencies_us : add_request_latencies_us)
+        latencies_us.insert(latencies_us.end(), producer_latencies_us.begin(), producer_latencies_us.end());
+    std::sort(latencies_us.begin(), latencies_us.end());
+    auto percentile = [&latencies_us](double p) {
+        return latencies_us[std::min(latencies_us.size() - 1, static_cast<size_t>(p * latencies_us.size()))];
+    };
+
+    size_t num_finished = 0;
+    for (const auto& producer_handles : handles)
+        num_finished += std::count_if(producer_handles.begin(), producer_handles.end(), [](const ov::genai::GenerationHandle& handle) {
+            return handle->get_status() == ov::genai::GenerationStatus::FINISHED;
+        });
+
+    double ingestion_s = std::chrono::duration<double>(ingestion_end - ingestion_start).count();
+    double processing_s = std::chrono::duration<double>(processing_end - ingestion_start).count();
+    std::cout << "Producers: " << num_producers << ", requests: " << num_requests << ", finished: " << num_finished << std::endl;
+    std::cout << "add_request latency, us: p50 " << percentile(0.5) << ", p99 " << percentile(0.99) << ", max " << latencies_us.back() << std::endl;
+    std::cout << "Ingestion rate: " << num_requests / ingestion_s << " requests/s" << std::endl;
+    std::cout << "Processing rate: " << num_requests / processing_s << " requests/s" << std::endl;
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+// Time to construct LLMPipeline with a cold cache of compiled models vs a warm one. The cache is OpenVINO core's own
+// `ov::cache_dir`, which pipelines pass to the core with the rest of properties: the core hashes models as they are
+// compiled, so the model transformed for paged attention and the stateful one get their own blobs, which are imported
+// instead of compilation when the cache is warm.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("pipeline_startup_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("cache_dir", "Directory of compiled model cache, it's cleared before the first run", cxxopts::value<std::string>()->default_value("pipeline_startup_cache"))
+    ("attention_backends", "Attention backends to measure", cxxopts::value<std::vector<std::string>>()->default_value("SDPA,PA"))
+    ("n,num_warm_starts", "Number of constructions with the warm cache", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const std::filesystem::path cache_dir = result["cache_dir"].as<std::string>();
+    const size_t num_warm_starts = result["num_warm_starts"].as<size_t>();
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 1;
+
+    for (const std::string& attention_backend : result["attention_backends"].as<std::vector<std::string>>()) {
+        const std::filesystem::path backend_cache_dir = cache_dir / attention_backend;
+        std::filesystem::remove_all(backend_cache_dir);
+        ov::AnyMap properties = {{"ATTENTION_BACKEND", attention_backend},
+                                 ov::cache_dir(backend_cache_dir.string())};
+
+        for (size_t i = 0; i <= num_warm_starts; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            ov::genai::LLMPipeline pipe(models_path, device, properties);
+            auto construction_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            // the first inference is a part of startup, e.g. some plugins allocate memory there
+            start = std::chrono::steady_clock::now();
+            pipe.generate("Hello", generation_config);
+            auto first_generation_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << attention_backend << ", " << (i == 0 ? "cold" : "warm") << " start"
+                      << ", construction, ms: " << construction_ms
+                      << ", first generation, ms: " << first_generation_ms << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+
+// Prompt lookup decoding on long contexts (like RAG prompts): the prompt is a document repeated up to the given number of tokens,
+// so candidates are found in the prompt at every step. Reports time per generated token for each context length,
+// which should not grow with the context length beyond the cost of attention, and generated tokens per step.
+// With --datastore, candidates not found in the context are retrieved from a datastore built by build_prompt_lookup_datastore.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("prompt_lookup_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("context_lens", "Comma separated prompt lengths in tokens", cxxopts::value<std::string>()->default_value("1024,8192,32768"))
+    ("max_new_tokens", "Max number of generated tokens per request", cxxopts::value<size_t>()->default_value("256"))
+    ("num_assistant_tokens", "Max number of candidates per step", cxxopts::value<size_t>()->default_value("5"))
+    ("max_ngram_size", "Max size of n-gram looked up in the context", cxxopts::value<size_t>()->default_value("3"))
+    ("document", "Text repeated to build the prompt", cxxopts::value<std::string>()->default_value(
+        "OpenVINO is an open-source toolkit for optimizing and deploying deep learning models. "
+        "It converts models from popular frameworks, applies compression and runs inference on CPUs, GPUs and NPUs. "))
+    ("cache_size", "Size of memory used for KV cache in GB", cxxopts::value<size_t>()->default_value("8"))
+    ("datastore", "Path to prompt lookup datastore to retrieve candidates from", cxxopts::value<std::string>()->default_value(""))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const std::string document = result["document"].as<std::string>();
+    const std::string datastore_path = result["datastore"].as<std::string>();
+
+    std::vector<size_t> context_lens;
+    std::stringstream context_lens_stream(result["context_lens"].as<std::string>());
+    for (std::string context_len; std::getline(context_lens_stream, context_len, ',');) {
+        context_lens.push_back(std::stoul(context_len));
+    }
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.max_num_batched_tokens = *std::max_element(context_lens.begin(), context_lens.end());
+
+    ov::AnyMap properties{ov::genai::prompt_lookup(true)};
+    if (!datastore_path.empty()) {
+        properties.insert(ov::genai::prompt_lookup_datastore(datastore_path));
+    }
+    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, properties);
+    ov::genai::Tokenizer tokenizer = pipe.get_tokenizer();
+    std::vector<int64_t> document_ids;
+    {
+        ov::Tensor document_tensor = tokenizer.encode(document, ov::AnyMap{ov::genai::add_special_tokens(false)}).input_ids;
+        const int64_t* document_data = document_tensor.data<const int64_t>();
+        document_ids.assign(document_data, document_data + document_tensor.get_size());
+    }
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    generation_config.num_assistant_tokens = result["num_assistant_tokens"].as<size_t>();
+    generation_config.max_ngram_size = result["max_ngram_size"].as<size_t>();
+    generation_config.ignore_eos = true;
+
+    std::cout << "Context length, tokens | Generated tokens | Time per output token, ms | Tokens per step" << std::endl;
+    for (size_t context_len : context_lens) {
+        ov::Tensor input_ids(ov::element::i64, {1, context_len});
+        int64_t* input_ids_data = input_ids.data<int64_t>();
+        for (size_t i = 0; i < context_len; ++i) {
+            input_ids_data[i] = document_ids[i % document_ids.size()];
+        }
+
+        // the prompt is processed in a separate step, so it's excluded from the time per output token
+        ov::genai::GenerationHandle handle = pipe.add_request(context_len, input_ids, generation_config);
+        pipe.step();
+        auto generation_start = std::chrono::steady_clock::now();
+        size_t num_steps = 0;
+        while (pipe.has_non_finished_requests()) {
+            pipe.step();
+            ++num_steps;
+        }
+        auto generation_end = std::chrono::steady_clock::now();
+
+        size_t num_generated_tokens = 0;
+        for (const auto& output : handle->read_all()) {
+            num_generated_tokens = output.generated_ids.size();
+        }
+        double generation_ms = std::chrono::duration<double, std::milli>(generation_end - generation_start).count();
+        std::cout << context_len << " | " << num_generated_tokens << " | "
+                  << generation_ms / (num_generated_tokens > 1 ? num_generated_tokens - 1 : 1) << " | "
+                  << (num_generated_tokens > 1 ? static_cast<double>(num_generated_tokens - 1) / num_steps : 0.0) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "sampler.hpp"
+
+namespace {
+
+// Time of validation of `num_candidates` accepted candidates for each of `num_requests` greedy requests, averaged over `num_iters`
+double validation_time_us(const ov::genai::GenerationConfig& generation_config,
+                          size_t num_candidates,
+                          size_t num_requests,
+                          size_t vocab_size,
+                          size_t num_iters) {
+    const size_t seq_len = num_candidates + 1;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> noise(0.f, 1.f);
+    std::uniform_int_distribution<int64_t> token(0, vocab_size - 1);
+
+    // candidates are argmax of their positions even after penalties, so all of them are accepted
+    std::vector<float> logits(num_requests * seq_len * vocab_size);
+    std::vector<std::vector<int64_t>> candidates(num_requests);
+    for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+        for (size_t position = 0; position < seq_len; ++position) {
+            float* row = logits.data() + (request_id * seq_len + position) * vocab_size;
+            for (size_t i = 0; i < vocab_size; ++i) {
+                row[i] = noise(rng);
+            }
+            const int64_t token_id = token(rng);
+            row[token_id] = 20.f;
+            candidates[request_id].push_back(token_id);
+        }
+    }
+    std::vector<int64_t> prompt{0, 1, 2, 3, 4};
+    ov::Tensor input_ids(ov::element::i64, ov::Shape{1, prompt.size()}, prompt.data());
+
+    ov::genai::Sampler sampler;
+    double total_us = 0;
+    for (size_t iter = 0; iter < num_iters; ++iter) {
+        std::vector<ov::genai::SequenceGroup::Ptr> sequence_groups;
+        for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+            auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(request_id, input_ids, generation_config, 32);
+            auto sequence = sequence_group->get_sequences().front();
+            // the token following the prompt is generated at the previous step, the rest are candidates
+            sequence->append_token(candidates[request_id].back(), 0.f);
+            sequence_group->update_processed_tokens_num(prompt.size());
+            for (size_t i = 0; i < num_candidates; ++i) {
+                sequence->append_token(candidates[request_id][i], 0.f);
+            }
+            sequence_group->set_num_validated_tokens(num_candidates);
+            sequence_group->schedule_tokens(sequence_group->get_num_available_tokens_for_batching());
+            sampler.create_logit_processor(request_id, generation_config, prompt);
+            sequence_groups.push_back(sequence_group);
+        }
+
+        ov::Tensor logits_tensor(ov::element::f32, ov::Shape{num_requests, seq_len, vocab_size}, logits.data());
+        auto start = std::chrono::steady_clock::now();
+        sampler.sample(sequence_groups, logits_tensor, true);
+        total_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+            sampler.clear_request_info(request_id);
+        }
+    }
+    return total_us / num_iters;
+}
+
+}  // namespace
+
+// Micro-benchmark of validation of draft candidates by the sampler in speculative decoding and prompt lookup:
+// greedy candidates without logit processing are validated by argmax of all positions at once,
+// a repetition penalty forces validation position by position through the logit processors.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("sampler_validation_benchmark", "Help command");
+
+    options.add_options()
+    ("min_candidates", "Min number of candidates per sequence", cxxopts::value<size_t>()->default_value("4"))
+    ("max_candidates", "Max number of candidates per sequence", cxxopts::value<size_t>()->default_value("16"))
+    ("num_requests", "Number of validated requests per step", cxxopts::value<size_t>()->default_value("8"))
+    ("vocab_size", "Vocabulary size", cxxopts::value<size_t>()->default_value("32000"))
+    ("num_iters", "Number of measured steps", cxxopts::value<size_t>()->default_value("100"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const size_t num_requests = result["num_requests"].as<size_t>();
+    const size_t vocab_size = result["vocab_size"].as<size_t>();
+    const size_t num_iters = result["num_iters"].as<size_t>();
+
+    ov::genai::GenerationConfig batched_config = ov::genai::greedy();
+    ov::genai::GenerationConfig per_position_config = ov::genai::greedy();
+    per_position_config.repetition_penalty = 1.1f;
+    batched_config.max_new_tokens = per_position_config.max_new_tokens = 1024;
+
+    std::cout << "Candidates | Batched validation, us | Per position validation, us | Speedup" << std::endl;
+    for (size_t num_candidates = result["min_candidates"].as<size_t>(); num_candidates <= result["max_candidates"].as<size_t>(); ++num_candidates) {
+        double batched_us = validation_time_us(batched_config, num_candidates, num_requests, vocab_size, num_iters);
+        double per_position_us = validation_time_us(per_position_config, num_candidates, num_requests, vocab_size, num_iters);
+        std::cout << num_candidates << " | " << batched_us << " | " << per_position_us << " | " << per_position_us / batched_us << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+
+// Time to first token of speculative decoding for requests sharing a long system prompt, with and without prefix caching.
+// Requests are processed one by one, so only the first one prefills the system prompt if prefix caching is enabled.
+// Draft model evicts prefixes cached by main model last, but it's not guaranteed to keep them: TTFT of main model alone
+// with prefix caching is the reference, next requests of speculative decoding match it only if draft model has avoided
+// prefill of the system prompt too.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("speculative_decoding_prefix_caching_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("a,draft_model", "Path to assisting model base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the models. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("n,num_requests", "Number of requests sharing the system prompt", cxxopts::value<size_t>()->default_value("5"))
+    ("system_prompt_repeats", "Number of repeats of the system prompt text, defines its length", cxxopts::value<size_t>()->default_value("50"))
+    ("max_new_tokens", "Max number of generated tokens per request", cxxopts::value<size_t>()->default_value("16"))
+    ("num_assistant_tokens", "Number of candidates per step", cxxopts::value<size_t>()->default_value("5"))
+    ("cache_size", "Size of memory used for KV cache in GB", cxxopts::value<size_t>()->default_value("4"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string draft_models_path = result["draft_model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t num_requests = result["num_requests"].as<size_t>();
+
+    std::string system_prompt;
+    for (size_t i = 0; i < result["system_prompt_repeats"].as<size_t>(); ++i) {
+        system_prompt += "You are a helpful assistant answering questions about OpenVINO, an open-source toolkit for optimizing "
+                         "and deploying deep learning models on CPUs, GPUs and NPUs. ";
+    }
+    const std::vector<std::string> questions = {
+        "What is OpenVINO?",
+        "How to convert a model?",
+        "Which devices are supported?",
+        "What is model compression?",
+    };
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    generation_config.num_assistant_tokens = result["num_assistant_tokens"].as<size_t>();
+
+    std::cout << "Pipeline | Prefix caching | First request TTFT, ms | Next requests mean TTFT, ms" << std::endl;
+    for (auto [is_speculative, enable_prefix_caching] : {std::pair{true, false}, std::pair{true, true}, std::pair{false, true}}) {
+        ov::genai::SchedulerConfig scheduler_config;
+        scheduler_config.cache_size = result["cache_size"].as<size_t>();
+        scheduler_config.enable_prefix_caching = enable_prefix_caching;
+        ov::AnyMap properties;
+        if (is_speculative) {
+            properties.insert(ov::genai::draft_model(draft_models_path, device));
+        } else {
+            generation_config.num_assistant_tokens = 0;
+        }
+        ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, properties);
+
+        std::vector<double> ttfts_ms;
+        for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+            const std::string prompt = system_prompt + questions[request_id % questions.size()];
+            auto start = std::chrono::steady_clock::now();
+            ov::genai::GenerationHandle handle = pipe.add_request(request_id, prompt, generation_config);
+            while (!handle->can_read() && pipe.has_non_finished_requests()) {
+                pipe.step();
+            }
+            ttfts_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            while (pipe.has_non_finished_requests()) {
+                pipe.step();
+            }
+            handle->read_all();
+        }
+
+        double next_ttfts_ms = 0;
+        for (size_t i = 1; i < ttfts_ms.size(); ++i) {
+            next_ttfts_ms += ttfts_ms[i];
+        }
+        std::cout << (is_speculative ? "speculative decoding" : "main model only") << " | "
+                  << (enable_prefix_caching ? "enabled" : "disabled") << " | " << ttfts_ms.front() << " | "
+                  << (ttfts_ms.size() > 1 ? next_ttfts_ms / (ttfts_ms.size() - 1) : 0.0) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
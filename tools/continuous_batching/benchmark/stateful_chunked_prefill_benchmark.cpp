@@ -0,0 +1,123 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+namespace {
+
+// resets peak RSS of the process, so each chunk size is measured separately
+void reset_peak_rss() {
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+// returns peak RSS of the process in MB or 0 if it's unknown
+size_t get_peak_rss_mb() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoul(line.substr(line.find_first_of("0123456789"))) / 1024;
+        }
+    }
+#endif
+    return 0;
+}
+
+std::vector<size_t> parse_chunk_sizes(const std::string& chunk_sizes) {
+    std::vector<size_t> parsed;
+    std::stringstream stream(chunk_sizes);
+    std::string chunk_size;
+    while (std::getline(stream, chunk_size, ',')) {
+        parsed.push_back(std::stoul(chunk_size));
+    }
+    return parsed;
+}
+
+}  // namespace
+
+// Peak memory and time to first token of a long prompt inferred by the stateful pipeline with different prefill chunk sizes,
+// 0 stands for the whole prompt inferred at once. Peak RSS is reset between chunk sizes on Linux only.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("stateful_chunked_prefill_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("chunk_sizes", "Comma separated prefill chunk sizes", cxxopts::value<std::string>()->default_value("0,4096,2048,1024,512"))
+    ("prompt_repeats", "Number of repeats of the prompt text, defines length of the prompt", cxxopts::value<size_t>()->default_value("400"))
+    ("n,num_iters", "Number of generations per chunk size", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t num_iters = result["num_iters"].as<size_t>();
+
+    std::string prompt;
+    for (size_t i = 0; i < result["prompt_repeats"].as<size_t>(); ++i) {
+        prompt += "OpenVINO is an open-source toolkit for optimizing and deploying deep learning models on CPUs, GPUs and NPUs. ";
+    }
+    prompt += "Summarize the text above.";
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 1;
+
+    for (size_t chunk_size : parse_chunk_sizes(result["chunk_sizes"].as<std::string>())) {
+        reset_peak_rss();
+        ov::genai::LLMPipeline pipe(models_path, device, ov::AnyMap{{"ATTENTION_BACKEND", "SDPA"},
+                                                                   ov::genai::prefill_chunk_size(chunk_size)});
+        if (chunk_size == 0) {
+            std::cout << "Prompt length, tokens: " << pipe.get_tokenizer().encode(prompt).input_ids.get_size() << std::endl;
+        }
+
+        // warmup
+        pipe.generate(prompt, generation_config);
+        double ttft_ms = 0;
+        for (size_t i = 0; i < num_iters; ++i) {
+            ov::genai::DecodedResults results = pipe.generate(prompt, generation_config);
+            ttft_ms += results.perf_metrics.get_ttft().mean;
+        }
+
+        std::cout << "Chunk size: " << chunk_size
+                  << ", TTFT, ms: " << ttft_ms / std::max(num_iters, size_t(1))
+                  << ", peak RSS, MB: " << get_peak_rss_mb() << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
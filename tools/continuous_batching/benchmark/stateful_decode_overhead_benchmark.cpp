@@ -0,0 +1,133 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/shape_of.hpp"
+
+#include "lm_encoding.hpp"
+#include "sampler.hpp"
+#include "utils.hpp"
+
+namespace {
+
+// stub of a stateful LLM: takes inputs of the stateful pipeline and returns the same logits [batch, 1, vocab_size] for each sequence,
+// so a generation step costs almost nothing but the work of the pipeline around the inference
+std::shared_ptr<ov::Model> get_stub_model(size_t vocab_size) {
+    auto input_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape::dynamic(2));
+    auto attention_mask = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape::dynamic(2));
+    auto position_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape::dynamic(2));
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape::dynamic(1));
+    input_ids->get_output_tensor(0).set_names({"input_ids"});
+    attention_mask->get_output_tensor(0).set_names({"attention_mask"});
+    position_ids->get_output_tensor(0).set_names({"position_ids"});
+    beam_idx->get_output_tensor(0).set_names({"beam_idx"});
+
+    std::vector<float> logits_row(vocab_size, 0.f);
+    logits_row[1] = 1.f;
+    auto row = ov::op::v0::Constant::create(ov::element::f32, {vocab_size}, logits_row);
+    auto batch_size = std::make_shared<ov::op::v8::Gather>(std::make_shared<ov::op::v3::ShapeOf>(input_ids),
+                                                           ov::op::v0::Constant::create(ov::element::i64, {1}, {0}),
+                                                           ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+    auto logits_shape = std::make_shared<ov::op::v0::Concat>(
+        ov::OutputVector{batch_size, ov::op::v0::Constant::create(ov::element::i64, {2}, std::vector<int64_t>{1, static_cast<int64_t>(vocab_size)})}, 0);
+    auto logits = std::make_shared<ov::op::v3::Broadcast>(row, logits_shape);
+    logits->get_output_tensor(0).set_names({"logits"});
+
+    return std::make_shared<ov::Model>(ov::OutputVector{logits}, ov::ParameterVector{input_ids, attention_mask, position_ids, beam_idx});
+}
+
+}  // namespace
+
+// Per token overhead of generation steps of the stateful pipeline, i.e. time of a step except for the inference,
+// for a growing context: inputs of steps are updated in place, so the overhead shouldn't depend on the context length.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("stateful_decode_overhead_benchmark", "Help command");
+
+    options.add_options()
+    ("context_lengths", "Prompt lengths to measure", cxxopts::value<std::vector<size_t>>()->default_value("128,1024,8192,32768"))
+    ("max_new_tokens", "Number of generated tokens", cxxopts::value<size_t>()->default_value("512"))
+    ("num_beams", "Number of beams, 1 stands for greedy decoding", cxxopts::value<size_t>()->default_value("1"))
+    ("vocab_size", "Vocabulary size", cxxopts::value<size_t>()->default_value("1024"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const size_t num_beams = result["num_beams"].as<size_t>();
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    if (num_beams > 1) {
+        generation_config = ov::genai::beam_search();
+        generation_config.num_beams = num_beams;
+        generation_config.num_beam_groups = 1;
+        generation_config.num_return_sequences = 1;
+    }
+    generation_config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    generation_config.ignore_eos = true;
+
+    ov::InferRequest request = ov::genai::utils::singleton_core().compile_model(get_stub_model(result["vocab_size"].as<size_t>()), "CPU").create_infer_request();
+
+    std::cout << "Context length | Steps | Overhead per step, us" << std::endl;
+    for (size_t context_length : result["context_lengths"].as<std::vector<size_t>>()) {
+        std::vector<int64_t> prompt(context_length);
+        std::iota(prompt.begin(), prompt.end(), 0);
+        ov::Tensor input_ids(ov::element::i64, {1, context_length}, prompt.data());
+        ov::Tensor attention_mask(ov::element::i64, {1, context_length});
+        std::fill_n(attention_mask.data<int64_t>(), context_length, 1);
+        ov::Tensor position_ids(ov::element::i64, {1, context_length});
+        ov::genai::utils::initialize_position_ids(position_ids, attention_mask);
+
+        ov::genai::Sampler sampler;
+        ov::genai::KVCacheState kv_cache_state;
+        auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(0, prompt, generation_config, 1);
+
+        auto start = std::chrono::steady_clock::now();
+        ov::genai::utils::GenerationFinishInfo finish_info = ov::genai::get_lm_encoded_results(
+            request, input_ids, attention_mask, nullptr, sampler, {sequence_group}, position_ids, kv_cache_state, std::nullopt);
+        const double total_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        const auto& raw_metrics = finish_info.results.perf_metrics.raw_metrics;
+        // the first duration is the one of the prompt
+        const size_t num_steps = raw_metrics.m_token_infer_durations.size() - 1;
+        double infer_us = 0;
+        for (const auto& duration : raw_metrics.m_token_infer_durations) {
+            infer_us += duration.count();
+        }
+        std::cout << context_length << " | " << num_steps << " | " << (total_us - infer_us) / std::max(num_steps, size_t(1)) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
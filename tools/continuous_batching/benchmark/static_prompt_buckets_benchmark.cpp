@@ -0,0 +1,99 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+// Time to first token of the static shapes pipeline across prompt lengths: prompt length buckets
+// vs a single prefill model of MAX_PROMPT_LEN tokens. Works on CPU as well as on NPU.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("static_prompt_buckets_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("max_prompt_len", "Max prompt length, the only bucket of the baseline", cxxopts::value<size_t>()->default_value("1024"))
+    ("buckets", "Comma separated prompt length buckets", cxxopts::value<std::string>()->default_value("128,512,1024"))
+    ("prompt_lengths", "Prompt lengths to measure", cxxopts::value<std::vector<size_t>>()->default_value("50,200,500,1000"))
+    ("cache_dir", "Directory to cache compiled models", cxxopts::value<std::string>()->default_value(""))
+    ("n,num_iters", "Number of generations per prompt length", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t max_prompt_len = result["max_prompt_len"].as<size_t>();
+    const size_t num_iters = result["num_iters"].as<size_t>();
+    const std::vector<size_t> prompt_lengths = result["prompt_lengths"].as<std::vector<size_t>>();
+
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 1;
+
+    const std::vector<std::pair<std::string, std::string>> bucket_sets = {
+        {"single bucket", std::to_string(max_prompt_len)},
+        {"buckets " + result["buckets"].as<std::string>(), result["buckets"].as<std::string>()},
+    };
+    for (const auto& [name, buckets] : bucket_sets) {
+        ov::AnyMap properties = {{"STATIC_PIPELINE", "BUCKETED"},
+                                 {"MAX_PROMPT_LEN", static_cast<int64_t>(max_prompt_len)},
+                                 {"PROMPT_LEN_BUCKETS", buckets}};
+        if (!result["cache_dir"].as<std::string>().empty()) {
+            properties.insert(ov::cache_dir(result["cache_dir"].as<std::string>()));
+        }
+        ov::genai::LLMPipeline pipe(models_path, device, properties);
+        // load time shows the effect of the cache of compiled models on the second run
+        std::vector<int64_t> single_token = {1};
+        ov::genai::EncodedResults warmup = pipe.generate(ov::Tensor(ov::element::i64, {1, 1}, single_token.data()), generation_config);
+        std::cout << name << ", load time, ms: " << warmup.perf_metrics.get_load_time() << std::endl;
+
+        for (size_t prompt_length : prompt_lengths) {
+            if (prompt_length > max_prompt_len) {
+                continue;
+            }
+            // token ids don't matter for the time of prefill
+            std::vector<int64_t> prompt(prompt_length, 1);
+            ov::Tensor input_ids(ov::element::i64, {1, prompt_length}, prompt.data());
+
+            // warmup
+            pipe.generate(input_ids, generation_config);
+            double ttft_ms = 0;
+            for (size_t i = 0; i < num_iters; ++i) {
+                ttft_ms += pipe.generate(input_ids, generation_config).perf_metrics.get_ttft().mean;
+            }
+            std::cout << name << ", prompt length: " << prompt_length
+                      << ", TTFT, ms: " << ttft_ms / std::max(num_iters, size_t(1)) << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
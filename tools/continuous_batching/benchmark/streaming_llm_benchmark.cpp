@@ -0,0 +1,189 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/tokenizer.hpp"
+
+#include "sliding_window_kv_cache.hpp"
+#include "utils.hpp"
+
+namespace {
+
+// resident memory of the process, 0 if unknown
+size_t get_rss_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            std::istringstream fields(line.substr(6));
+            size_t rss_kb = 0;
+            fields >> rss_kb;
+            return rss_kb;
+        }
+    }
+    return 0;
+}
+
+size_t get_kv_cache_byte_size(ov::InferRequest& request) {
+    size_t byte_size = 0;
+    for (auto& state : request.query_state()) {
+        byte_size += state.get_state().get_byte_size();
+    }
+    return byte_size;
+}
+
+struct EvaluationResult {
+    double perplexity;
+    size_t peak_kv_cache_bytes;
+};
+
+// teacher-forced perplexity of the text: tokens are inferred by chunks on top of KV cache, which is bounded by
+// `sliding_window_kv_cache` if it's set, and logits of each token are scored against the next one
+EvaluationResult evaluate(ov::InferRequest& request,
+                          const std::vector<int64_t>& tokens,
+                          size_t chunk_size,
+                          const std::optional<ov::genai::SlidingWindowKVCache>& sliding_window_kv_cache) {
+    request.reset_state();
+    const auto inputs = request.get_compiled_model().inputs();
+    const bool has_position_ids = std::any_of(inputs.begin(), inputs.end(), [](const ov::Output<const ov::Node>& input) {
+        return input.get_names().count("position_ids") > 0;
+    });
+    ov::Tensor beam_idx(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+    request.set_tensor("beam_idx", beam_idx);
+    if (sliding_window_kv_cache.has_value()) {
+        chunk_size = std::min(chunk_size, sliding_window_kv_cache->get_max_chunk_size());
+    }
+
+    double nll = 0.0;
+    size_t num_scored_tokens = 0, kv_cache_len = 0, peak_kv_cache_bytes = 0;
+    for (size_t chunk_begin = 0; chunk_begin + 1 < tokens.size(); chunk_begin += chunk_size) {
+        const size_t chunk_len = std::min(chunk_size, tokens.size() - 1 - chunk_begin);
+        if (sliding_window_kv_cache.has_value()) {
+            const size_t num_tokens_to_evict = sliding_window_kv_cache->get_num_tokens_to_evict(kv_cache_len, chunk_len);
+            sliding_window_kv_cache->evict(request, num_tokens_to_evict);
+            kv_cache_len -= num_tokens_to_evict;
+        }
+
+        ov::Tensor input_ids(ov::element::i64, {1, chunk_len});
+        std::copy_n(tokens.begin() + chunk_begin, chunk_len, input_ids.data<int64_t>());
+        request.set_tensor("input_ids", input_ids);
+        ov::Tensor attention_mask(ov::element::i64, {1, kv_cache_len + chunk_len});
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+        request.set_tensor("attention_mask", attention_mask);
+        if (has_position_ids) {
+            ov::Tensor position_ids(ov::element::i64, {1, chunk_len});
+            std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + chunk_len, static_cast<int64_t>(kv_cache_len));
+            request.set_tensor("position_ids", position_ids);
+        }
+        request.infer();
+        kv_cache_len += chunk_len;
+        peak_kv_cache_bytes = std::max(peak_kv_cache_bytes, get_kv_cache_byte_size(request));
+
+        const ov::Tensor logits = request.get_tensor("logits");
+        OPENVINO_ASSERT(logits.get_element_type() == ov::element::f32, "Logits are expected to be f32");
+        const size_t vocab_size = logits.get_shape().back();
+        for (size_t i = 0; i < chunk_len; ++i) {
+            const float* row = logits.data<const float>() + i * vocab_size;
+            const float max_logit = *std::max_element(row, row + vocab_size);
+            double sum = 0.0;
+            for (size_t token = 0; token < vocab_size; ++token) {
+                sum += std::exp(row[token] - max_logit);
+            }
+            nll += max_logit + std::log(sum) - row[tokens[chunk_begin + i + 1]];
+            ++num_scored_tokens;
+        }
+    }
+    return {std::exp(nll / std::max(num_scored_tokens, size_t(1))), peak_kv_cache_bytes};
+}
+
+}  // namespace
+
+// Perplexity and memory of KV cache bounded by attention sinks and a sliding window (see `ov::genai::kv_cache_window_size`)
+// compared to the dense KV cache: the text is scored token by token as the stateful pipeline infers it, so the dense cache
+// grows with the text while the bounded one keeps the same size and perplexity shows the cost of evicted tokens.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("streaming_llm_benchmark", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to the model and tokenizers base directory", cxxopts::value<std::string>())
+    ("text", "Path to a text file to score", cxxopts::value<std::string>())
+    ("num_tokens", "Max number of tokens of the text to score", cxxopts::value<size_t>()->default_value("4096"))
+    // RSS of the process doesn't shrink after a larger KV cache, so the dense one is measured the last
+    ("window_sizes", "Sliding windows of KV cache to measure, 0 stands for the dense KV cache", cxxopts::value<std::vector<size_t>>()->default_value("256,1024,0"))
+    ("sink_tokens", "Number of sink tokens", cxxopts::value<size_t>()->default_value("4"))
+    ("chunk_size", "Max number of tokens inferred at once", cxxopts::value<size_t>()->default_value("64"))
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::filesystem::path models_path = result["model"].as<std::string>();
+    const size_t sink_tokens = result["sink_tokens"].as<size_t>();
+    const size_t chunk_size = std::max(result["chunk_size"].as<size_t>(), size_t(1));
+
+    std::ifstream text_file(result["text"].as<std::string>());
+    OPENVINO_ASSERT(text_file.is_open(), "Failed to open ", result["text"].as<std::string>());
+    const std::string text((std::istreambuf_iterator<char>(text_file)), std::istreambuf_iterator<char>());
+    ov::Tensor input_ids = ov::genai::Tokenizer(models_path).encode(text).input_ids;
+    const int64_t* input_ids_data = input_ids.data<const int64_t>();
+    const std::vector<int64_t> tokens(input_ids_data, input_ids_data + std::min(input_ids.get_size(), result["num_tokens"].as<size_t>()));
+
+    // logits of all positions are scored, so the model isn't sliced to the last token like in the pipeline
+    std::shared_ptr<ov::Model> model = ov::genai::utils::singleton_core().read_model(models_path / "openvino_model.xml");
+    const size_t seq_length_axis = ov::genai::utils::get_kv_axes_pos(model).seq_len;
+    const auto rope_config = ov::genai::utils::from_config_json_if_exists<ov::genai::RopeConfig>(models_path, "config.json");
+    ov::InferRequest request = ov::genai::utils::singleton_core().compile_model(model, result["device"].as<std::string>()).create_infer_request();
+
+    std::cout << "Scored tokens: " << tokens.size() << std::endl;
+    std::cout << "Window size | Sink tokens | Perplexity | Peak KV cache, MB | RSS, MB" << std::endl;
+    for (size_t window_size : result["window_sizes"].as<std::vector<size_t>>()) {
+        std::optional<ov::genai::SlidingWindowKVCache> sliding_window_kv_cache;
+        if (window_size > 0) {
+            sliding_window_kv_cache = ov::genai::SlidingWindowKVCache(sink_tokens, window_size, seq_length_axis, rope_config);
+        }
+        const EvaluationResult evaluation = evaluate(request, tokens, chunk_size, sliding_window_kv_cache);
+        std::cout << (window_size > 0 ? std::to_string(window_size) : "dense") << " | "
+                  << (window_size > 0 ? sink_tokens : 0) << " | "
+                  << evaluation.perplexity << " | "
+                  << evaluation.peak_kv_cache_bytes / (1024.0 * 1024.0) << " | "
+                  << get_rss_kb() / 1024.0 << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
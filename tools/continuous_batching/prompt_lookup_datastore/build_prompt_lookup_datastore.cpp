@@ -0,0 +1,169 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+// must match the layout read by prompt lookup decoding:
+// char magic[8], uint64_t num_tokens, int32_t tokens[num_tokens], uint32_t suffix_array[num_tokens]
+constexpr char DATASTORE_MAGIC[8] = {'O', 'V', 'G', 'D', 'S', '0', '0', '1'};
+constexpr int32_t DOCUMENT_SEPARATOR = -1;
+
+std::vector<std::filesystem::path> collect_documents(const std::string& inputs, const std::vector<std::string>& extensions) {
+    std::vector<std::filesystem::path> documents;
+    auto is_document = [&extensions](const std::filesystem::path& path) {
+        return extensions.empty() || std::find(extensions.begin(), extensions.end(), path.extension().string()) != extensions.end();
+    };
+
+    std::stringstream inputs_stream(inputs);
+    for (std::string input; std::getline(inputs_stream, input, ',');) {
+        if (std::filesystem::is_directory(input)) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+                if (entry.is_regular_file() && is_document(entry.path()))
+                    documents.push_back(entry.path());
+            }
+        } else {
+            documents.push_back(input);
+        }
+    }
+    // the datastore doesn't depend on the order of directory traversal
+    std::sort(documents.begin(), documents.end());
+    return documents;
+}
+
+// suffix array by prefix doubling: O(n log^2 n) regardless of how repetitive the corpus is
+std::vector<uint32_t> build_suffix_array(const std::vector<int32_t>& tokens) {
+    const size_t num_tokens = tokens.size();
+    std::vector<uint32_t> suffix_array(num_tokens);
+    std::iota(suffix_array.begin(), suffix_array.end(), 0);
+    std::vector<int64_t> ranks(tokens.begin(), tokens.end()), next_ranks(num_tokens);
+
+    for (size_t prefix_len = 1; ; prefix_len *= 2) {
+        // suffixes are ordered by ranks of their first `prefix_len` tokens, then of the next `prefix_len` tokens
+        auto key = [&](uint32_t position) {
+            return std::make_pair(ranks[position], position + prefix_len < num_tokens ? ranks[position + prefix_len] : std::numeric_limits<int64_t>::min());
+        };
+        std::sort(suffix_array.begin(), suffix_array.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return key(lhs) < key(rhs);
+        });
+
+        int64_t rank = 0;
+        for (size_t i = 0; i < num_tokens; ++i) {
+            if (i > 0 && key(suffix_array[i - 1]) < key(suffix_array[i]))
+                ++rank;
+            next_ranks[suffix_array[i]] = rank;
+        }
+        ranks.swap(next_ranks);
+        if (num_tokens == 0 || static_cast<size_t>(rank) == num_tokens - 1)
+            break;
+    }
+    return suffix_array;
+}
+
+}  // namespace
+
+// Builds a datastore for retrieval drafting in prompt lookup decoding (`prompt_lookup_datastore` property):
+// each input file is tokenized as a document, and a suffix array of all documents is stored next to their tokens.
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("build_prompt_lookup_datastore", "Help command");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("i,input", "Comma separated documents or directories searched recursively for documents", cxxopts::value<std::string>())
+    ("extensions", "Comma separated extensions of documents in directories, e.g. .cpp,.hpp,.py. Default: all files", cxxopts::value<std::string>()->default_value(""))
+    ("o,output", "Path to the datastore file", cxxopts::value<std::string>()->default_value("prompt_lookup_datastore.bin"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("input")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string output_path = result["output"].as<std::string>();
+    std::vector<std::string> extensions;
+    {
+        std::stringstream extensions_stream(result["extensions"].as<std::string>());
+        for (std::string extension; std::getline(extensions_stream, extension, ',');)
+            extensions.push_back(extension);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    ov::genai::Tokenizer tokenizer(models_path);
+    std::vector<std::filesystem::path> documents = collect_documents(result["input"].as<std::string>(), extensions);
+
+    std::vector<int32_t> tokens;
+    for (const auto& document : documents) {
+        std::ifstream document_file(document, std::ios::binary);
+        if (!document_file) {
+            std::cerr << "Failed to read " << document << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string text((std::istreambuf_iterator<char>(document_file)), std::istreambuf_iterator<char>());
+        ov::Tensor input_ids = tokenizer.encode(text, ov::AnyMap{ov::genai::add_special_tokens(false)}).input_ids;
+        const int64_t* input_ids_data = input_ids.data<const int64_t>();
+        tokens.insert(tokens.end(), input_ids_data, input_ids_data + input_ids.get_size());
+        // matches don't cross document boundaries
+        tokens.push_back(DOCUMENT_SEPARATOR);
+    }
+    if (tokens.size() > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "Datastore can't hold more than " << std::numeric_limits<uint32_t>::max() << " tokens" << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto tokenization_end = std::chrono::steady_clock::now();
+
+    std::vector<uint32_t> suffix_array = build_suffix_array(tokens);
+    auto build_end = std::chrono::steady_clock::now();
+
+    std::ofstream output(output_path, std::ios::binary);
+    const uint64_t num_tokens = tokens.size();
+    output.write(DATASTORE_MAGIC, sizeof(DATASTORE_MAGIC));
+    output.write(reinterpret_cast<const char*>(&num_tokens), sizeof(num_tokens));
+    output.write(reinterpret_cast<const char*>(tokens.data()), tokens.size() * sizeof(int32_t));
+    output.write(reinterpret_cast<const char*>(suffix_array.data()), suffix_array.size() * sizeof(uint32_t));
+    output.close();
+    if (!output) {
+        std::cerr << "Failed to write " << output_path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Documents: " << documents.size() << ", tokens: " << num_tokens << std::endl;
+    std::cout << "Tokenization time, s: " << std::chrono::duration<double>(tokenization_end - start_time).count() << std::endl;
+    std::cout << "Suffix array build time, s: " << std::chrono::duration<double>(build_end - tokenization_end).count() << std::endl;
+    std::cout << "Datastore: " << output_path << ", " << std::filesystem::file_size(output_path) / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}